@@ -0,0 +1,158 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "typedef.h"
+#include "macros.h"
+#include "string.h"
+#include "output.h"
+#include "background_output.h"
+
+
+static constexpr umm BACKGROUND_OUTPUT_MIN_BUFFER_SIZE = 4 * 1024;
+
+
+
+// A side with nothing to do checks the counters again under idle_mutex before
+// it sleeps. Taking the mutex before notifying means the other side is then
+// either still before that check, and sees the new counter, or already
+// asleep, and gets woken. Only one side can be asleep at a time: the parser
+// only waits when every buffer is full, and then the writer has work.
+static void notify_other_side(Background_File_Sink* sink)
+{
+    {
+        std::lock_guard<std::mutex> lock(sink->idle_mutex);
+    }
+    sink->changed.notify_one();
+}
+
+static void run_background_writer(Background_File_Sink* sink)
+{
+    u64 written = sink->written.load(std::memory_order_relaxed);
+    while (true)
+    {
+        if (written < sink->filled.load(std::memory_order_acquire))
+        {
+            // After a failure the buffers are still taken, so the parser never waits forever.
+            Background_Output_Buffer* buffer = &sink->buffers[written % sink->buffer_count];
+            if (!sink->failed.load(std::memory_order_relaxed) && fwrite(buffer->data, 1, buffer->length, sink->file) != buffer->length)
+                sink->failed.store(true, std::memory_order_relaxed);
+
+            written++;
+            sink->written.store(written, std::memory_order_release);
+            notify_other_side(sink);
+            continue;
+        }
+
+        // The last buffer is handed over before closing is set, so this sees it.
+        if (sink->closing.load(std::memory_order_acquire) && written == sink->filled.load(std::memory_order_acquire))
+            break;
+
+        std::unique_lock<std::mutex> lock(sink->idle_mutex);
+        while (written == sink->filled.load(std::memory_order_acquire) && !sink->closing.load(std::memory_order_acquire))
+            sink->changed.wait(lock);
+    }
+}
+
+// Gives the current buffer to the writer, and waits for the next one to be free.
+static void hand_over_buffer(Background_File_Sink* sink)
+{
+    u64 filled = sink->filled.load(std::memory_order_relaxed) + 1;
+    sink->filled.store(filled, std::memory_order_release);
+    notify_other_side(sink);
+
+    if (filled - sink->written.load(std::memory_order_acquire) >= sink->buffer_count)
+    {
+        std::unique_lock<std::mutex> lock(sink->idle_mutex);
+        while (filled - sink->written.load(std::memory_order_acquire) >= sink->buffer_count)
+            sink->changed.wait(lock);
+    }
+
+    sink->current = &sink->buffers[filled % sink->buffer_count];
+    sink->current->length = 0;
+}
+
+static void background_sink_write(Output_Sink* output, String utf8)
+{
+    Background_File_Sink* sink = (Background_File_Sink*) output;
+
+    while (utf8)
+    {
+        Background_Output_Buffer* buffer = sink->current;
+        umm space = sink->buffer_size - buffer->length;
+        umm length = utf8.length < space ? utf8.length : space;
+        copy(buffer->data + buffer->length, utf8.data, length);
+        buffer->length += length;
+        consume(&utf8, length);
+
+        if (buffer->length == sink->buffer_size)
+            hand_over_buffer(sink);
+    }
+}
+
+
+bool open_background_file_sink(Background_File_Sink* sink, String path, umm buffer_size, u32 buffer_count)
+{
+    sink->sink = {};
+    sink->sink.write = background_sink_write;
+    sink->buffer_size = buffer_size < BACKGROUND_OUTPUT_MIN_BUFFER_SIZE ? BACKGROUND_OUTPUT_MIN_BUFFER_SIZE : buffer_size;
+    sink->buffer_count = buffer_count < 2 ? 2 : buffer_count;
+    sink->filled.store(0, std::memory_order_relaxed);
+    sink->written.store(0, std::memory_order_relaxed);
+    sink->closing.store(false, std::memory_order_relaxed);
+    sink->failed.store(false, std::memory_order_relaxed);
+
+    sink->file = fopen(make_c_style_string(path), "wb");
+    sink->buffers = (Background_Output_Buffer*) calloc(sink->buffer_count, sizeof(Background_Output_Buffer));
+    bool allocated = sink->buffers != NULL;
+    for (u32 i = 0; allocated && i < sink->buffer_count; i++)
+    {
+        sink->buffers[i].data = (u8*) malloc(sink->buffer_size);
+        allocated = sink->buffers[i].data != NULL;
+    }
+
+    if (!sink->file || !allocated)
+    {
+        if (sink->file)
+            fclose(sink->file);
+        for (u32 i = 0; sink->buffers && i < sink->buffer_count; i++)
+            free(sink->buffers[i].data);
+        free(sink->buffers);
+        sink->file = NULL;
+        sink->buffers = NULL;
+        return false;
+    }
+
+    // The writer does the buffering, stdio would only copy everything once more.
+    setvbuf(sink->file, NULL, _IONBF, 0);
+
+    sink->current = &sink->buffers[0];
+    sink->writer = std::thread(run_background_writer, sink);
+    return true;
+}
+
+bool close_background_file_sink(Background_File_Sink* sink)
+{
+    if (sink->current->length)
+        sink->filled.store(sink->filled.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    sink->closing.store(true, std::memory_order_release);
+    notify_other_side(sink);
+    sink->writer.join();
+
+    bool success = !sink->failed.load(std::memory_order_relaxed);
+    if (fclose(sink->file) != 0)
+        success = false;
+
+    for (u32 i = 0; i < sink->buffer_count; i++)
+        free(sink->buffers[i].data);
+    free(sink->buffers);
+    sink->file = NULL;
+    sink->buffers = NULL;
+    sink->current = NULL;
+    return success;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdio.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "typedef.h"
+#include "string.h"
+#include "output.h"
+
+
+
+//
+// Background file output.
+// The parser fills one fixed size buffer while a writer thread writes out
+// the ones before it, so parsing and write(2) overlap instead of taking
+// turns. Full buffers go to the writer, and empty ones come back, through a
+// ring with one producer and one consumer: each side only ever advances its
+// own counter, so handing a buffer over is a single atomic store. A side with
+// nothing to do sleeps on a condition variable until the other one moves.
+//
+
+
+constexpr umm BACKGROUND_OUTPUT_BUFFER_SIZE  = 1024 * 1024;
+constexpr u32 BACKGROUND_OUTPUT_BUFFER_COUNT = 2;
+
+struct Background_Output_Buffer
+{
+    u8* data;
+    umm length;
+};
+
+struct Background_File_Sink
+{
+    Output_Sink sink;
+    FILE* file;
+
+    Background_Output_Buffer* buffers;
+    u32 buffer_count;
+    umm buffer_size;
+    Background_Output_Buffer* current;     // Being filled, the writer never touches it.
+
+    alignas(64) std::atomic<u64> filled;   // Buffers handed to the writer so far, only the sink's thread changes it.
+    alignas(64) std::atomic<u64> written;  // Buffers the writer is done with, only the writer changes it.
+    std::atomic<bool> closing;
+    std::atomic<bool> failed;              // A write failed, close_background_file_sink returns false.
+    std::mutex idle_mutex;
+    std::condition_variable changed;       // Notified after filled, written or closing changes.
+    std::thread writer;
+};
+
+// At least 2 buffers are used, of at least 4 KB each.
+// Only one thread may write to the sink, the writer thread is the only other one that touches it.
+bool open_background_file_sink(Background_File_Sink* sink, String path,
+                               umm buffer_size = BACKGROUND_OUTPUT_BUFFER_SIZE, u32 buffer_count = BACKGROUND_OUTPUT_BUFFER_COUNT);
+
+// Writes out what's left, waits for the writer thread and closes the file.
+// Returns false if anything failed since the sink was opened.
+bool close_background_file_sink(Background_File_Sink* sink);
@@ -0,0 +1,773 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <cstring>
+
+#include "typedef.h"
+#include "macros.h"
+#include "memory.h"
+#include "string.h"
+#include "utf8.h"
+#include "parser.h"
+#include "document_ir.h"
+#include "file_io.h"
+#include "background_output.h"
+#include "benchmark.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define BENCHMARK_SSE2 1
+#include <emmintrin.h>
+#endif
+
+
+
+static f64 get_time_in_seconds()
+{
+#ifdef _WIN32
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (f64) counter.QuadPart / (f64) frequency.QuadPart;
+#else
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (f64) time.tv_sec + (f64) time.tv_nsec * 1e-9;
+#endif
+}
+
+// Repeats until at least 'min_seconds' have passed, returns seconds per run.
+#define BenchmarkLoop(min_seconds, seconds_per_run, code)                   \
+{                                                                           \
+    u32 runs = 0;                                                           \
+    f64 start = get_time_in_seconds();                                      \
+    f64 elapsed;                                                            \
+    do                                                                      \
+    {                                                                       \
+        code;                                                               \
+        runs++;                                                             \
+        elapsed = get_time_in_seconds() - start;                            \
+    } while (elapsed < (min_seconds));                                      \
+    seconds_per_run = elapsed / runs;                                       \
+}
+
+static void print_throughput(const char* name, umm bytes, f64 seconds)
+{
+    printf("  %-40s %10.3f ms  %8.3f GB/s\n", name, seconds * 1e3, (f64) bytes / seconds / 1e9);
+}
+
+
+
+//
+// UTF-16 output.
+//
+
+
+void benchmark_utf16(String input)
+{
+    printf("UTF-16 benchmark, %llu bytes of input\n", (unsigned long long) input.length);
+
+    LK_Region_Cursor cursor;
+    lk_region_cursor(temp, &cursor);
+
+    // Check that both routines agree before timing them.
+    String16 reference = convert_utf8_to_utf16(input);
+    u16* target = (u16*) malloc((input.length + 1) * sizeof(u16));
+    umm target_length = transcode_utf8_to_utf16(target, input);
+    if (target_length != reference.length || !compare(target, reference.data, target_length * sizeof(u16)))
+        printf("  MISMATCH between convert_utf8_to_utf16 and transcode_utf8_to_utf16!\n");
+    lk_region_rewind(temp, &cursor);
+
+    f64 seconds;
+
+    BenchmarkLoop(0.5, seconds,
+    {
+        convert_utf8_to_utf16(input);
+        lk_region_rewind(temp, &cursor);
+    });
+    print_throughput("convert_utf8_to_utf16 (two pass)", input.length, seconds);
+
+    BenchmarkLoop(0.5, seconds, transcode_utf8_to_utf16(target, input));
+    print_throughput("transcode_utf8_to_utf16", input.length, seconds);
+
+    free(target);
+
+    // End to end, the way the host used to do it and the way it does it now.
+    BenchmarkLoop(0.5, seconds,
+    {
+        String html = parse(input);
+        convert_utf8_to_utf16(html);
+        free(html.data);
+        lk_region_rewind(temp, &cursor);
+    });
+    print_throughput("parse + convert_utf8_to_utf16", input.length, seconds);
+
+    BenchmarkLoop(0.5, seconds,
+    {
+        String16 html = parse_to_utf16(input);
+        free(html.data);
+        lk_region_rewind(temp, &cursor);
+    });
+    print_throughput("parse_to_utf16", input.length, seconds);
+}
+
+
+
+//
+// Binary document IR.
+//
+
+
+static void null_sink_write(Output_Sink* sink, String utf8) {}
+
+void benchmark_document_ir(String input)
+{
+    printf("Document IR benchmark, %llu bytes of input\n", (unsigned long long) input.length);
+
+    Output_Sink null_sink = { null_sink_write };
+
+    // The IR stays in the region, everything after it is rewound between runs.
+    Parse_Result result;
+    parse(input, &null_sink, NULL, &result);
+    String ir_data = serialize_document_ir(input, &result);
+
+    LK_Region_Cursor cursor;
+    lk_region_cursor(temp, &cursor);
+
+    printf("  %llu bytes of IR\n", (unsigned long long) ir_data.length);
+
+    // Check that rendering from the IR gives the same output.
+    String html = parse(input);
+    UTF8_Sink ir_sink;
+    init_utf8_sink(&ir_sink);
+    Document_IR ir;
+    if (!open_document_ir(&ir, ir_data, input) || !render_document_ir(&ir, &ir_sink.sink) || ir_sink.builder.string != html)
+        printf("  MISMATCH between parse and render_document_ir!\n");
+    free(html.data);
+    free_string_builder(&ir_sink.builder);
+    lk_region_rewind(temp, &cursor);
+
+    f64 seconds;
+
+    BenchmarkLoop(0.5, seconds,
+    {
+        parse(input, &null_sink);
+        lk_region_rewind(temp, &cursor);
+    });
+    print_throughput("parse", input.length, seconds);
+
+    BenchmarkLoop(0.5, seconds,
+    {
+        Document_IR ir;
+        open_document_ir(&ir, ir_data, input);
+        render_document_ir(&ir, &null_sink);
+    });
+    print_throughput("open_document_ir + render_document_ir", input.length, seconds);
+
+    // Loading alone, without producing any output.
+    volatile umm token_count = 0;
+    BenchmarkLoop(0.5, seconds,
+    {
+        Document_IR ir;
+        open_document_ir(&ir, ir_data, input);
+        Labeled_String token;
+        while (next_ir_token(&ir, &token))
+            token_count++;
+    });
+    print_throughput("open_document_ir + next_ir_token", input.length, seconds);
+
+    volatile bool matches = false;
+    BenchmarkLoop(0.5, seconds,
+    {
+        Document_IR ir;
+        open_document_ir(&ir, ir_data, input);
+        matches = ir_matches_input(&ir);
+    });
+    print_throughput("open_document_ir + ir_matches_input", input.length, seconds);
+}
+
+
+
+//
+// Background output.
+// The same document parsed into the same file, first the way main does it
+// without --out, then with the parser and the writes overlapping.
+//
+
+
+void benchmark_background_output(String input, String output_path)
+{
+    printf("Background output benchmark, %llu bytes of input\n", (unsigned long long) input.length);
+
+    LK_Region_Cursor cursor;
+    lk_region_cursor(temp, &cursor);
+
+    f64 seconds;
+    bool failed = false;
+
+    BenchmarkLoop(0.5, seconds,
+    {
+        UTF8_Sink sink;
+        init_utf8_sink(&sink);
+        parse(input, &sink.sink);
+        failed |= !write_entire_file(output_path, sink.builder.string);
+        free_string_builder(&sink.builder);
+        lk_region_rewind(temp, &cursor);
+    });
+    print_throughput("parse to memory + write_entire_file", input.length, seconds);
+
+    struct { umm buffer_size; u32 buffer_count; } configurations[] =
+    {
+        { 64 * 1024, 2 },
+        { 1024 * 1024, 2 },
+        { 1024 * 1024, 4 },
+        { 4 * 1024 * 1024, 4 },
+    };
+
+    for (umm i = 0; i < ArrayCount(configurations); i++)
+    {
+        umm buffer_size = configurations[i].buffer_size;
+        u32 buffer_count = configurations[i].buffer_count;
+
+        BenchmarkLoop(0.5, seconds,
+        {
+            Background_File_Sink sink;
+            if (open_background_file_sink(&sink, output_path, buffer_size, buffer_count))
+            {
+                parse(input, &sink.sink);
+                failed |= !close_background_file_sink(&sink);
+            }
+            else
+            {
+                failed = true;
+            }
+            lk_region_rewind(temp, &cursor);
+        });
+
+        char name[64];
+        snprintf(name, sizeof(name), "background writer, %u x %llu KB", buffer_count, (unsigned long long)(buffer_size / 1024));
+        print_throughput(name, input.length, seconds);
+    }
+
+    if (failed)
+        printf("  Writing %.*s failed!\n", StringArgs(output_path));
+    remove(make_c_style_string(output_path));
+}
+
+
+
+//
+// Scaling on hostile input.
+// Every case generates input of doubling sizes and times parse on it. Work
+// per byte has to stay flat, if the time grows much faster than the input
+// some path in the parser is superlinear, and user content can stall it.
+//
+
+
+static void append_repeated(String_Builder* builder, String string, umm count)
+{
+    for (umm i = 0; i < count; i++)
+        append(builder, string);
+}
+
+// Every line one level deeper than the one before, then back to the top.
+static void generate_deep_list(String_Builder* builder, umm size)
+{
+    for (umm depth = 0; builder->string.length < size; depth++)
+    {
+        append_repeated(builder, "    "_s, depth);
+        append(builder, "- x\n"_s);
+    }
+    append(builder, "- x\n"_s);
+}
+
+// Climbs 64 levels and drops back to the top, over and over.
+static void generate_sawtooth_list(String_Builder* builder, umm size)
+{
+    for (umm line = 0; builder->string.length < size; line++)
+    {
+        append_repeated(builder, "    "_s, line % 64);
+        append(builder, "- x\n"_s);
+    }
+}
+
+static void generate_blank_lines(String_Builder* builder, umm size)
+{
+    append(builder, "x\n"_s);
+    append_repeated(builder, "\n"_s, size);
+}
+
+static void generate_long_line(String_Builder* builder, umm size)
+{
+    append_repeated(builder, "x"_s, size);
+}
+
+static void generate_long_header(String_Builder* builder, umm size)
+{
+    append_repeated(builder, "#"_s, size);
+}
+
+static void generate_long_indent(String_Builder* builder, umm size)
+{
+    append(builder, "- x\n"_s);
+    append_repeated(builder, " "_s, size);
+    append(builder, "- x\n"_s);
+}
+
+static void generate_duplicate_headers(String_Builder* builder, umm size)
+{
+    while (builder->string.length < size)
+        append(builder, "# x\n"_s);
+}
+
+static void generate_code_fences(String_Builder* builder, umm size)
+{
+    while (builder->string.length < size)
+        append(builder, "```\n"_s);
+}
+
+static void generate_unclosed_fence(String_Builder* builder, umm size)
+{
+    append(builder, "````\n"_s);
+    while (builder->string.length < size)
+        append(builder, "```\n   ``\n"_s);
+}
+
+static void generate_indented_code(String_Builder* builder, umm size)
+{
+    while (builder->string.length < size)
+        append(builder, "    x\n\n"_s);
+}
+
+// Every paragraph defines a label and links to the one before, so the map keeps growing.
+static void generate_reference_links(String_Builder* builder, umm size)
+{
+    for (u32 i = 0; builder->string.length < size; i++)
+    {
+        char line[96];
+        int length = snprintf(line, sizeof(line), "[label %u]: /%u\n\nsee [label %u] and [this][Label %u]\n\n", i, i, i ? i - 1 : 0, i);
+        append(builder, line, (umm) length);
+    }
+}
+
+// Brackets that never close, with a definition, so every one of them is looked at.
+static void generate_unclosed_brackets(String_Builder* builder, umm size)
+{
+    append(builder, "[a]: /a\n\n"_s);
+    while (builder->string.length < size)
+        append(builder, "[a [[ a][ "_s);
+}
+
+// One table that never ends.
+static void generate_table_rows(String_Builder* builder, umm size)
+{
+    append(builder, "| a | b | c |\n|:--|:-:|--:|\n"_s);
+    while (builder->string.length < size)
+        append(builder, "| x | y \\| z | w |\n"_s);
+}
+
+// A single row that is nothing but escaped pipes.
+static void generate_escaped_pipes(String_Builder* builder, umm size)
+{
+    append(builder, "a | b\n--- | ---\n"_s);
+    append_repeated(builder, "\\|"_s, size / 2);
+    append(builder, " | x\n"_s);
+}
+
+// Almost autolinks, each one ends where the next one starts.
+static void generate_autolink_triggers(String_Builder* builder, umm size)
+{
+    while (builder->string.length < size)
+        append(builder, "www._a@b_http://_"_s);
+}
+
+struct Scaling_Case
+{
+    const char* name;
+    void (*generate)(String_Builder* builder, umm size);
+};
+
+static const Scaling_Case scaling_cases[] =
+{
+    { "deep list",          generate_deep_list },
+    { "sawtooth list",      generate_sawtooth_list },
+    { "blank lines",        generate_blank_lines },
+    { "one long line",      generate_long_line },
+    { "one long header",    generate_long_header },
+    { "one long indent",    generate_long_indent },
+    { "duplicate headers",  generate_duplicate_headers },
+    { "code fences",        generate_code_fences },
+    { "unclosed fence",     generate_unclosed_fence },
+    { "indented code",      generate_indented_code },
+    { "reference links",    generate_reference_links },
+    { "unclosed brackets",  generate_unclosed_brackets },
+    { "table rows",         generate_table_rows },
+    { "escaped pipes",      generate_escaped_pipes },
+    { "autolink triggers",  generate_autolink_triggers },
+};
+
+
+bool benchmark_scaling(umm max_size)
+{
+    printf("Scaling benchmark, up to %llu bytes of input\n", (unsigned long long) max_size);
+
+    Output_Sink null_sink = { null_sink_write };
+
+    LK_Region_Cursor cursor;
+    lk_region_cursor(temp, &cursor);
+
+    // Time per byte may not grow with the input. There is some slack for timer
+    // noise and for caches running out on the larger sizes, a quadratic path
+    // is 64 times slower per byte at the largest size than at the smallest.
+    // Small runs are a quick check for the tests, their sizes span 16 times
+    // instead of 32, and each one is timed for less.
+    const f64 max_slowdown = 4.0;
+    const umm min_size = max_size / 32 > 64 * 1024 ? max_size / 32 : 64 * 1024;
+    const f64 min_seconds = max_size < 32 * 1024 * 1024 ? 0.05 : 0.2;
+
+    bool all_linear = true;
+    for (umm i = 0; i < ArrayCount(scaling_cases); i++)
+    {
+        const Scaling_Case* scaling_case = &scaling_cases[i];
+        printf("  %s\n", scaling_case->name);
+
+        f64 first_seconds_per_byte = 0;
+        f64 previous_seconds = 0;
+        for (umm size = min_size; size <= max_size; size *= 2)
+        {
+            String_Builder builder = {};
+            scaling_case->generate(&builder, size);
+            String input = builder.string;
+
+            f64 seconds;
+            BenchmarkLoop(min_seconds, seconds,
+            {
+                parse(input, &null_sink);
+                lk_region_rewind(temp, &cursor);
+            });
+
+            f64 seconds_per_byte = seconds / input.length;
+            if (!first_seconds_per_byte)
+                first_seconds_per_byte = seconds_per_byte;
+
+            bool linear = seconds_per_byte <= first_seconds_per_byte * max_slowdown;
+            all_linear &= linear;
+
+            printf("    %10llu bytes  %10.3f ms  %6.2f ns/byte", (unsigned long long) input.length, seconds * 1e3, seconds_per_byte * 1e9);
+            if (previous_seconds)
+                printf("  x%.2f", seconds / previous_seconds);
+            printf("%s\n", linear ? "" : "  SUPERLINEAR");
+            previous_seconds = seconds;
+
+            free_string_builder(&builder);
+        }
+    }
+
+    printf(all_linear ? "All cases scale linearly.\n" : "Some cases are superlinear!\n");
+    return all_linear;
+}
+
+
+
+//
+// String primitives.
+// Every primitive in string.cpp that the parser leans on, next to the libc
+// function (or a small SSE2 loop, where libc has nothing equivalent) that does
+// the same job. Both get identical input at each size, once with buffers
+// aligned to 64 bytes and once shifted off it, and both have to give the same
+// result before they are timed.
+//
+
+
+static constexpr umm PRIMITIVE_MIN_SIZE = 8;
+static constexpr umm PRIMITIVE_ALIGNMENT = 64;
+static constexpr umm PRIMITIVE_SLACK = 2 * PRIMITIVE_ALIGNMENT;  // Room for offsets, move's overlap and the terminator.
+
+// Small sizes are called this many bytes' worth of times per clock read,
+// so the clock doesn't swamp them.
+static constexpr umm PRIMITIVE_BATCH_BYTES = 64 * 1024;
+
+
+// Runs of letters, no whitespace, line endings or zeros.
+static void fill_text(u8* data, umm size)
+{
+    for (umm i = 0; i < size; i++)
+        data[i] = 'a' + (u8)(i % 26);
+    data[size] = 0;
+}
+
+// Letters with the character searched for in the last byte, so everything is scanned.
+static void fill_text_newline_last(u8* data, umm size)
+{
+    fill_text(data, size);
+    data[size - 1] = '\n';
+}
+
+static void fill_whitespace(u8* data, umm size)
+{
+    for (umm i = 0; i < size; i++)
+        data[i] = (i % 8 == 7) ? '\t' : ' ';
+    data[size - 1] = 'x';
+    data[size] = 0;
+}
+
+// Lines of 64 bytes, the last one without an ending.
+static void fill_lines(u8* data, umm size)
+{
+    fill_text(data, size);
+    for (umm i = 63; i < size; i += 64)
+        data[i] = '\n';
+}
+
+// Words of 8 bytes separated by single spaces.
+static void fill_words(u8* data, umm size)
+{
+    fill_text(data, size);
+    for (umm i = 8; i < size; i += 9)
+        data[i] = ' ';
+}
+
+
+static umm primitive_copy(u8* to, u8* from, umm size)     { copy(to, from, size); return to[size - 1]; }
+static umm primitive_memcpy(u8* to, u8* from, umm size)   { memcpy(to, from, size); return to[size - 1]; }
+
+// Forward over an overlapping range, the way String_Builder's remove moves its tail.
+static umm primitive_move(u8* to, u8* from, umm size)     { move(to, to + 8, size); return to[0]; }
+static umm primitive_memmove(u8* to, u8* from, umm size)  { memmove(to, to + 8, size); return to[0]; }
+
+static umm primitive_compare(u8* to, u8* from, umm size)  { return compare(to, from, size); }
+static umm primitive_memcmp(u8* to, u8* from, umm size)   { return memcmp(to, from, size) == 0; }
+
+static umm primitive_find_byte(u8* to, u8* from, umm size)
+{
+    return find_first_occurance({ size, from }, '\n');
+}
+
+static umm primitive_memchr(u8* to, u8* from, umm size)
+{
+    u8* found = (u8*) memchr(from, '\n', size);
+    return found ? (umm)(found - from) : NOT_FOUND;
+}
+
+static umm primitive_find_any(u8* to, u8* from, umm size)
+{
+    return find_first_occurance_of_any({ size, from }, "\n\r"_s);
+}
+
+// What find_first_occurance_of_any(string, "\n\r") does with 16 bytes at a time.
+static umm primitive_find_line_ending(u8* to, u8* from, umm size)
+{
+    umm i = 0;
+#if BENCHMARK_SSE2
+    __m128i newline = _mm_set1_epi8('\n');
+    __m128i carriage_return = _mm_set1_epi8('\r');
+    for (; i + 16 <= size; i += 16)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i*)(from + i));
+        __m128i matches = _mm_or_si128(_mm_cmpeq_epi8(block, newline), _mm_cmpeq_epi8(block, carriage_return));
+        int mask = _mm_movemask_epi8(matches);
+        if (mask)
+        {
+            umm bit = 0;
+            while (!(mask & (1 << bit)))
+                bit++;
+            return i + bit;
+        }
+    }
+#endif
+    for (; i < size; i++)
+        if (from[i] == '\n' || from[i] == '\r')
+            return i;
+    return NOT_FOUND;
+}
+
+static umm primitive_length(u8* to, u8* from, umm size)   { return length_of_c_style_string((const char*) from); }
+static umm primitive_strlen(u8* to, u8* from, umm size)   { return strlen((const char*) from); }
+
+static umm primitive_trim(u8* to, u8* from, umm size)
+{
+    String trimmed = trim({ size, from });
+    return (umm)(trimmed.data - from);
+}
+
+static umm primitive_strspn(u8* to, u8* from, umm size)   { return strspn((const char*) from, " \t\n\r"); }
+
+static umm primitive_consume_whitespace(u8* to, u8* from, umm size)
+{
+    String string = { size, from };
+    consume_whitespace(&string);
+    return size - string.length;
+}
+
+static umm primitive_consume_lines(u8* to, u8* from, umm size)
+{
+    String string = { size, from };
+    umm lines = 0;
+    while (string)
+    {
+        consume_line_preserve_whitespace(&string);
+        lines++;
+    }
+    return lines;
+}
+
+static umm primitive_memchr_lines(u8* to, u8* from, umm size)
+{
+    u8* at = from;
+    u8* end = from + size;
+    umm lines = 0;
+    while (at < end)
+    {
+        u8* newline = (u8*) memchr(at, '\n', end - at);
+        at = newline ? newline + 1 : end;
+        lines++;
+    }
+    return lines;
+}
+
+static umm primitive_consume_words(u8* to, u8* from, umm size)
+{
+    String string = { size, from };
+    umm words = 0;
+    while (string)
+    {
+        consume_until_whitespace(&string);
+        words++;
+    }
+    return words;
+}
+
+static umm primitive_strcspn_words(u8* to, u8* from, umm size)
+{
+    const char* at = (const char*) from;
+    const char* end = at + size;
+    umm words = 0;
+    while (at < end)
+    {
+        at += strspn(at, " \t\n\r");
+        at += strcspn(at, " \t\n\r");
+        words++;
+    }
+    return words;
+}
+
+struct Primitive_Case
+{
+    const char* name;
+    const char* reference_name;
+    void (*fill)(u8* from, umm size);
+    umm (*ours)(u8* to, u8* from, umm size);
+    umm (*reference)(u8* to, u8* from, umm size);
+};
+
+static const Primitive_Case primitive_cases[] =
+{
+    { "copy",                              "memcpy",       fill_text,              primitive_copy,               primitive_memcpy },
+    { "move",                              "memmove",      fill_text,              primitive_move,               primitive_memmove },
+    { "compare",                           "memcmp",       fill_text,              primitive_compare,            primitive_memcmp },
+    { "find_first_occurance",              "memchr",       fill_text_newline_last, primitive_find_byte,          primitive_memchr },
+    { "find_first_occurance_of_any",       "SSE2",         fill_text_newline_last, primitive_find_any,           primitive_find_line_ending },
+    { "length_of_c_style_string",          "strlen",       fill_text,              primitive_length,             primitive_strlen },
+    { "trim",                              "strspn",       fill_whitespace,        primitive_trim,               primitive_strspn },
+    { "consume_whitespace",                "strspn",       fill_whitespace,        primitive_consume_whitespace, primitive_strspn },
+    { "consume_line_preserve_whitespace",  "memchr",       fill_lines,             primitive_consume_lines,      primitive_memchr_lines },
+    { "consume_until_whitespace",          "strcspn",      fill_words,             primitive_consume_words,      primitive_strcspn_words },
+};
+
+
+static f64 time_primitive(umm (*primitive)(u8* to, u8* from, umm size), u8* to, u8* from, umm size)
+{
+    umm batch = size < PRIMITIVE_BATCH_BYTES ? PRIMITIVE_BATCH_BYTES / size : 1;
+    volatile umm result = 0;
+
+    f64 seconds;
+    BenchmarkLoop(0.02, seconds,
+    {
+        for (umm i = 0; i < batch; i++)
+            result = primitive(to, from, size);
+    });
+    return seconds / batch;
+}
+
+static void print_primitive_size(umm size)
+{
+    if (size >= 1024 * 1024)
+        printf("    %7llu MB", (unsigned long long)(size / (1024 * 1024)));
+    else if (size >= 1024)
+        printf("    %7llu KB", (unsigned long long)(size / 1024));
+    else
+        printf("    %7llu  B", (unsigned long long) size);
+}
+
+
+void benchmark_string_primitives(umm max_size)
+{
+    printf("String primitives benchmark, %llu to %llu bytes, GB/s\n",
+        (unsigned long long) PRIMITIVE_MIN_SIZE, (unsigned long long) max_size);
+
+    // Aligned to 64 bytes by hand, malloc only promises 16.
+    u8* from_memory = (u8*) malloc(max_size + 2 * PRIMITIVE_SLACK);
+    u8* to_memory   = (u8*) malloc(max_size + 2 * PRIMITIVE_SLACK);
+    if (!from_memory || !to_memory)
+    {
+        printf("  Not enough memory for %llu bytes\n", (unsigned long long) max_size);
+        free(from_memory);
+        free(to_memory);
+        return;
+    }
+    u8* from_aligned = (u8*)(((umm) from_memory + PRIMITIVE_ALIGNMENT - 1) & ~(PRIMITIVE_ALIGNMENT - 1));
+    u8* to_aligned   = (u8*)(((umm) to_memory   + PRIMITIVE_ALIGNMENT - 1) & ~(PRIMITIVE_ALIGNMENT - 1));
+
+    // The two buffers are off by a different amount, so they aren't aligned to each other either.
+    struct { const char* name; umm from_offset; umm to_offset; } alignments[] =
+    {
+        { "aligned",   0, 0 },
+        { "unaligned", 1, 3 },
+    };
+
+    for (umm i = 0; i < ArrayCount(primitive_cases); i++)
+    {
+        const Primitive_Case* primitive_case = &primitive_cases[i];
+        printf("  %s vs %s\n", primitive_case->name, primitive_case->reference_name);
+        printf("    %10s  %-26s  %-26s\n", "", "aligned", "unaligned");
+        printf("    %10s  %8s %8s  %-7s  %8s %8s  %-7s\n", "", "ours", "theirs", "slower", "ours", "theirs", "slower");
+
+        for (umm size = PRIMITIVE_MIN_SIZE; size <= max_size; size *= 8)
+        {
+            print_primitive_size(size);
+            for (umm a = 0; a < ArrayCount(alignments); a++)
+            {
+                u8* from = from_aligned + alignments[a].from_offset;
+                u8* to   = to_aligned   + alignments[a].to_offset;
+                // 'to' gets the same content, compare looks at equal buffers and move reads 8 bytes past 'size'.
+                primitive_case->fill(from, size);
+                primitive_case->fill(to, size + 8);
+                umm our_result = primitive_case->ours(to, from, size);
+                primitive_case->fill(to, size + 8);
+                if (our_result != primitive_case->reference(to, from, size))
+                {
+                    printf("  %-26s", "MISMATCH");
+                    continue;
+                }
+
+                f64 ours = time_primitive(primitive_case->ours, to, from, size);
+                f64 reference = time_primitive(primitive_case->reference, to, from, size);
+                printf("  %8.2f %8.2f  x%-6.1f", (f64) size / ours / 1e9, (f64) size / reference / 1e9, ours / reference);
+            }
+            printf("\n");
+
+            // Always end on the largest size, even when it isn't a power of 8.
+            if (size < max_size && size * 8 > max_size)
+                size = max_size / 8;
+        }
+    }
+
+    free(from_memory);
+    free(to_memory);
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "string.h"
+
+// All benchmarks print their results to stdout.
+void benchmark_utf16(String input);
+
+void benchmark_document_ir(String input);
+
+// Parses 'input' into a file at 'output_path', through memory and write_entire_file
+// and then through background writers with different buffers. The file is removed after.
+void benchmark_background_output(String input, String output_path);
+
+// Parses generated hostile input of doubling sizes, up to 'max_size' bytes.
+// Below 32 MB it is a quicker and rougher check, small enough to run with the tests.
+// Returns false if the parse time of any case grows faster than its input.
+bool benchmark_scaling(umm max_size);
+
+// Times the string.cpp primitives against libc, at sizes from 8 bytes up to 'max_size'.
+void benchmark_string_primitives(umm max_size);
@@ -0,0 +1,412 @@
+#pragma once
+
+#include "typedef.h"
+#include "macros.h"
+#include "memory.h"
+#include "string.h"
+#include "list.h"
+#include "hash_table.h"
+#include "parser.h"
+#include "document_ir.h"
+
+
+static constexpr umm IR_HEADER_SIZE  = 40;
+static constexpr umm IR_REFERENCE_SIZE = 16;
+static constexpr umm IR_HEADING_SIZE = 2 * IR_REFERENCE_SIZE;
+static constexpr umm IR_LINK_SIZE = 3 * IR_REFERENCE_SIZE;
+static constexpr umm IR_TOKEN_SIZE = 16;
+static constexpr umm IR_BLOCK_SIZE = 32;
+
+
+
+//
+// Writing.
+//
+
+
+static bool is_inside(String outer, String inner)
+{
+    return inner.data >= outer.data && inner.data + inner.length <= outer.data + outer.length;
+}
+
+
+struct IR_Writer
+{
+    String input;
+    String pool;               // Space left in the pool, empty when only measuring.
+    umm pool_length;
+    String_Map<u32> pooled;    // String -> offset in the pool, tags repeat a lot.
+    bool out_of_memory;        // The pooled map couldn't grow.
+};
+
+// Strings that aren't slices of the input go to the pool, once per distinct string.
+// When only measuring, the pool isn't written, just sized.
+static void locate_ir_string(IR_Writer* writer, bool measuring, String string, u16* location, u64* offset)
+{
+    if (is_inside(writer->input, string))
+    {
+        *location = IR_IN_INPUT;
+        *offset = string.data - writer->input.data;
+    }
+    else
+    {
+        *location = IR_IN_POOL;
+
+        u32* pooled_offset = writer->pooled.find(string);
+        if (pooled_offset)
+        {
+            *offset = *pooled_offset;
+        }
+        else
+        {
+            *offset = writer->pool_length;
+            if (!writer->pooled.insert(string, (u32) *offset))
+                writer->out_of_memory = true;
+            writer->pool_length += string.length;
+
+            if (!measuring)
+                write_bytes(&writer->pool, string.data, string.length);
+        }
+    }
+
+    DebugAssert(string.length <= U32_MAX);
+}
+
+// With a NULL table this only measures how large the pool has to be.
+static void write_ir_reference(String* table, IR_Writer* writer, u16 tag, String string)
+{
+    u16 location;
+    u64 offset;
+    locate_ir_string(writer, !table, string, &location, &offset);
+
+    if (!table)
+        return;
+
+    write_u16le(table, tag);
+    write_u16le(table, location);
+    write_u32le(table, (u32) string.length);
+    write_u64le(table, offset);
+}
+
+static void write_ir_token(String* table, IR_Writer* writer, Labeled_String token)
+{
+    u16 location;
+    u64 offset;
+    locate_ir_string(writer, !table, token.value, &location, &offset);
+
+    if (!table)
+        return;
+
+    write_u8(table, token.type);
+    write_u8(table, token.block);
+    write_u8(table, token.detail);
+    write_u8(table, (u8) location);
+    write_u32le(table, (u32) token.value.length);
+    write_u64le(table, offset);
+}
+
+static void write_ir_source_position(String* table, Source_Position position)
+{
+    write_u64le(table, position.offset);
+    write_u32le(table, position.line);
+    write_u32le(table, position.column);
+}
+
+
+String serialize_document_ir(String input, Parse_Result* result)
+{
+    u32 token_count = 0;
+    for (auto* node = result->tokens.head; node != NULL; node = node->next)
+        token_count++;
+
+    u32 heading_count = 0;
+    for (auto* node = result->outline.head; node != NULL; node = node->next)
+        heading_count++;
+
+    u32 link_count = (u32) result->links.count;
+
+    u32 block_count = 0;
+    for (auto* node = result->blocks.head; node != NULL; node = node->next)
+        block_count++;
+
+    // First pass only sizes the pool.
+    IR_Writer measure = {};
+    measure.input = input;
+    for (auto* node = result->tokens.head; node != NULL; node = node->next)
+        write_ir_token(NULL, &measure, node->value);
+    for (auto* node = result->outline.head; node != NULL; node = node->next)
+    {
+        write_ir_reference(NULL, &measure, 0, node->value.text);
+        write_ir_reference(NULL, &measure, 0, node->value.slug);
+    }
+    for (umm i = 0; i < result->links.capacity; i++)
+    {
+        if (!result->links.slots[i].occupied)
+            continue;
+        write_ir_reference(NULL, &measure, 0, result->links.slots[i].key);
+        write_ir_reference(NULL, &measure, 0, result->links.slots[i].value.url);
+        write_ir_reference(NULL, &measure, 0, result->links.slots[i].value.title);
+    }
+    umm pool_length = measure.pool_length;
+    DebugAssert(pool_length <= U32_MAX);
+
+    umm tokens_size   = (umm) token_count * IR_TOKEN_SIZE;
+    umm headings_size = (umm) heading_count * IR_HEADING_SIZE;
+    umm links_size    = (umm) link_count * IR_LINK_SIZE;
+    umm blocks_size   = (umm) block_count * IR_BLOCK_SIZE;
+
+    String ir;
+    ir.length = IR_HEADER_SIZE + tokens_size + headings_size + links_size + blocks_size + pool_length;
+    ir.data = LK_RegionArray(temp, u8, ir.length);
+    if (measure.out_of_memory || !ir.data)
+        return {};
+
+    String header = substring(ir, 0, IR_HEADER_SIZE);
+    write_u32le(&header, DOCUMENT_IR_MAGIC);
+    write_u32le(&header, DOCUMENT_IR_VERSION);
+    write_u64le(&header, input.length);
+    write_u32le(&header, compute_crc32(input));
+    write_u32le(&header, token_count);
+    write_u32le(&header, heading_count);
+    write_u32le(&header, (u32) pool_length);
+    write_u32le(&header, link_count);
+    write_u32le(&header, block_count);
+
+    String tokens   = substring(ir, IR_HEADER_SIZE, tokens_size);
+    String headings = substring(ir, IR_HEADER_SIZE + tokens_size, headings_size);
+    String links    = substring(ir, IR_HEADER_SIZE + tokens_size + headings_size, links_size);
+    String blocks   = substring(ir, IR_HEADER_SIZE + tokens_size + headings_size + links_size, blocks_size);
+
+    IR_Writer writer = {};
+    writer.input = input;
+    writer.pool = substring(ir, IR_HEADER_SIZE + tokens_size + headings_size + links_size + blocks_size, pool_length);
+
+    for (auto* node = result->tokens.head; node != NULL; node = node->next)
+        write_ir_token(&tokens, &writer, node->value);
+
+    for (auto* node = result->outline.head; node != NULL; node = node->next)
+    {
+        write_ir_reference(&headings, &writer, (u16) node->value.level, node->value.text);
+        write_ir_reference(&headings, &writer, 0, node->value.slug);
+    }
+
+    for (umm i = 0; i < result->links.capacity; i++)
+    {
+        if (!result->links.slots[i].occupied)
+            continue;
+        write_ir_reference(&links, &writer, 0, result->links.slots[i].key);
+        write_ir_reference(&links, &writer, 0, result->links.slots[i].value.url);
+        write_ir_reference(&links, &writer, 0, result->links.slots[i].value.title);
+    }
+
+    for (auto* node = result->blocks.head; node != NULL; node = node->next)
+    {
+        write_ir_source_position(&blocks, node->value.begin);
+        write_ir_source_position(&blocks, node->value.end);
+    }
+
+    // Without the map, a string the measuring pass pooled once could be pooled twice.
+    if (writer.out_of_memory)
+        return {};
+
+    DebugAssert(!tokens && !headings && !links && !blocks && !writer.pool);
+    return ir;
+}
+
+
+
+//
+// Reading.
+//
+
+
+bool open_document_ir(Document_IR* ir, String data, String input)
+{
+    ZeroStruct(ir);
+
+    u32 magic, version, token_count, heading_count, pool_length, link_count, block_count;
+    u64 input_length;
+
+    String header = data;
+    if (!read_u32le(&header, &magic))         return false;
+    if (!read_u32le(&header, &version))       return false;
+    if (!read_u64le(&header, &input_length))  return false;
+    if (!read_u32le(&header, &ir->input_crc32)) return false;
+    if (!read_u32le(&header, &token_count))   return false;
+    if (!read_u32le(&header, &heading_count)) return false;
+    if (!read_u32le(&header, &pool_length))   return false;
+    if (!read_u32le(&header, &link_count))    return false;
+    if (!read_u32le(&header, &block_count))   return false;
+
+    if (magic != DOCUMENT_IR_MAGIC)     return false;
+    if (version != DOCUMENT_IR_VERSION) return false;
+    if (input_length != input.length)   return false;
+
+    umm tokens_size   = (umm) token_count * IR_TOKEN_SIZE;
+    umm headings_size = (umm) heading_count * IR_HEADING_SIZE;
+    umm links_size    = (umm) link_count * IR_LINK_SIZE;
+    umm blocks_size   = (umm) block_count * IR_BLOCK_SIZE;
+    if (data.length != IR_HEADER_SIZE + tokens_size + headings_size + links_size + blocks_size + pool_length)
+        return false;
+
+    ir->input = input;
+    ir->tokens   = substring(data, IR_HEADER_SIZE, tokens_size);
+    ir->headings = substring(data, IR_HEADER_SIZE + tokens_size, headings_size);
+    ir->links    = substring(data, IR_HEADER_SIZE + tokens_size + headings_size, links_size);
+    ir->blocks   = substring(data, IR_HEADER_SIZE + tokens_size + headings_size + links_size, blocks_size);
+    ir->pool     = substring(data, IR_HEADER_SIZE + tokens_size + headings_size + links_size + blocks_size, pool_length);
+    ir->token_count = token_count;
+    ir->heading_count = heading_count;
+    ir->link_count = link_count;
+    ir->block_count = block_count;
+    return true;
+}
+
+
+bool ir_matches_input(Document_IR* ir)
+{
+    return compute_crc32(ir->input) == ir->input_crc32;
+}
+
+
+static bool resolve_ir_string(Document_IR* ir, u16 location, u32 length, u64 offset, String* string)
+{
+    String source = (location == IR_IN_POOL) ? ir->pool : ir->input;
+    if (location > IR_IN_POOL || offset > source.length || length > source.length - offset)
+    {
+        ir->corrupt = true;
+        return false;
+    }
+
+    *string = substring(source, (umm) offset, length);
+    return true;
+}
+
+
+static bool read_ir_reference(Document_IR* ir, String* table, u16* tag, String* string)
+{
+    u16 location;
+    u32 length;
+    u64 offset;
+
+    if (!read_u16le(table, tag))       return false;
+    if (!read_u16le(table, &location)) return false;
+    if (!read_u32le(table, &length))   return false;
+    if (!read_u64le(table, &offset))   return false;
+
+    return resolve_ir_string(ir, location, length, offset, string);
+}
+
+
+bool next_ir_token(Document_IR* ir, Labeled_String* token)
+{
+    u8 type, block, detail, location;
+    u32 length;
+    u64 offset;
+
+    if (!read_u8(&ir->tokens, &type))       return false;
+    if (!read_u8(&ir->tokens, &block))      return false;
+    if (!read_u8(&ir->tokens, &detail))     return false;
+    if (!read_u8(&ir->tokens, &location))   return false;
+    if (!read_u32le(&ir->tokens, &length))  return false;
+    if (!read_u64le(&ir->tokens, &offset))  return false;
+
+    // The HTML of a block is written from its kind and detail, they index tables.
+    // The detail of anything else is a count at most, the indent of a code fence.
+    bool is_block = type == ST_BLOCK_OPEN || type == ST_BLOCK_CLOSE;
+    bool bad_detail = (block == BLOCK_HEADING) ? (detail < 1 || detail > 6) : (is_block && detail > TABLE_ALIGN_RIGHT);
+    if (type > ST_TABLE_CELL || block > BLOCK_TABLE_CELL || is_block != (block != BLOCK_NONE) || bad_detail)
+    {
+        ir->corrupt = true;
+        return false;
+    }
+
+    if (!resolve_ir_string(ir, location, length, offset, &token->value))
+        return false;
+
+    token->type = (String_Label) type;
+    token->block = (Block_Kind) block;
+    token->detail = detail;
+    return true;
+}
+
+
+bool next_ir_heading(Document_IR* ir, Heading* heading)
+{
+    u16 level, unused;
+    if (!read_ir_reference(ir, &ir->headings, &level, &heading->text)) return false;
+    if (!read_ir_reference(ir, &ir->headings, &unused, &heading->slug)) return false;
+
+    heading->level = level;
+    return true;
+}
+
+
+bool next_ir_link(Document_IR* ir, String* folded_label, Link_Definition* definition)
+{
+    u16 unused;
+    if (!read_ir_reference(ir, &ir->links, &unused, folded_label))      return false;
+    if (!read_ir_reference(ir, &ir->links, &unused, &definition->url))   return false;
+    if (!read_ir_reference(ir, &ir->links, &unused, &definition->title)) return false;
+    return true;
+}
+
+
+static bool read_ir_source_position(String* table, Source_Position* position)
+{
+    u64 offset;
+    if (!read_u64le(table, &offset))            return false;
+    if (!read_u32le(table, &position->line))    return false;
+    if (!read_u32le(table, &position->column))  return false;
+
+    position->offset = (umm) offset;
+    return true;
+}
+
+
+bool next_ir_block(Document_IR* ir, Source_Block* block)
+{
+    return read_ir_source_position(&ir->blocks, &block->begin) && read_ir_source_position(&ir->blocks, &block->end);
+}
+
+
+bool render_document_ir(Document_IR* ir, Output_Sink* sink, Parse_Options* options)
+{
+    if (options && options->table_of_contents)
+    {
+        SLList<Heading> outline;
+
+        Heading heading;
+        while (next_ir_heading(ir, &heading))
+            outline.append(heading);
+
+        emit_table_of_contents(outline, sink);
+    }
+
+    // The only things that are built up front, links have to be looked up by label,
+    // and blocks are a list in Parse_Result.
+    Link_Map links;
+    String label;
+    Link_Definition definition;
+    while (next_ir_link(ir, &label, &definition))
+        links.insert(label, definition);
+
+    SLList<Source_Block> blocks;
+    Source_Block block;
+    if (options && options->data_sourcepos)
+    {
+        while (next_ir_block(ir, &block))
+            blocks.append(block);
+    }
+
+    HTML_Emitter emitter = {};
+    emitter.links = &links;
+    emitter.next_block = blocks.head;
+
+    Labeled_String token;
+    while (next_ir_token(ir, &token))
+        emit_html_token(&emitter, token, sink);
+
+    finish_html(&emitter, sink);
+    return !ir->corrupt;
+}
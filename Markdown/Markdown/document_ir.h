@@ -0,0 +1,102 @@
+#pragma once
+
+#include "typedef.h"
+#include "string.h"
+#include "parser.h"
+
+
+
+//
+// Binary document IR.
+// A parsed document, serialized so it can be cached and rendered again
+// without parsing. It is designed to be used in place, straight from a memory
+// mapped file: the reader only keeps cursors into it and nothing is
+// deserialized up front. Strings aren't stored either, tokens point into
+// the original text. Only strings the parser made up (slugs) are in a pool.
+//
+// Everything is little endian.
+//
+//     header               40 bytes
+//         u32 magic            "MDIR"
+//         u32 version          DOCUMENT_IR_VERSION
+//         u64 input_length     length of the text the IR was made from
+//         u32 input_crc32      compute_crc32 of that text
+//         u32 token_count
+//         u32 heading_count
+//         u32 pool_length
+//         u32 link_count
+//         u32 block_count      Parse_Result::blocks, 0 unless it was parsed with source_positions
+//     token table          token_count * 16 bytes
+//     heading table        heading_count * 32 bytes, two string references each (text, slug)
+//     link table           link_count * 48 bytes, three string references each (folded label, url, title)
+//     block table          block_count * 32 bytes
+//     string pool          pool_length bytes
+//
+//     string reference     16 bytes
+//         u16 tag              heading level for headings, 0 otherwise
+//         u16 location         IR_IN_INPUT or IR_IN_POOL
+//         u32 length
+//         u64 offset           into the input text or into the string pool
+//
+//     token                16 bytes, a string reference with the tag split up
+//         u8 type              String_Label
+//         u8 block             Block_Kind
+//         u8 detail
+//         u8 location
+//         u32 length
+//         u64 offset
+//
+//     block                32 bytes, a Source_Block
+//         u64 begin_offset, u32 begin_line, u32 begin_column
+//         u64 end_offset, u32 end_line, u32 end_column
+//
+
+
+constexpr u32 DOCUMENT_IR_MAGIC   = 'M' | ('D' << 8) | ('I' << 16) | ('R' << 24);
+constexpr u32 DOCUMENT_IR_VERSION = 4;  // Also goes up with every new String_Label or Block_Kind, 4 replaced tag strings with block tokens.
+
+enum IR_Location
+{
+    IR_IN_INPUT = 0,
+    IR_IN_POOL  = 1,
+};
+
+
+// Returns the serialized IR, allocated in the temp region, or an empty string
+// if the temp region is out of memory.
+String serialize_document_ir(String input, Parse_Result* result);
+
+
+struct Document_IR
+{
+    String input;
+    u32 input_crc32;
+
+    String tokens;    // What's left of the token table, consumed by next_ir_token.
+    String headings;  // What's left of the heading table, consumed by next_ir_heading.
+    String links;     // What's left of the link table, consumed by next_ir_link.
+    String blocks;    // What's left of the block table, consumed by next_ir_block.
+    String pool;
+
+    u32 token_count;
+    u32 heading_count;
+    u32 link_count;
+    u32 block_count;
+
+    bool corrupt;     // Set when a reference points outside of the input or the pool.
+};
+
+// Checks the header and the table sizes. 'input' must be the text the IR was made from;
+// only its length is checked here, see ir_matches_input for a full check.
+bool open_document_ir(Document_IR* ir, String data, String input);
+bool ir_matches_input(Document_IR* ir);
+
+// Return false at the end of the table, or if an entry is corrupt.
+bool next_ir_token(Document_IR* ir, Labeled_String* token);
+bool next_ir_heading(Document_IR* ir, Heading* heading);
+bool next_ir_link(Document_IR* ir, String* folded_label, Link_Definition* definition);
+bool next_ir_block(Document_IR* ir, Source_Block* block);
+
+// Produces exactly what parse() would have, options can be NULL.
+// data_sourcepos only has an effect if the IR was made with source positions.
+bool render_document_ir(Document_IR* ir, Output_Sink* sink, Parse_Options* options = NULL);
@@ -5,9 +5,21 @@
 #include "file_io.h"
 #include "memory.h"
 #include "string.h"
+#include "macros.h"
+#include "profile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 bool read_entire_file(String* data, String path)
 {
+    ProfileScope(PROFILE_READ);
     char* c_path = make_c_style_string(path);
 
     // Slightly inefficient što moraš allocateat C-style null-terminated string,
@@ -28,11 +40,101 @@ bool read_entire_file(String* data, String path)
     fseek(f, 0, SEEK_SET);
 
     data->length = length;
-    data->data = (u8*) lk_region_alloc(&temporary_memory, length,1);
-    int count_read = fread(data->data, length, 1, f);
+    data->data = (u8*) lk_region_alloc(temp, length,1);
+    int count_read = length ? fread(data->data, length, 1, f) : 1;
     fclose(f);
 
     if (count_read != 1)
         return false;
     return true;
+}
+
+
+bool write_entire_file(String path, String data)
+{
+    ProfileScope(PROFILE_WRITE);
+    char* c_path = make_c_style_string(path);
+
+    FILE* f = fopen(c_path, "wb");
+    if (!f) return false;
+
+    umm count_written = data.length ? fwrite(data.data, data.length, 1, f) : 1;
+    bool close_success = fclose(f) == 0;
+
+    return count_written == 1 && close_success;
+}
+
+
+String get_html_path(String path)
+{
+    String extension = ".md"_s;
+    if (path.length >= extension.length && substring(path, path.length - extension.length, extension.length) == extension)
+        path.length -= extension.length;
+    return concatenate(path, ".html"_s);
+}
+
+
+bool map_entire_file(String* data, String path)
+{
+    data->length = 0;
+    data->data = NULL;
+
+#ifdef _WIN32
+    String16 path16 = convert_utf8_to_utf16(path);
+    HANDLE file = CreateFileW((LPCWSTR) path16.data, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, 0, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    Defer(CloseHandle(file));
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size))
+        return false;
+    if (size.QuadPart == 0)
+        return true;  // Empty files can't be mapped.
+
+    HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!mapping)
+        return false;
+    Defer(CloseHandle(mapping));
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view)
+        return false;
+
+    data->length = (umm) size.QuadPart;
+    data->data = (u8*) view;
+    return true;
+#else
+    int file = open(make_c_style_string(path), O_RDONLY);
+    if (file < 0)
+        return false;
+    Defer(close(file));
+
+    struct stat status;
+    if (fstat(file, &status) != 0)
+        return false;
+    if (status.st_size == 0)
+        return true;  // Empty files can't be mapped.
+
+    void* view = mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    if (view == MAP_FAILED)
+        return false;
+
+    data->length = (umm) status.st_size;
+    data->data = (u8*) view;
+    return true;
+#endif
+}
+
+
+void unmap_file(String data)
+{
+    if (!data.data)
+        return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(data.data);
+#else
+    munmap(data.data, data.length);
+#endif
 }
\ No newline at end of file
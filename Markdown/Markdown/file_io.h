@@ -2,4 +2,12 @@
 
 #include "string.h"
 
-bool read_entire_file(String* data, String path);
\ No newline at end of file
+bool read_entire_file(String* data, String path);
+bool write_entire_file(String path, String data);
+
+// The mapping is read only, and stays valid until unmap_file.
+bool map_entire_file(String* data, String path);
+void unmap_file(String data);
+
+// foo.md -> foo.html, anything else gets .html appended.
+String get_html_path(String path);  // Allocates.
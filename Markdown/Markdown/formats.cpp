@@ -0,0 +1,540 @@
+#pragma once
+
+#include <stdio.h>
+
+#include "typedef.h"
+#include "macros.h"
+#include "string.h"
+#include "output.h"
+#include "html_entities.h"
+#include "parser.h"
+#include "formats.h"
+
+
+
+//
+// HTML.
+//
+
+
+static void html_sink_begin(Token_Sink* sink, Parse_Result* result)
+{
+    HTML_Token_Sink* html = (HTML_Token_Sink*) sink;
+    if (html->table_of_contents)
+        emit_table_of_contents(result->outline, html->sink.output);
+    html->emitter.links = &result->links;
+    if (html->data_sourcepos)
+        html->emitter.next_block = result->blocks.head;
+
+    if (html->source_map)
+    {
+        html->emitter.input = result->input;
+        html->emitter.source_map = &result->source_map;
+    }
+}
+
+static void html_sink_token(Token_Sink* sink, Labeled_String token)
+{
+    HTML_Token_Sink* html = (HTML_Token_Sink*) sink;
+    emit_html_token(&html->emitter, token, html->sink.output);
+}
+
+static void html_sink_end(Token_Sink* sink)
+{
+    HTML_Token_Sink* html = (HTML_Token_Sink*) sink;
+    finish_html(&html->emitter, html->sink.output);
+}
+
+void init_html_token_sink(HTML_Token_Sink* sink, Output_Sink* output, Parse_Options* options)
+{
+    ZeroStruct(sink);
+    sink->sink.begin = html_sink_begin;
+    sink->sink.token = html_sink_token;
+    sink->sink.end   = html_sink_end;
+    sink->sink.output = output;
+    sink->table_of_contents = options && options->table_of_contents;
+    sink->source_map = options && options->source_map;
+    sink->data_sourcepos = options && options->data_sourcepos;
+}
+
+
+
+//
+// Plain text.
+//
+
+
+// Character references decoded, in pieces that go through 'write'.
+static void write_decoded_text(Output_Sink* output, String text, void (*write)(Output_Sink* output, String text))
+{
+    u8 utf8[CHARACTER_REFERENCE_MAX_UTF8];
+    String piece;
+    bool decoded;
+    while (consume_text_piece(&text, utf8, &piece, &decoded))
+        write(output, piece);
+}
+
+// The text of ST_TEXT and ST_TABLE_CELL tokens, without the backslashes of escaped
+// pipes, split into runs and links the way the HTML is.
+static void visit_token_text(Labeled_String token, Link_Map* links, Inline_Visitor* visitor)
+{
+    String text = token.value;
+    while (text)
+    {
+        String run = text;
+        if (token.type == ST_TABLE_CELL)
+            run = consume_table_cell_run(&text);
+        else
+            text = {};
+
+        visit_inline_text(links, run, visitor);
+    }
+}
+
+
+struct Text_Inline_Visitor
+{
+    Inline_Visitor visitor;
+    Output_Sink* output;
+};
+
+static void text_visit_text(Inline_Visitor* visitor, String text)
+{
+    write_decoded_text(((Text_Inline_Visitor*) visitor)->output, text, write_output);
+}
+
+static void text_visit_link(Inline_Visitor* visitor, Inline_Link* link)
+{
+    write_decoded_text(((Text_Inline_Visitor*) visitor)->output, link->text, write_output);
+}
+
+static void text_sink_begin(Token_Sink* sink, Parse_Result* result)
+{
+    Text_Token_Sink* text = (Text_Token_Sink*) sink;
+    text->links = &result->links;
+}
+
+static void text_sink_token(Token_Sink* sink, Labeled_String token)
+{
+    Text_Token_Sink* text = (Text_Token_Sink*) sink;
+
+    switch (token.type)
+    {
+    case ST_TEXT:
+    case ST_TABLE_CELL:
+    {
+        if (!token.value)
+            return;
+        Text_Inline_Visitor visitor = { { text_visit_text, text_visit_link }, text->sink.output };
+        visit_token_text(token, text->links, &visitor.visitor);
+        write_output(text->sink.output, "\n"_s);
+    } break;
+
+    case ST_CODE:
+    case ST_CODE_INDENTED:
+    {
+        String code = token.value;
+        String line = {};
+        while (code)
+        {
+            line = consume_code_line(&code, token);
+            write_output(text->sink.output, line);
+        }
+        if (line && line[line.length - 1] != '\n' && line[line.length - 1] != '\r')
+            write_output(text->sink.output, "\n"_s);
+    } break;
+
+    case ST_BLOCK_OPEN:
+    {
+        if (token.block == BLOCK_LIST)
+            text->list_depth++;
+    } break;
+
+    case ST_BLOCK_CLOSE:
+    {
+        // an empty line after every top level block
+        switch (token.block)
+        {
+        case BLOCK_LIST:
+            if (text->list_depth && --text->list_depth == 0)
+                write_output(text->sink.output, "\n"_s);
+            break;
+        case BLOCK_PARAGRAPH:
+        case BLOCK_HEADING:
+        case BLOCK_CODE:
+        case BLOCK_TABLE:
+            write_output(text->sink.output, "\n"_s);
+            break;
+        default: break;
+        }
+    } break;
+
+    default: break;
+    }
+}
+
+static void text_sink_end(Token_Sink* sink) {}
+
+void init_text_token_sink(Text_Token_Sink* sink, Output_Sink* output)
+{
+    ZeroStruct(sink);
+    sink->sink.begin = text_sink_begin;
+    sink->sink.token = text_sink_token;
+    sink->sink.end   = text_sink_end;
+    sink->sink.output = output;
+}
+
+
+
+//
+// JSON.
+//
+
+
+static void write_json_escaped(Output_Sink* output, String string)
+{
+    static const char hex_digits[] = "0123456789abcdef";
+
+    umm run_start = 0;
+    for (umm i = 0; i < string.length; i++)
+    {
+        u8 c = string.data[i];
+        if (c >= 0x20 && c != '"' && c != '\\')
+            continue;
+
+        write_output(output, substring(string, run_start, i - run_start));
+        run_start = i + 1;
+
+        switch (c)
+        {
+        case '"':  write_output(output, "\\\""_s); break;
+        case '\\': write_output(output, "\\\\"_s); break;
+        case '\n': write_output(output, "\\n"_s);  break;
+        case '\r': write_output(output, "\\r"_s);  break;
+        case '\t': write_output(output, "\\t"_s);  break;
+        default:
+        {
+            u8 escape[6] = { '\\', 'u', '0', '0', (u8) hex_digits[c >> 4], (u8) hex_digits[c & 0xF] };
+            write_output(output, { 6, escape });
+        } break;
+        }
+    }
+    write_output(output, substring(string, run_start, string.length - run_start));
+}
+
+static void json_begin_node(JSON_Token_Sink* json, String type)
+{
+    if (json->needs_comma)
+        write_output(json->sink.output, ","_s);
+    write_output(json->sink.output, "{\"type\":\""_s);
+    write_output(json->sink.output, type);
+    write_output(json->sink.output, "\""_s);
+    json->needs_comma = false;
+}
+
+static void json_begin_children(JSON_Token_Sink* json)
+{
+    write_output(json->sink.output, ",\"children\":["_s);
+}
+
+static void json_end_node(JSON_Token_Sink* json, bool has_children)
+{
+    write_output(json->sink.output, has_children ? "]}"_s : "}"_s);
+    json->needs_comma = true;
+}
+
+static void json_open_text(JSON_Token_Sink* json)
+{
+    if (json->text_open)
+        return;
+    json_begin_node(json, "text"_s);
+    write_output(json->sink.output, ",\"value\":\""_s);
+    json->text_open = true;
+}
+
+static void json_close_text(JSON_Token_Sink* json)
+{
+    if (!json->text_open)
+        return;
+    write_output(json->sink.output, "\""_s);
+    json_end_node(json, false);
+    json->text_open = false;
+}
+
+static void json_write_string_field(JSON_Token_Sink* json, String name, String value)
+{
+    write_output(json->sink.output, ",\""_s);
+    write_output(json->sink.output, name);
+    write_output(json->sink.output, "\":\""_s);
+    write_decoded_text(json->sink.output, value, write_json_escaped);
+    write_output(json->sink.output, "\""_s);
+}
+
+
+struct JSON_Inline_Visitor
+{
+    Inline_Visitor visitor;
+    JSON_Token_Sink* json;
+};
+
+static void json_visit_text(Inline_Visitor* visitor, String text)
+{
+    JSON_Token_Sink* json = ((JSON_Inline_Visitor*) visitor)->json;
+    json_open_text(json);
+    write_decoded_text(json->sink.output, text, write_json_escaped);
+}
+
+static void json_visit_link(Inline_Visitor* visitor, Inline_Link* link)
+{
+    JSON_Token_Sink* json = ((JSON_Inline_Visitor*) visitor)->json;
+    json_close_text(json);
+    json_begin_node(json, "link"_s);
+    write_output(json->sink.output, ",\"url\":\""_s);
+    write_json_escaped(json->sink.output, link->href_prefix);
+    write_decoded_text(json->sink.output, link->url, write_json_escaped);
+    write_output(json->sink.output, "\""_s);
+    if (link->title)
+        json_write_string_field(json, "title"_s, link->title);
+    json_begin_children(json);
+    json_open_text(json);
+    write_decoded_text(json->sink.output, link->text, write_json_escaped);
+    json_close_text(json);
+    json_end_node(json, true);
+}
+
+
+static void json_sink_begin(Token_Sink* sink, Parse_Result* result)
+{
+    JSON_Token_Sink* json = (JSON_Token_Sink*) sink;
+    json->links = &result->links;
+    json_begin_node(json, "document"_s);
+    json_begin_children(json);
+}
+
+static const String json_alignments[] = { ""_s, "left"_s, "center"_s, "right"_s };
+
+static void json_sink_block_open(JSON_Token_Sink* json, Labeled_String token)
+{
+    switch (token.block)
+    {
+    case BLOCK_PARAGRAPH: json_begin_node(json, "paragraph"_s); break;
+    case BLOCK_LIST:      json_begin_node(json, "list"_s);      break;
+    case BLOCK_LIST_ITEM: json_begin_node(json, "item"_s);      break;
+    case BLOCK_TABLE:     json_begin_node(json, "table"_s);     break;
+    case BLOCK_TABLE_ROW: json_begin_node(json, "row"_s);       break;
+
+    case BLOCK_HEADING:
+    {
+        u8 level = '0' + token.detail;
+        json_begin_node(json, "heading"_s);
+        write_output(json->sink.output, ",\"level\":"_s);
+        write_output(json->sink.output, { 1, &level });
+        if (token.value)
+        {
+            write_output(json->sink.output, ",\"id\":\""_s);
+            write_json_escaped(json->sink.output, token.value);
+            write_output(json->sink.output, "\""_s);
+        }
+    } break;
+
+    case BLOCK_TABLE_HEADER_CELL:
+    case BLOCK_TABLE_CELL:
+    {
+        json_begin_node(json, "cell"_s);
+        if (token.block == BLOCK_TABLE_HEADER_CELL)
+            write_output(json->sink.output, ",\"header\":true"_s);
+        if (token.detail != TABLE_ALIGN_NONE && token.detail <= TABLE_ALIGN_RIGHT)
+        {
+            write_output(json->sink.output, ",\"align\":\""_s);
+            write_output(json->sink.output, json_alignments[token.detail]);
+            write_output(json->sink.output, "\""_s);
+        }
+    } break;
+
+    case BLOCK_CODE:
+    {
+        // The code itself is the value, written by the ST_CODE token.
+        json_begin_node(json, "code_block"_s);
+        if (token.value)
+        {
+            write_output(json->sink.output, ",\"language\":\""_s);
+            write_json_escaped(json->sink.output, token.value);
+            write_output(json->sink.output, "\""_s);
+        }
+        return;
+    }
+
+    default: return; // The head and body of a table aren't nodes, rows go straight into the table.
+    }
+
+    json_begin_children(json);
+}
+
+static void json_sink_block_close(JSON_Token_Sink* json, Labeled_String token)
+{
+    switch (token.block)
+    {
+    case BLOCK_CODE:       json_end_node(json, false); break;
+    case BLOCK_TABLE_HEAD:
+    case BLOCK_TABLE_BODY: break;
+    default:               json_end_node(json, true); break;
+    }
+}
+
+static void json_sink_token(Token_Sink* sink, Labeled_String token)
+{
+    JSON_Token_Sink* json = (JSON_Token_Sink*) sink;
+
+    switch (token.type)
+    {
+    case ST_TEXT:
+    case ST_TABLE_CELL:
+    {
+        // The lines of a block are joined by newlines, a link in between ends the text node.
+        if (json->text_seen)
+        {
+            json_open_text(json);
+            write_output(json->sink.output, "\\n"_s);
+        }
+        json->text_seen = true;
+
+        JSON_Inline_Visitor visitor = { { json_visit_text, json_visit_link }, json };
+        visit_token_text(token, json->links, &visitor.visitor);
+    } break;
+
+    case ST_CODE:
+    case ST_CODE_INDENTED:
+    {
+        json_close_text(json);
+        write_output(json->sink.output, ",\"value\":\""_s);
+        String code = token.value;
+        while (code)
+            write_json_escaped(json->sink.output, consume_code_line(&code, token));
+        write_output(json->sink.output, "\""_s);
+    } break;
+
+    case ST_META_TAG:
+    {
+        json_close_text(json);
+        json_begin_node(json, "front_matter"_s);
+        write_output(json->sink.output, ",\"value\":\""_s);
+        write_json_escaped(json->sink.output, token.value);
+        write_output(json->sink.output, "\""_s);
+        json_end_node(json, false);
+    } break;
+
+    case ST_BLOCK_OPEN:
+    {
+        json_close_text(json);
+        json->text_seen = false;
+        json_sink_block_open(json, token);
+    } break;
+
+    case ST_BLOCK_CLOSE:
+    {
+        json_close_text(json);
+        json->text_seen = false;
+        json_sink_block_close(json, token);
+    } break;
+
+    default: break;
+    }
+}
+
+static void json_sink_end(Token_Sink* sink)
+{
+    JSON_Token_Sink* json = (JSON_Token_Sink*) sink;
+    json_close_text(json);
+    json_end_node(json, true);
+    write_output(json->sink.output, "\n"_s);
+}
+
+void init_json_token_sink(JSON_Token_Sink* sink, Output_Sink* output)
+{
+    ZeroStruct(sink);
+    sink->sink.begin = json_sink_begin;
+    sink->sink.token = json_sink_token;
+    sink->sink.end   = json_sink_end;
+    sink->sink.output = output;
+}
+
+
+
+//
+// Source maps.
+//
+
+
+static void write_json_integer(Output_Sink* output, i64 value)
+{
+    char digits[24];
+    int length = snprintf(digits, sizeof(digits), "%lld", (long long) value);
+    write_output(output, { (umm) length, (u8*) digits });
+}
+
+void write_source_map_json(Output_Sink* output, SLList<Source_Mapping>& source_map)
+{
+    write_output(output, "{\"version\":1,\"mappings\":["_s);
+
+    umm previous_output_offset = 0;
+    umm previous_input_offset = 0;
+    for (auto* node = source_map.head; node != NULL; node = node->next)
+    {
+        Source_Mapping mapping = node->value;
+        if (node != source_map.head)
+            write_output(output, ","_s);
+
+        write_json_integer(output, (i64) mapping.output_offset - (i64) previous_output_offset);
+        write_output(output, ","_s);
+        write_json_integer(output, (i64) mapping.input_offset - (i64) previous_input_offset);
+        write_output(output, ","_s);
+        write_json_integer(output, (i64) mapping.length);
+
+        previous_output_offset = mapping.output_offset;
+        previous_input_offset = mapping.input_offset;
+    }
+
+    write_output(output, "]}\n"_s);
+}
+
+
+
+//
+// Document stats.
+//
+
+
+void write_document_stats_json(Output_Sink* output, String path, Document_Stats* stats)
+{
+    write_output(output, "{\"path\":\""_s);
+    write_json_escaped(output, path);
+    write_output(output, "\",\"bytes\":"_s);
+    write_json_integer(output, (i64) stats->bytes);
+    write_output(output, ",\"words\":"_s);
+    write_json_integer(output, (i64) stats->words);
+    write_output(output, ",\"links\":"_s);
+    write_json_integer(output, (i64) stats->links);
+    write_output(output, ",\"code_bytes\":"_s);
+    write_json_integer(output, (i64) stats->code_bytes);
+
+    char fraction[32];
+    int length = snprintf(fraction, sizeof(fraction), "%.4f", stats->bytes ? (f64) stats->code_bytes / (f64) stats->bytes : 0.0);
+    write_output(output, ",\"code_fraction\":"_s);
+    write_output(output, { (umm) length, (u8*) fraction });
+
+    write_output(output, ",\"max_list_depth\":"_s);
+    write_json_integer(output, (i64) stats->max_list_depth);
+
+    write_output(output, ",\"outline\":["_s);
+    for (auto* node = stats->outline.head; node != NULL; node = node->next)
+    {
+        if (node != stats->outline.head)
+            write_output(output, ","_s);
+        write_output(output, "["_s);
+        write_json_integer(output, (i64) node->value.level);
+        write_output(output, ",\""_s);
+        write_json_escaped(output, node->value.text);
+        write_output(output, "\"]"_s);
+    }
+    write_output(output, "]}\n"_s);
+}
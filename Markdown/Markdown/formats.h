@@ -0,0 +1,74 @@
+#pragma once
+
+#include "typedef.h"
+#include "string.h"
+#include "output.h"
+#include "parser.h"
+
+
+
+//
+// Output formats.
+// Every format is a Token_Sink that writes to its own Output_Sink (sink.output),
+// so any number of them can be fed by a single parse, see parse(String, Token_Sink**, ...).
+//
+
+
+// Exactly what parse(String, Output_Sink*) writes.
+struct HTML_Token_Sink
+{
+    Token_Sink sink;
+    HTML_Emitter emitter;
+    bool table_of_contents;
+    bool source_map;         // Fills Parse_Result::source_map.
+    bool data_sourcepos;     // Writes Parse_Result::blocks into the block tags.
+};
+
+void init_html_token_sink(HTML_Token_Sink* sink, Output_Sink* output, Parse_Options* options = NULL);
+
+
+// Text and code content only, for search indexing.
+// Every block ends with a newline, and blocks are separated by an empty line.
+// Reference links are written as their text.
+struct Text_Token_Sink
+{
+    Token_Sink sink;
+    u32 list_depth;
+    Link_Map* links;
+};
+
+void init_text_token_sink(Text_Token_Sink* sink, Output_Sink* output);
+
+
+// The document tree as JSON:
+//     {"type":"document","children":[
+//         {"type":"heading","level":1,"id":"intro","children":[{"type":"text","value":"Intro"}]},
+//         {"type":"paragraph","children":[{"type":"text","value":"line one\nline two"}]},
+//         {"type":"paragraph","children":[{"type":"text","value":"See "},
+//             {"type":"link","url":"https://example.com","title":"Example","children":[{"type":"text","value":"the docs"}]}]},
+//         {"type":"list","children":[{"type":"item","children":[...]}]},
+//         {"type":"code_block","language":"c","value":"int x;\n"}]}
+// Reference links and autolinks are found the way the HTML finds them, a link without a title has no "title".
+struct JSON_Token_Sink
+{
+    Token_Sink sink;
+    bool needs_comma;     // The innermost open node already has a child.
+    bool text_open;       // Consecutive text tokens are merged into one text node.
+    bool text_seen;       // The innermost block already has text, its next line starts with a newline.
+    Link_Map* links;
+};
+
+void init_json_token_sink(JSON_Token_Sink* sink, Output_Sink* output);
+
+
+// Parse_Result::source_map as compact JSON, three numbers per mapping:
+//     {"version":1,"mappings":[output_offset,input_offset,length, ...]}
+// Both offsets are relative to the previous mapping, the first one to 0.
+void write_source_map_json(Output_Sink* output, SLList<Source_Mapping>& source_map);
+
+
+// Document_Stats as one line of JSON, so a run over many files makes JSON Lines:
+//     {"path":"a.md","bytes":1200,"words":180,"links":3,"code_bytes":240,"code_fraction":0.2000,
+//      "max_list_depth":2,"outline":[[1,"Title"],[2,"Usage"]]}
+// Heading text is as written in the source, inline markup and references aren't touched.
+void write_document_stats_json(Output_Sink* output, String path, Document_Stats* stats);
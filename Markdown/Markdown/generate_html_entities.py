@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+#
+# Writes html_entities_table.h, the minimal perfect hash of the HTML5 named
+# character references that html_entities.cpp looks names up in.
+# The list is the WHATWG one that ships with Python, in html.entities.html5.
+# Run it again from this directory if the hash functions in html_entities.cpp change.
+#
+
+import html.entities
+import sys
+
+OUTPUT_PATH = "html_entities_table.h"
+NAMES_PER_BUCKET = 4
+
+
+def fnv1a(name):
+    h = 2166136261
+    for c in name:
+        h = ((h ^ c) * 16777619) & 0xFFFFFFFF
+    return h
+
+def mix(h):
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & 0xFFFFFFFF
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & 0xFFFFFFFF
+    h ^= h >> 16
+    return h
+
+def fast_range(h, n):
+    return (h * n) >> 32
+
+def get_slot(h, displacement, count):
+    return fast_range(mix(h ^ ((displacement * 0x9E3779B9) & 0xFFFFFFFF)), count)
+
+
+# Only the names with the semicolon, the legacy ones without it aren't references in Markdown.
+entities = {}
+for name, text in html.entities.html5.items():
+    if name.endswith(";"):
+        entities[name[:-1].encode("ascii")] = text.encode("utf-8")
+
+names = sorted(entities)
+count = len(names)
+bucket_count = (count + NAMES_PER_BUCKET - 1) // NAMES_PER_BUCKET
+
+hashes = {name: fnv1a(name) for name in names}
+buckets = [[] for _ in range(bucket_count)]
+for name in names:
+    buckets[fast_range(hashes[name], bucket_count)].append(name)
+
+# Biggest buckets first, each gets the first displacement that puts all of its names in free slots.
+displacements = [0] * bucket_count
+slots = [None] * count
+for bucket in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+    if not buckets[bucket]:
+        continue
+    displacement = 0
+    while True:
+        taken = [get_slot(hashes[name], displacement, count) for name in buckets[bucket]]
+        if len(set(taken)) == len(taken) and all(slots[slot] is None for slot in taken):
+            break
+        displacement += 1
+        if displacement > 0xFFFF:
+            sys.exit("no displacement fits in 16 bits, change NAMES_PER_BUCKET")
+    displacements[bucket] = displacement
+    for name, slot in zip(buckets[bucket], taken):
+        slots[slot] = name
+
+longest_name = max(len(name) for name in names)
+longest_text = max(len(text) for text in entities.values())
+assert longest_text <= 8
+
+
+pool = b"".join(names)
+offsets = {}
+offset = 0
+for name in names:
+    offsets[name] = offset
+    offset += len(name)
+assert offset <= 0xFFFF
+
+
+with open(OUTPUT_PATH, "w", newline="\n") as out:
+    out.write("#pragma once\n\n")
+    out.write("// Generated by generate_html_entities.py, don't edit.\n\n\n")
+    out.write("static constexpr u32 HTML_ENTITY_COUNT = %d;\n" % count)
+    out.write("static constexpr u32 HTML_ENTITY_BUCKET_COUNT = %d;\n" % bucket_count)
+    out.write("static constexpr umm HTML_ENTITY_NAME_MAX = %d;\n\n" % longest_name)
+
+    out.write("static const u16 html_entity_displacements[HTML_ENTITY_BUCKET_COUNT] =\n{\n")
+    for i in range(0, bucket_count, 16):
+        out.write("    " + " ".join("%d," % d for d in displacements[i:i + 16]) + "\n")
+    out.write("};\n\n")
+
+    out.write("// Every name once, without the '&' and ';', in alphabetical order.\n")
+    out.write("static const char html_entity_names[] =\n")
+    for i in range(0, len(names), 12):
+        out.write("    \"" + "".join(name.decode("ascii") for name in names[i:i + 12]) + "\"\n")
+    out.write(";\n\n")
+
+    out.write("// In hash slot order.\n")
+    out.write("static const HTML_Entity html_entities[HTML_ENTITY_COUNT] =\n{\n")
+    for name in slots:
+        text = entities[name]
+        out.write("    { %5d, %2d, %d, { %s } },  // %s\n" % (offsets[name], len(name), len(text),
+            ", ".join("0x%02X" % b for b in text), name.decode("ascii")))
+    out.write("};\n")
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "typedef.h"
+#include "macros.h"
+#include "string.h"
+#include "output.h"
+#include "gzip_output.h"
+
+#if MARKDOWN_ZLIB
+
+#ifdef _MSC_VER
+#pragma comment(lib, "zlib")
+#endif
+
+
+static constexpr umm GZIP_STAGING_SIZE = 64 * 1024;
+static constexpr umm GZIP_COMPRESSED_SIZE = 64 * 1024;
+
+// windowBits above 15 makes zlib write a gzip header and trailer.
+static constexpr int GZIP_WINDOW_BITS = 15 + 16;
+
+
+
+// Runs deflate over the staged bytes, writing out every full buffer of compressed data.
+static void deflate_staged(GZip_File_Sink* sink, int flush)
+{
+    if (sink->plain_file && sink->staged_length)
+    {
+        if (fwrite(sink->staged, 1, sink->staged_length, sink->plain_file) != sink->staged_length)
+            sink->failed = true;
+    }
+
+    z_stream* stream = &sink->stream;
+    stream->next_in = sink->staged;
+    stream->avail_in = (uInt) sink->staged_length;
+
+    do
+    {
+        stream->next_out = sink->compressed;
+        stream->avail_out = (uInt) GZIP_COMPRESSED_SIZE;
+
+        int result = deflate(stream, flush);
+        if (result == Z_STREAM_ERROR)
+        {
+            sink->failed = true;
+            break;
+        }
+
+        umm length = GZIP_COMPRESSED_SIZE - stream->avail_out;
+        if (length && fwrite(sink->compressed, 1, length, sink->file) != length)
+            sink->failed = true;
+    }
+    while (stream->avail_out == 0);
+
+    sink->staged_length = 0;
+}
+
+static void gzip_sink_write(Output_Sink* output, String utf8)
+{
+    GZip_File_Sink* sink = (GZip_File_Sink*) output;
+    if (sink->failed)
+        return;
+
+    while (utf8)
+    {
+        umm space = GZIP_STAGING_SIZE - sink->staged_length;
+        umm length = utf8.length < space ? utf8.length : space;
+        copy(sink->staged + sink->staged_length, utf8.data, length);
+        sink->staged_length += length;
+        consume(&utf8, length);
+
+        if (sink->staged_length == GZIP_STAGING_SIZE)
+            deflate_staged(sink, Z_NO_FLUSH);
+    }
+}
+
+
+bool open_gzip_file_sink(GZip_File_Sink* sink, String path, String plain_path, int level)
+{
+    ZeroStruct(sink);
+    sink->sink.write = gzip_sink_write;
+
+    if (deflateInit2(&sink->stream, level, Z_DEFLATED, GZIP_WINDOW_BITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        return false;
+
+    sink->staged = (u8*) malloc(GZIP_STAGING_SIZE);
+    sink->compressed = (u8*) malloc(GZIP_COMPRESSED_SIZE);
+    sink->file = fopen(make_c_style_string(path), "wb");
+    if (plain_path)
+        sink->plain_file = fopen(make_c_style_string(plain_path), "wb");
+
+    if (!sink->staged || !sink->compressed || !sink->file || (plain_path && !sink->plain_file))
+    {
+        sink->failed = true;
+        close_gzip_file_sink(sink);
+        return false;
+    }
+    return true;
+}
+
+bool close_gzip_file_sink(GZip_File_Sink* sink)
+{
+    if (!sink->failed)
+        deflate_staged(sink, Z_FINISH);
+    deflateEnd(&sink->stream);
+
+    bool success = !sink->failed;
+    if (sink->file && fclose(sink->file) != 0)
+        success = false;
+    if (sink->plain_file && fclose(sink->plain_file) != 0)
+        success = false;
+
+    free(sink->staged);
+    free(sink->compressed);
+    ZeroStruct(sink);
+    return success;
+}
+
+#endif
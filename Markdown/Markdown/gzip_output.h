@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdio.h>
+
+#include "typedef.h"
+#include "string.h"
+#include "output.h"
+
+
+
+//
+// Compressed output.
+// Writes a .gz file as the output is produced, through zlib's streaming
+// deflate. Only a small staging buffer and zlib's own state are kept in
+// memory, never the whole output, compressed or not.
+//
+// All of it is compiled out unless MARKDOWN_ZLIB is defined to 1, with
+// zlib's headers and library where the compiler and linker can find them.
+// The CMake build does that when it finds zlib, the Visual Studio project
+// doesn't by default.
+//
+
+
+#ifndef MARKDOWN_ZLIB
+#define MARKDOWN_ZLIB 0
+#endif
+
+#if MARKDOWN_ZLIB
+
+#include <zlib.h>
+
+
+struct GZip_File_Sink
+{
+    Output_Sink sink;
+    z_stream stream;
+    FILE* file;
+    FILE* plain_file;        // Gets the uncompressed output too, if it was asked for.
+
+    u8* staged;              // Tokens are tiny, deflate is only called once this fills up.
+    umm staged_length;
+    u8* compressed;
+    bool failed;             // A write or zlib failed, close_gzip_file_sink returns false.
+};
+
+// 'plain_path' may be empty. 'level' is zlib's, 0 to 9.
+bool open_gzip_file_sink(GZip_File_Sink* sink, String path, String plain_path = {}, int level = Z_DEFAULT_COMPRESSION);
+
+// Finishes the stream and closes the files. Returns false if anything failed
+// since the sink was opened.
+bool close_gzip_file_sink(GZip_File_Sink* sink);
+
+#endif
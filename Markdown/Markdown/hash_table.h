@@ -0,0 +1,105 @@
+#pragma once
+
+#include "memory.h"
+#include "string.h"
+
+
+// open addressing hash map with String keys, allocated in the temp region
+// keys aren't copied, they must outlive the map (they usually point into the input)
+// when the table grows the old slots are simply abandoned in the region
+template <typename T>
+struct String_Map
+{
+	struct String_Map_Slot
+	{
+		String key;
+		u32 hash;
+		bool occupied;
+		T value;
+	};
+
+	String_Map_Slot *slots = NULL;
+	umm capacity = 0; // always a power of two
+	umm count = 0;
+
+	T *find(String key)
+	{
+		if (!count)
+			return NULL;
+		return find(key, hash_string(key));
+	}
+
+	// with a hash the caller worked out itself, it doesn't have to be hash_string(key)
+	// but then every find and insert on the map has to use the same one
+	T *find(String key, u32 hash)
+	{
+		if (!count)
+			return NULL;
+
+		umm mask = capacity - 1;
+		for (umm i = hash & mask; slots[i].occupied; i = (i + 1) & mask)
+		{
+			if (slots[i].hash == hash && slots[i].key == key)
+				return &slots[i].value;
+		}
+		return NULL;
+	}
+
+	// returns the value already stored under 'key' if there is one
+	// returns NULL if the table had to grow and the temp region is out of memory
+	T *insert(String key, T value)
+	{
+		return insert(key, hash_string(key), value);
+	}
+
+	T *insert(String key, u32 hash, T value)
+	{
+		T *existing = find(key, hash);
+		if (existing)
+			return existing;
+
+		// keep the load factor under 3/4
+		if ((count + 1) * 4 > capacity * 3 && !grow())
+			return NULL;
+
+		String_Map_Slot *slot = place(hash);
+		slot->key = key;
+		slot->hash = hash;
+		slot->occupied = true;
+		slot->value = value;
+		count++;
+		return &slot->value;
+	}
+
+private:
+	String_Map_Slot *place(u32 hash)
+	{
+		umm mask = capacity - 1;
+		umm i = hash & mask;
+		while (slots[i].occupied)
+			i = (i + 1) & mask;
+		return &slots[i];
+	}
+
+	// the old table is left as it was if the new one can't be allocated
+	bool grow()
+	{
+		umm new_capacity = capacity ? capacity * 2 : 16;
+		String_Map_Slot *new_slots = LK_RegionArray(temp, String_Map_Slot, new_capacity);
+		if (!new_slots)
+			return false;
+
+		String_Map_Slot *old_slots = slots;
+		umm old_capacity = capacity;
+
+		capacity = new_capacity;
+		slots = new_slots;
+		for (umm i = 0; i < capacity; i++)
+			slots[i].occupied = false;
+
+		for (umm i = 0; i < old_capacity; i++)
+			if (old_slots[i].occupied)
+				*place(old_slots[i].hash) = old_slots[i];
+		return true;
+	}
+};
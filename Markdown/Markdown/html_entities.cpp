@@ -0,0 +1,173 @@
+#pragma once
+
+#include <cstring>
+
+#include "typedef.h"
+#include "macros.h"
+#include "string.h"
+#include "html_entities.h"
+
+
+struct HTML_Entity
+{
+    u16 name_offset;  // Into html_entity_names.
+    u8  name_length;
+    u8  utf8_length;
+    u8  utf8[CHARACTER_REFERENCE_MAX_UTF8];
+};
+
+#include "html_entities_table.h"
+
+
+
+//
+// Named references.
+// html_entities_table.h is a minimal perfect hash of the names: the name's
+// hash picks a bucket, the bucket's displacement rehashes it to its own slot,
+// and one compare against the name in that slot says whether it's a reference.
+// generate_html_entities.py has to hash the same way.
+//
+
+
+static inline u32 mix_entity_hash(u32 hash)
+{
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6Bu;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35u;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+static inline u32 fast_range(u32 hash, u32 count)
+{
+    return (u32)(((u64) hash * count) >> 32);
+}
+
+static const HTML_Entity* find_html_entity(String name)
+{
+    u32 hash = hash_string(name);
+    u32 displacement = html_entity_displacements[fast_range(hash, HTML_ENTITY_BUCKET_COUNT)];
+    u32 slot = fast_range(mix_entity_hash(hash ^ (displacement * 0x9E3779B9u)), HTML_ENTITY_COUNT);
+
+    const HTML_Entity* entity = &html_entities[slot];
+    if (entity->name_length != name.length)
+        return NULL;
+    if (!compare(html_entity_names + entity->name_offset, name.data, name.length))
+        return NULL;
+    return entity;
+}
+
+
+
+//
+// Decoding.
+//
+
+
+static inline bool is_ascii_alphanumeric(u8 c)
+{
+    return (u8)((c | 0x20) - 'a') < 26 || (u8)(c - '0') < 10;
+}
+
+static inline u32 get_hex_digit_value(u8 c)
+{
+    if ((u8)(c - '0') < 10) return c - '0';
+    if ((u8)((c | 0x20) - 'a') < 6) return (c | 0x20) - 'a' + 10;
+    return 16;
+}
+
+// After the "&#". Returns the length including the ';', or 0.
+static umm decode_numeric_reference(String text, u32* code_point)
+{
+    bool hex = text.length && (text.data[0] | 0x20) == 'x';
+    umm start = hex ? 1 : 0;
+    umm max_digits = hex ? 6 : 7;  // CommonMark's limits, more would be way past U+10FFFF anyway.
+
+    u32 value = 0;
+    umm i = start;
+    for (; i < text.length && i - start < max_digits; i++)
+    {
+        u32 digit = hex ? get_hex_digit_value(text.data[i]) : (u32)(u8)(text.data[i] - '0');
+        if (digit >= (hex ? 16u : 10u))
+            break;
+        value = value * (hex ? 16 : 10) + digit;
+    }
+
+    if (i == start || i == text.length || text.data[i] != ';')
+        return 0;
+
+    // Nulls, surrogates and anything past Unicode become the replacement character.
+    if (value == 0 || value > 0x10FFFF || (value >= 0xD800 && value <= 0xDFFF))
+        value = 0xFFFD;
+    *code_point = value;
+    return i + 1;
+}
+
+umm decode_character_reference(String text, u8* utf8, umm* utf8_length)
+{
+    DebugAssert(text.length && text.data[0] == '&');
+    String rest = text;
+    consume(&rest, 1);
+
+    if (rest.length && rest.data[0] == '#')
+    {
+        consume(&rest, 1);
+        u32 code_point;
+        umm length = decode_numeric_reference(rest, &code_point);
+        if (!length)
+            return 0;
+
+        u32 sequence_length = get_utf8_sequence_length(code_point);
+        encode_utf8_sequence(code_point, utf8, sequence_length);
+        *utf8_length = sequence_length;
+        return 2 + length;
+    }
+
+    umm name_length = 0;
+    umm max_length = rest.length < HTML_ENTITY_NAME_MAX ? rest.length : HTML_ENTITY_NAME_MAX;
+    while (name_length < max_length && is_ascii_alphanumeric(rest.data[name_length]))
+        name_length++;
+    if (!name_length || name_length == rest.length || rest.data[name_length] != ';')
+        return 0;
+
+    const HTML_Entity* entity = find_html_entity(substring(rest, 0, name_length));
+    if (!entity)
+        return 0;
+
+    copy(utf8, entity->utf8, entity->utf8_length);
+    *utf8_length = entity->utf8_length;
+    return 1 + name_length + 1;
+}
+
+
+bool consume_text_piece(String* text, u8* utf8, String* piece, bool* decoded)
+{
+    if (!*text)
+        return false;
+
+    if (text->data[0] == '&')
+    {
+        umm utf8_length;
+        umm length = decode_character_reference(*text, utf8, &utf8_length);
+        if (length)
+        {
+            consume(text, length);
+            *piece = { utf8_length, utf8 };
+            *decoded = true;
+            return true;
+        }
+    }
+
+    // Most text has no '&' at all, memchr goes over it with vector compares.
+    // The run ends at the next '&' whether it's a reference or not, the next call sorts that out.
+    umm run_length = text->length;
+    const u8* ampersand = (const u8*) memchr(text->data + 1, '&', text->length - 1);
+    if (ampersand)
+        run_length = ampersand - text->data;
+
+    *piece = substring(*text, 0, run_length);
+    *decoded = false;
+    consume(text, run_length);
+    return true;
+}
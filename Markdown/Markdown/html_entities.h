@@ -0,0 +1,25 @@
+#pragma once
+
+#include "typedef.h"
+#include "string.h"
+
+
+
+//
+// Character references.
+// &name; for the HTML5 named references, &#123; and &#x1F600; for numeric ones.
+// Anything that doesn't decode is left as it is, the '&' included.
+//
+
+
+// Enough for any reference, a few named ones stand for two code points.
+constexpr umm CHARACTER_REFERENCE_MAX_UTF8 = 8;
+
+// 'text' starts at an '&'. Returns the length of the reference there, or 0 if
+// there isn't one, and writes what it stands for to 'utf8'.
+umm decode_character_reference(String text, u8* utf8, umm* utf8_length);
+
+// Splits 'text' into runs without references and the decoded references between them.
+// Takes the next piece off the front of 'text', returns false when there's nothing left.
+// A decoded piece points into 'utf8', which needs CHARACTER_REFERENCE_MAX_UTF8 bytes.
+bool consume_text_piece(String* text, u8* utf8, String* piece, bool* decoded);
@@ -0,0 +1,2358 @@
+#pragma once
+
+// Generated by generate_html_entities.py, don't edit.
+
+
+static constexpr u32 HTML_ENTITY_COUNT = 2125;
+static constexpr u32 HTML_ENTITY_BUCKET_COUNT = 532;
+static constexpr umm HTML_ENTITY_NAME_MAX = 31;
+
+static const u16 html_entity_displacements[HTML_ENTITY_BUCKET_COUNT] =
+{
+    67, 2, 9, 94, 4, 0, 0, 13, 211, 10, 53, 16, 5, 146, 529, 32,
+    5, 26, 62, 10, 548, 2, 2, 18, 9, 2, 20, 2, 85, 89, 1, 32,
+    16, 88, 87, 57, 5, 0, 59, 35, 15, 20, 64, 33, 62, 101, 193, 24,
+    145, 0, 25, 29, 17, 0, 43, 84, 2, 64, 2, 225, 3, 6, 83, 1,
+    27, 0, 7, 1, 9, 0, 7, 10, 40, 24, 1, 64, 20, 190, 7, 25,
+    139, 0, 0, 7, 43, 255, 32, 0, 0, 79, 0, 1, 10, 6, 3, 32,
+    4, 57, 11, 4, 4, 209, 21, 489, 232, 26, 3, 27, 9, 36, 188, 29,
+    0, 28, 23, 73, 3, 152, 0, 156, 3, 10, 6, 6, 0, 0, 36, 0,
+    1, 5, 86, 0, 335, 44, 78, 79, 78, 15, 3, 173, 1, 1, 20, 4,
+    14, 33, 508, 0, 117, 1, 0, 79, 6, 19, 2, 508, 1, 97, 11, 0,
+    19, 195, 25, 6, 146, 0, 597, 12, 4, 17, 49, 2, 10, 5, 219, 212,
+    13, 2, 307, 150, 438, 2, 0, 0, 125, 6, 3, 0, 126, 207, 3, 4,
+    3, 0, 10, 1, 348, 102, 7, 0, 618, 8, 0, 145, 1, 291, 111, 2,
+    6, 7, 14, 10, 88, 1, 241, 62, 7, 114, 94, 0, 50, 116, 2, 135,
+    142, 87, 62, 358, 212, 49, 5, 25, 4, 1, 32, 220, 185, 59, 67, 0,
+    1, 47, 21, 217, 494, 5, 0, 3, 39, 25, 2, 470, 219, 15, 28, 22,
+    163, 45, 172, 296, 7, 301, 8, 15, 48, 435, 0, 1, 181, 21, 60, 150,
+    176, 0, 7, 185, 2, 279, 42, 443, 28, 471, 85, 86, 6, 0, 355, 64,
+    15, 585, 0, 9, 93, 84, 78, 13, 2, 1051, 12, 37, 28, 263, 1, 95,
+    540, 677, 0, 76, 20, 18, 504, 70, 3, 212, 1, 32, 574, 318, 5, 26,
+    18, 158, 246, 517, 140, 4, 1407, 80, 5, 768, 180, 170, 242, 0, 17, 535,
+    143, 6, 70, 0, 2, 857, 27, 40, 123, 82, 1012, 232, 1, 18, 120, 40,
+    0, 152, 376, 0, 9, 83, 51, 2, 20, 299, 77, 276, 66, 1, 354, 0,
+    39, 604, 71, 280, 2, 729, 26, 39, 20, 74, 1499, 109, 9, 379, 231, 85,
+    2, 2, 106, 176, 212, 0, 40, 0, 13, 3, 19, 293, 104, 520, 125, 223,
+    148, 26, 95, 14, 269, 51, 701, 35, 754, 366, 2376, 794, 19, 458, 345, 460,
+    4, 515, 25, 190, 4, 346, 10, 217, 7, 265, 213, 1, 14, 88, 1, 0,
+    565, 895, 0, 138, 28, 154, 118, 802, 4394, 1, 31, 0, 263, 96, 1, 15,
+    702, 4, 14, 1429, 173, 3036, 423, 8, 80, 224, 568, 7, 1059, 478, 27, 0,
+    130, 528, 1301, 9, 654, 9, 0, 283, 9, 2, 648, 0, 5, 43, 334, 810,
+    59, 0, 453, 3, 1337, 130, 12, 539, 153, 796, 10, 127, 863, 75, 639, 2579,
+    1, 0, 672, 4420, 136, 4, 15, 1289, 662, 3, 690, 477, 206, 2146, 2057, 1848,
+    94, 1427, 6, 30, 24, 15, 692, 0, 2424, 8, 14, 604, 7, 4432, 14, 89,
+    399, 1751, 362, 1486,
+};
+
+// Every name once, without the '&' and ';', in alphabetical order.
+static const char html_entity_names[] =
+    "AEligAMPAacuteAbreveAcircAcyAfrAgraveAlphaAmacrAndAogon"
+    "AopfApplyFunctionAringAscrAssignAtildeAumlBackslashBarvBarwedBcyBecause"
+    "BernoullisBetaBfrBopfBreveBscrBumpeqCHcyCOPYCacuteCapCapitalDifferentialD"
+    "CayleysCcaronCcedilCcircCconintCdotCedillaCenterDotCfrChiCircleDotCircleMinus"
+    "CirclePlusCircleTimesClockwiseContourIntegralCloseCurlyDoubleQuoteCloseCurlyQuoteColonColoneCongruentConintContourIntegralCopfCoproduct"
+    "CounterClockwiseContourIntegralCrossCscrCupCupCapDDDDotrahdDJcyDScyDZcyDaggerDarr"
+    "DashvDcaronDcyDelDeltaDfrDiacriticalAcuteDiacriticalDotDiacriticalDoubleAcuteDiacriticalGraveDiacriticalTildeDiamond"
+    "DifferentialDDopfDotDotDotDotEqualDoubleContourIntegralDoubleDotDoubleDownArrowDoubleLeftArrowDoubleLeftRightArrowDoubleLeftTeeDoubleLongLeftArrow"
+    "DoubleLongLeftRightArrowDoubleLongRightArrowDoubleRightArrowDoubleRightTeeDoubleUpArrowDoubleUpDownArrowDoubleVerticalBarDownArrowDownArrowBarDownArrowUpArrowDownBreveDownLeftRightVector"
+    "DownLeftTeeVectorDownLeftVectorDownLeftVectorBarDownRightTeeVectorDownRightVectorDownRightVectorBarDownTeeDownTeeArrowDownarrowDscrDstrokENG"
+    "ETHEacuteEcaronEcircEcyEdotEfrEgraveElementEmacrEmptySmallSquareEmptyVerySmallSquare"
+    "EogonEopfEpsilonEqualEqualTildeEquilibriumEscrEsimEtaEumlExistsExponentialE"
+    "FcyFfrFilledSmallSquareFilledVerySmallSquareFopfForAllFouriertrfFscrGJcyGTGammaGammad"
+    "GbreveGcedilGcircGcyGdotGfrGgGopfGreaterEqualGreaterEqualLessGreaterFullEqualGreaterGreater"
+    "GreaterLessGreaterSlantEqualGreaterTildeGscrGtHARDcyHacekHatHcircHfrHilbertSpaceHopf"
+    "HorizontalLineHscrHstrokHumpDownHumpHumpEqualIEcyIJligIOcyIacuteIcircIcyIdot"
+    "IfrIgraveImImacrImaginaryIImpliesIntIntegralIntersectionInvisibleCommaInvisibleTimesIogon"
+    "IopfIotaIscrItildeIukcyIumlJcircJcyJfrJopfJscrJsercy"
+    "JukcyKHcyKJcyKappaKcedilKcyKfrKopfKscrLJcyLTLacute"
+    "LambdaLangLaplacetrfLarrLcaronLcedilLcyLeftAngleBracketLeftArrowLeftArrowBarLeftArrowRightArrowLeftCeiling"
+    "LeftDoubleBracketLeftDownTeeVectorLeftDownVectorLeftDownVectorBarLeftFloorLeftRightArrowLeftRightVectorLeftTeeLeftTeeArrowLeftTeeVectorLeftTriangleLeftTriangleBar"
+    "LeftTriangleEqualLeftUpDownVectorLeftUpTeeVectorLeftUpVectorLeftUpVectorBarLeftVectorLeftVectorBarLeftarrowLeftrightarrowLessEqualGreaterLessFullEqualLessGreater"
+    "LessLessLessSlantEqualLessTildeLfrLlLleftarrowLmidotLongLeftArrowLongLeftRightArrowLongRightArrowLongleftarrowLongleftrightarrow"
+    "LongrightarrowLopfLowerLeftArrowLowerRightArrowLscrLshLstrokLtMapMcyMediumSpaceMellintrf"
+    "MfrMinusPlusMopfMscrMuNJcyNacuteNcaronNcedilNcyNegativeMediumSpaceNegativeThickSpace"
+    "NegativeThinSpaceNegativeVeryThinSpaceNestedGreaterGreaterNestedLessLessNewLineNfrNoBreakNonBreakingSpaceNopfNotNotCongruentNotCupCap"
+    "NotDoubleVerticalBarNotElementNotEqualNotEqualTildeNotExistsNotGreaterNotGreaterEqualNotGreaterFullEqualNotGreaterGreaterNotGreaterLessNotGreaterSlantEqualNotGreaterTilde"
+    "NotHumpDownHumpNotHumpEqualNotLeftTriangleNotLeftTriangleBarNotLeftTriangleEqualNotLessNotLessEqualNotLessGreaterNotLessLessNotLessSlantEqualNotLessTildeNotNestedGreaterGreater"
+    "NotNestedLessLessNotPrecedesNotPrecedesEqualNotPrecedesSlantEqualNotReverseElementNotRightTriangleNotRightTriangleBarNotRightTriangleEqualNotSquareSubsetNotSquareSubsetEqualNotSquareSupersetNotSquareSupersetEqual"
+    "NotSubsetNotSubsetEqualNotSucceedsNotSucceedsEqualNotSucceedsSlantEqualNotSucceedsTildeNotSupersetNotSupersetEqualNotTildeNotTildeEqualNotTildeFullEqualNotTildeTilde"
+    "NotVerticalBarNscrNtildeNuOEligOacuteOcircOcyOdblacOfrOgraveOmacr"
+    "OmegaOmicronOopfOpenCurlyDoubleQuoteOpenCurlyQuoteOrOscrOslashOtildeOtimesOumlOverBar"
+    "OverBraceOverBracketOverParenthesisPartialDPcyPfrPhiPiPlusMinusPoincareplanePopfPr"
+    "PrecedesPrecedesEqualPrecedesSlantEqualPrecedesTildePrimeProductProportionProportionalPscrPsiQUOTQfr"
+    "QopfQscrRBarrREGRacuteRangRarrRarrtlRcaronRcedilRcyRe"
+    "ReverseElementReverseEquilibriumReverseUpEquilibriumRfrRhoRightAngleBracketRightArrowRightArrowBarRightArrowLeftArrowRightCeilingRightDoubleBracketRightDownTeeVector"
+    "RightDownVectorRightDownVectorBarRightFloorRightTeeRightTeeArrowRightTeeVectorRightTriangleRightTriangleBarRightTriangleEqualRightUpDownVectorRightUpTeeVectorRightUpVector"
+    "RightUpVectorBarRightVectorRightVectorBarRightarrowRopfRoundImpliesRrightarrowRscrRshRuleDelayedSHCHcySHcy"
+    "SOFTcySacuteScScaronScedilScircScySfrShortDownArrowShortLeftArrowShortRightArrowShortUpArrow"
+    "SigmaSmallCircleSopfSqrtSquareSquareIntersectionSquareSubsetSquareSubsetEqualSquareSupersetSquareSupersetEqualSquareUnionSscr"
+    "StarSubSubsetSubsetEqualSucceedsSucceedsEqualSucceedsSlantEqualSucceedsTildeSuchThatSumSupSuperset"
+    "SupersetEqualSupsetTHORNTRADETSHcyTScyTabTauTcaronTcedilTcyTfr"
+    "ThereforeThetaThickSpaceThinSpaceTildeTildeEqualTildeFullEqualTildeTildeTopfTripleDotTscrTstrok"
+    "UacuteUarrUarrocirUbrcyUbreveUcircUcyUdblacUfrUgraveUmacrUnderBar"
+    "UnderBraceUnderBracketUnderParenthesisUnionUnionPlusUogonUopfUpArrowUpArrowBarUpArrowDownArrowUpDownArrowUpEquilibrium"
+    "UpTeeUpTeeArrowUparrowUpdownarrowUpperLeftArrowUpperRightArrowUpsiUpsilonUringUscrUtildeUuml"
+    "VDashVbarVcyVdashVdashlVeeVerbarVertVerticalBarVerticalLineVerticalSeparatorVerticalTilde"
+    "VeryThinSpaceVfrVopfVscrVvdashWcircWedgeWfrWopfWscrXfrXi"
+    "XopfXscrYAcyYIcyYUcyYacuteYcircYcyYfrYopfYscrYuml"
+    "ZHcyZacuteZcaronZcyZdotZeroWidthSpaceZetaZfrZopfZscraacuteabreve"
+    "acacEacdacircacuteacyaeligafafragravealefsymaleph"
+    "alphaamacramalgampandandandanddandslopeandvangangeangle"
+    "angmsdangmsdaaangmsdabangmsdacangmsdadangmsdaeangmsdafangmsdagangmsdahangrtangrtvbangrtvbd"
+    "angsphangstangzarraogonaopfapapEapacirapeapidaposapprox"
+    "approxeqaringascrastasympasympeqatildeaumlawconintawintbNotbackcong"
+    "backepsilonbackprimebacksimbacksimeqbarveebarwedbarwedgebbrkbbrktbrkbcongbcybdquo"
+    "becausbecausebemptyvbepsibernoubetabethbetweenbfrbigcapbigcircbigcup"
+    "bigodotbigoplusbigotimesbigsqcupbigstarbigtriangledownbigtriangleupbiguplusbigveebigwedgebkarowblacklozenge"
+    "blacksquareblacktriangleblacktriangledownblacktriangleleftblacktrianglerightblankblk12blk14blk34blockbnebnequiv"
+    "bnotbopfbotbottombowtieboxDLboxDRboxDlboxDrboxHboxHDboxHU"
+    "boxHdboxHuboxULboxURboxUlboxUrboxVboxVHboxVLboxVRboxVhboxVl"
+    "boxVrboxboxboxdLboxdRboxdlboxdrboxhboxhDboxhUboxhdboxhuboxminus"
+    "boxplusboxtimesboxuLboxuRboxulboxurboxvboxvHboxvLboxvRboxvhboxvl"
+    "boxvrbprimebrevebrvbarbscrbsemibsimbsimebsolbsolbbsolhsubbull"
+    "bulletbumpbumpEbumpebumpeqcacutecapcapandcapbrcupcapcapcapcupcapdot"
+    "capscaretcaronccapsccaronccedilccircccupsccupssmcdotcedilcemptyv"
+    "centcenterdotcfrchcycheckcheckmarkchicircirEcirccirceqcirclearrowleft"
+    "circlearrowrightcircledRcircledScircledastcircledcirccircleddashcirecirfnintcirmidcirscirclubsclubsuit"
+    "coloncolonecoloneqcommacommatcompcompfncomplementcomplexescongcongdotconint"
+    "copfcoprodcopycopysrcrarrcrosscscrcsubcsubecsupcsupectdot"
+    "cudarrlcudarrrcueprcuesccularrcularrpcupcupbrcapcupcapcupcupcupdotcupor"
+    "cupscurarrcurarrmcurlyeqpreccurlyeqsucccurlyveecurlywedgecurrencurvearrowleftcurvearrowrightcuveecuwed"
+    "cwconintcwintcylctydArrdHardaggerdalethdarrdashdashvdbkarowdblac"
+    "dcarondcyddddaggerddarrddotseqdegdeltademptyvdfishtdfrdharl"
+    "dharrdiamdiamonddiamondsuitdiamsdiedigammadisindivdividedivideontimesdivonx"
+    "djcydlcorndlcropdollardopfdotdoteqdoteqdotdotminusdotplusdotsquaredoublebarwedge"
+    "downarrowdowndownarrowsdownharpoonleftdownharpoonrightdrbkarowdrcorndrcropdscrdscydsoldstrokdtdot"
+    "dtridtrifduarrduhardwangledzcydzigrarreDDoteDoteacuteeasterecaron"
+    "ecirecircecolonecyedoteeefDotefregegraveegsegsdot"
+    "elelintersellelselsdotemacremptyemptysetemptyvemspemsp13emsp14"
+    "engenspeogoneopfepareparsleplusepsiepsilonepsiveqcirceqcolon"
+    "eqsimeqslantgtreqslantlessequalsequestequivequivDDeqvparslerDoterarrescresdot"
+    "esimetaetheumleuroexclexistexpectationexponentialefallingdotseqfcyfemale"
+    "ffiligffligfflligffrfiligfjligflatflligfltnsfnoffopfforall"
+    "forkforkvfpartintfrac12frac13frac14frac15frac16frac18frac23frac25frac34"
+    "frac35frac38frac45frac56frac58frac78fraslfrownfscrgEgElgacute"
+    "gammagammadgapgbrevegcircgcygdotgegelgeqgeqqgeqslant"
+    "gesgesccgesdotgesdotogesdotolgeslgeslesgfrggggggimelgjcy"
+    "glglEglagljgnEgnapgnapproxgnegneqgneqqgnsimgopf"
+    "gravegscrgsimgsimegsimlgtgtccgtcirgtdotgtlPargtquestgtrapprox"
+    "gtrarrgtrdotgtreqlessgtreqqlessgtrlessgtrsimgvertneqqgvnEhArrhairsphalfhamilt"
+    "hardcyharrharrcirharrwhbarhcircheartsheartsuithellipherconhfrhksearow"
+    "hkswarowhoarrhomththookleftarrowhookrightarrowhopfhorbarhscrhslashhstrokhybullhyphen"
+    "iacuteicicircicyiecyiexcliffifrigraveiiiiiintiiint"
+    "iinfiniiotaijligimacrimageimaglineimagpartimathimofimpedinincare"
+    "infininfintieinodotintintcalintegersintercalintlarhkintprodiocyiogoniopf"
+    "iotaiprodiquestiscrisinisinEisindotisinsisinsvisinvititilde"
+    "iukcyiumljcircjcyjfrjmathjopfjscrjsercyjukcykappakappav"
+    "kcedilkcykfrkgreenkhcykjcykopfkscrlAarrlArrlAtaillBarr"
+    "lElEglHarlacutelaemptyvlagranlambdalanglangdlanglelaplaquo"
+    "larrlarrblarrbfslarrfslarrhklarrlplarrpllarrsimlarrtllatlataillate"
+    "lateslbarrlbbrklbracelbracklbrkelbrksldlbrkslulcaronlcedillceillcub"
+    "lcyldcaldquoldquorldrdharldrusharldshleleftarrowleftarrowtailleftharpoondownleftharpoonup"
+    "leftleftarrowsleftrightarrowleftrightarrowsleftrightharpoonsleftrightsquigarrowleftthreetimeslegleqleqqleqslantleslescc"
+    "lesdotlesdotolesdotorlesglesgeslessapproxlessdotlesseqgtrlesseqqgtrlessgtrlesssimlfisht"
+    "lfloorlfrlglgElhardlharulharullhblkljcyllllarrllcorner"
+    "llhardlltrilmidotlmoustlmoustachelnElnaplnapproxlnelneqlneqqlnsim"
+    "loangloarrlobrklongleftarrowlongleftrightarrowlongmapstolongrightarrowlooparrowleftlooparrowrightloparlopfloplus"
+    "lotimeslowastlowbarlozlozengelozflparlparltlrarrlrcornerlrharlrhard"
+    "lrmlrtrilsaquolscrlshlsimlsimelsimglsqblsquolsquorlstrok"
+    "ltltccltcirltdotlthreeltimesltlarrltquestltrParltriltrieltrif"
+    "lurdsharluruharlvertneqqlvnEmDDotmacrmalemaltmaltesemapmapstomapstodown"
+    "mapstoleftmapstoupmarkermcommamcymdashmeasuredanglemfrmhomicromidmidast"
+    "midcirmiddotminusminusbminusdminusdumlcpmldrmnplusmodelsmopfmp"
+    "mscrmstposmumultimapmumapnGgnGtnGtvnLeftarrownLeftrightarrownLlnLt"
+    "nLtvnRightarrownVDashnVdashnablanacutenangnapnapEnapidnaposnapprox"
+    "naturnaturalnaturalsnbspnbumpnbumpencapncaronncedilncongncongdotncup"
+    "ncyndashneneArrnearhknearrnearrownedotnequivnesearnesimnexist"
+    "nexistsnfrngEngengeqngeqqngeqslantngesngsimngtngtrnhArr"
+    "nharrnhparninisnisdnivnjcynlArrnlEnlarrnldrnle"
+    "nleftarrownleftrightarrownleqnleqqnleqslantnlesnlessnlsimnltnltrinltrienmid"
+    "nopfnotnotinnotinEnotindotnotinvanotinvbnotinvcnotninotnivanotnivbnotnivc"
+    "nparnparallelnparslnpartnpolintnprnprcuenprenprecnpreceqnrArrnrarr"
+    "nrarrcnrarrwnrightarrownrtrinrtrienscnsccuenscenscrnshortmidnshortparallelnsim"
+    "nsimensimeqnsmidnsparnsqsubensqsupensubnsubEnsubensubsetnsubseteqnsubseteqq"
+    "nsuccnsucceqnsupnsupEnsupensupsetnsupseteqnsupseteqqntglntildentlgntriangleleft"
+    "ntrianglelefteqntrianglerightntrianglerighteqnunumnumeronumspnvDashnvHarrnvapnvdashnvge"
+    "nvgtnvinfinnvlArrnvlenvltnvltrienvrArrnvrtrienvsimnwArrnwarhknwarr"
+    "nwarrownwnearoSoacuteoastocirocircocyodashodblacodivodot"
+    "odsoldoeligofcirofrogonograveogtohbarohmointolarrolcir"
+    "olcrossolineoltomacromegaomicronomidominusoopfoparoperpoplus"
+    "ororarrordorderorderofordfordmorigoforororslopeorvoscr"
+    "oslashosolotildeotimesotimesasoumlovbarparparaparallelparsimparsl"
+    "partpcypercntperiodpermilperppertenkpfrphiphivphmmatphone"
+    "pipitchforkpivplanckplanckhplankvplusplusacirplusbpluscirplusdoplusdu"
+    "pluseplusmnplussimplustwopmpointintpopfpoundprprEprapprcue"
+    "preprecprecapproxpreccurlyeqpreceqprecnapproxprecneqqprecnsimprecsimprimeprimesprnE"
+    "prnapprnsimprodprofalarproflineprofsurfpropproptoprsimprurelpscrpsi"
+    "puncspqfrqintqopfqprimeqscrquaternionsquatintquestquesteqquotrAarr"
+    "rArrrAtailrBarrrHarraceracuteradicraemptyvrangrangdrangerangle"
+    "raquorarrrarraprarrbrarrbfsrarrcrarrfsrarrhkrarrlprarrplrarrsimrarrtl"
+    "rarrwratailratiorationalsrbarrrbbrkrbracerbrackrbrkerbrksldrbrkslurcaron"
+    "rcedilrceilrcubrcyrdcardldharrdquordquorrdshrealrealinerealpart"
+    "realsrectregrfishtrfloorrfrrhardrharurharulrhorhovrightarrow"
+    "rightarrowtailrightharpoondownrightharpoonuprightleftarrowsrightleftharpoonsrightrightarrowsrightsquigarrowrightthreetimesringrisingdotseqrlarrrlhar"
+    "rlmrmoustrmoustachernmidroangroarrrobrkroparropfroplusrotimesrpar"
+    "rpargtrppolintrrarrrsaquorscrrshrsqbrsquorsquorrthreertimesrtri"
+    "rtriertrifrtriltriruluharrxsacutesbquoscscEscapscaronsccue"
+    "scescedilscircscnEscnapscnsimscpolintscsimscysdotsdotbsdote"
+    "seArrsearhksearrsearrowsectsemiseswarsetminussetmnsextsfrsfrown"
+    "sharpshchcyshcyshortmidshortparallelshysigmasigmafsigmavsimsimdotsime"
+    "simeqsimgsimgEsimlsimlEsimnesimplussimrarrslarrsmallsetminussmashpsmeparsl"
+    "smidsmilesmtsmtesmtessoftcysolsolbsolbarsopfspadesspadesuit"
+    "sparsqcapsqcapssqcupsqcupssqsubsqsubesqsubsetsqsubseteqsqsupsqsupesqsupset"
+    "sqsupseteqsqusquaresquarfsqufsrarrsscrssetmnssmilesstarfstarstarf"
+    "straightepsilonstraightphistrnssubsubEsubdotsubesubedotsubmultsubnEsubnesubplus"
+    "subrarrsubsetsubseteqsubseteqqsubsetneqsubsetneqqsubsimsubsubsubsupsuccsuccapproxsucccurlyeq"
+    "succeqsuccnapproxsuccneqqsuccnsimsuccsimsumsungsupsup1sup2sup3supE"
+    "supdotsupdsubsupesupedotsuphsolsuphsubsuplarrsupmultsupnEsupnesupplussupset"
+    "supseteqsupseteqqsupsetneqsupsetneqqsupsimsupsubsupsupswArrswarhkswarrswarrowswnwar"
+    "szligtargettautbrktcarontcediltcytdottelrectfrthere4therefore"
+    "thetathetasymthetavthickapproxthicksimthinspthkapthksimthorntildetimestimesb"
+    "timesbartimesdtinttoeatoptopbottopcirtopftopforktosatprimetrade"
+    "triangletriangledowntrianglelefttrianglelefteqtriangleqtrianglerighttrianglerighteqtridottrietriminustriplustrisb"
+    "tritimetrpeziumtscrtscytshcytstroktwixttwoheadleftarrowtwoheadrightarrowuArruHaruacute"
+    "uarrubrcyubreveucircucyudarrudblacudharufishtufrugraveuharl"
+    "uharruhblkulcornulcornerulcropultriumacrumluogonuopfuparrowupdownarrow"
+    "upharpoonleftupharpoonrightuplusupsiupsihupsilonupuparrowsurcornurcornerurcropuringurtri"
+    "uscrutdotutildeutriutrifuuarruumluwanglevArrvBarvBarvvDash"
+    "vangrtvarepsilonvarkappavarnothingvarphivarpivarproptovarrvarrhovarsigmavarsubsetneqvarsubsetneqq"
+    "varsupsetneqvarsupsetneqqvarthetavartriangleleftvartrianglerightvcyvdashveeveebarveeeqvellipverbar"
+    "vertvfrvltrivnsubvnsupvopfvpropvrtrivscrvsubnEvsubnevsupnE"
+    "vsupnevzigzagwcircwedbarwedgewedgeqweierpwfrwopfwpwrwreath"
+    "wscrxcapxcircxcupxdtrixfrxhArrxharrxixlArrxlarrxmap"
+    "xnisxodotxopfxoplusxotimexrArrxrarrxscrxsqcupxuplusxutrixvee"
+    "xwedgeyacuteyacyycircycyyenyfryicyyopfyscryucyyuml"
+    "zacutezcaronzcyzdotzeetrfzetazfrzhcyzigrarrzopfzscrzwj"
+    "zwnj"
+;
+
+// In hash slot order.
+static const HTML_Entity html_entities[HTML_ENTITY_COUNT] =
+{
+    { 11979,  5, 3, { 0xE2, 0x89, 0xBF } },  // scsim
+    { 10882,  4, 3, { 0xE2, 0x88, 0x82 } },  // part
+    { 10297,  5, 3, { 0xE2, 0x88, 0xA4 } },  // nsmid
+    { 11225,  4, 3, { 0xE2, 0xA8, 0x8C } },  // qint
+    {  1802,  3, 2, { 0xD0, 0x9B } },  // Lcy
+    {  3657, 12, 3, { 0xE2, 0x88, 0x9D } },  // Proportional
+    {  1796,  6, 2, { 0xC4, 0xBB } },  // Lcedil
+    { 13836,  4, 3, { 0xE2, 0x8B, 0xBB } },  // xnis
+    { 11338,  6, 3, { 0xE2, 0x9F, 0xA9 } },  // rangle
+    {    59, 13, 3, { 0xE2, 0x81, 0xA1 } },  // ApplyFunction
+    {  7251,  6, 2, { 0xC3, 0xA8 } },  // egrave
+    {  4139, 11, 3, { 0xE2, 0x87, 0x9B } },  // Rrightarrow
+    {  1046, 12, 3, { 0xE2, 0x86, 0xA7 } },  // DownTeeArrow
+    { 12830,  3, 2, { 0xD1, 0x82 } },  // tcy
+    {  2533, 20, 3, { 0xE2, 0x89, 0xAB } },  // NestedGreaterGreater
+    {  8766, 13, 3, { 0xE2, 0x86, 0xA2 } },  // leftarrowtail
+    {  5185,  3, 5, { 0xE2, 0x88, 0xBE, 0xCC, 0xB3 } },  // acE
+    {  7800,  8, 3, { 0xE2, 0xAA, 0x84 } },  // gesdotol
+    {  7831,  4, 2, { 0xD1, 0x93 } },  // gjcy
+    {  5928,  5, 3, { 0xE2, 0x95, 0xA7 } },  // boxHu
+    { 11780,  5, 3, { 0xE2, 0x9F, 0xAD } },  // roang
+    {  6664,  6, 3, { 0xE2, 0x8A, 0x8D } },  // cupdot
+    { 13055, 13, 3, { 0xE2, 0x96, 0xB9 } },  // triangleright
+    {  8438,  5, 2, { 0xC8, 0xB7 } },  // jmath
+    { 13282,  6, 3, { 0xE2, 0x8C, 0x8F } },  // ulcrop
+    {  7312,  4, 3, { 0xE2, 0x80, 0x83 } },  // emsp
+    {  7873,  5, 3, { 0xE2, 0x8B, 0xA7 } },  // gnsim
+    {  5933,  5, 3, { 0xE2, 0x95, 0x9D } },  // boxUL
+    { 10950,  3, 2, { 0xCF, 0x96 } },  // piv
+    {   470,  4, 2, { 0xD0, 0x82 } },  // DJcy
+    {  7843,  3, 3, { 0xE2, 0xAA, 0xA4 } },  // glj
+    {  4088, 11, 3, { 0xE2, 0x87, 0x80 } },  // RightVector
+    {  9692,  3, 5, { 0xE2, 0x8B, 0x98, 0xCC, 0xB8 } },  // nLl
+    {   569, 16, 1, { 0x60 } },  // DiacriticalGrave
+    {  6975,  4, 2, { 0xD1, 0x92 } },  // djcy
+    {  5535,  6, 3, { 0xE2, 0x8A, 0xBD } },  // barvee
+    {  9238,  6, 3, { 0xE2, 0xA8, 0xAD } },  // loplus
+    {  8736,  7, 3, { 0xE2, 0xA5, 0xA7 } },  // ldrdhar
+    {  5196,  5, 2, { 0xC2, 0xB4 } },  // acute
+    {  9747,  5, 5, { 0xE2, 0x89, 0x8B, 0xCC, 0xB8 } },  // napid
+    {  2423,  4, 4, { 0xF0, 0x9D, 0x95, 0x84 } },  // Mopf
+    {  7117,  6, 3, { 0xE2, 0x8C, 0x9F } },  // drcorn
+    { 10028,  9, 5, { 0xE2, 0xA9, 0xBD, 0xCC, 0xB8 } },  // nleqslant
+    { 12725,  9, 3, { 0xE2, 0xAB, 0x86 } },  // supseteqq
+    {  7987,  9, 6, { 0xE2, 0x89, 0xA9, 0xEF, 0xB8, 0x80 } },  // gvertneqq
+    {  9832,  3, 2, { 0xD0, 0xBD } },  // ncy
+    {  6824,  5, 3, { 0xE2, 0x8A, 0xA3 } },  // dashv
+    {  9553,  3, 3, { 0xE2, 0x84, 0xA7 } },  // mho
+    {  5171,  6, 2, { 0xC3, 0xA1 } },  // aacute
+    { 11715, 15, 3, { 0xE2, 0x8B, 0x8C } },  // rightthreetimes
+    { 10934,  5, 3, { 0xE2, 0x98, 0x8E } },  // phone
+    {  2607, 12, 3, { 0xE2, 0x89, 0xA2 } },  // NotCongruent
+    { 11557,  3, 2, { 0xC2, 0xAE } },  // reg
+    { 12046,  5, 3, { 0xE2, 0x88, 0x96 } },  // setmn
+    {  8201,  3, 4, { 0xF0, 0x9D, 0x94, 0xA6 } },  // ifr
+    {  1548,  5, 2, { 0xC4, 0xB2 } },  // IJlig
+    {  5629,  6, 3, { 0xE2, 0x8B, 0x82 } },  // bigcap
+    {  7554,  3, 4, { 0xF0, 0x9D, 0x94, 0xA3 } },  // ffr
+    {  7755,  4, 2, { 0xC4, 0xA1 } },  // gdot
+    {  2648, 10, 3, { 0xE2, 0x88, 0x89 } },  // NotElement
+    {  3680,  3, 4, { 0xF0, 0x9D, 0x94, 0x94 } },  // Qfr
+    {  5859,  7, 6, { 0xE2, 0x89, 0xA1, 0xE2, 0x83, 0xA5 } },  // bnequiv
+    { 11213,  3, 2, { 0xCF, 0x88 } },  // psi
+    {  3411,  5, 2, { 0xC5, 0x8C } },  // Omacr
+    { 11746,  5, 3, { 0xE2, 0x87, 0x84 } },  // rlarr
+    {  3788,  3, 3, { 0xE2, 0x84, 0x9C } },  // Rfr
+    {  8957, 10, 3, { 0xE2, 0xAA, 0x85 } },  // lessapprox
+    {  6394,  8, 3, { 0xE2, 0x93, 0x88 } },  // circledS
+    {  3396,  6, 2, { 0xC5, 0x90 } },  // Odblac
+    {  1095,  5, 2, { 0xC3, 0x8A } },  // Ecirc
+    {  7571,  5, 3, { 0xEF, 0xAC, 0x82 } },  // fllig
+    { 13238,  6, 3, { 0xE2, 0xA5, 0xBE } },  // ufisht
+    {  5317,  8, 3, { 0xE2, 0xA6, 0xAB } },  // angmsdad
+    {  9948,  5, 3, { 0xE2, 0x86, 0xAE } },  // nharr
+    {  5655,  8, 3, { 0xE2, 0xA8, 0x81 } },  // bigoplus
+    { 12114,  6, 2, { 0xCF, 0x82 } },  // sigmav
+    {  9610,  4, 3, { 0xE2, 0x80, 0xA6 } },  // mldr
+    {  1591, 10, 3, { 0xE2, 0x85, 0x88 } },  // ImaginaryI
+    {  7636,  6, 3, { 0xE2, 0x85, 0x99 } },  // frac16
+    { 12989,  6, 3, { 0xE2, 0x80, 0xB4 } },  // tprime
+    {   735, 19, 3, { 0xE2, 0x9F, 0xB8 } },  // DoubleLongLeftArrow
+    {  6874,  5, 2, { 0xCE, 0xB4 } },  // delta
+    { 13474,  6, 3, { 0xE2, 0xA6, 0x9C } },  // vangrt
+    { 10307,  7, 3, { 0xE2, 0x8B, 0xA2 } },  // nsqsube
+    {  3416,  5, 2, { 0xCE, 0xA9 } },  // Omega
+    {  6202,  3, 3, { 0xE2, 0x88, 0xA9 } },  // cap
+    { 10817,  6, 2, { 0xC3, 0xB8 } },  // oslash
+    {  7943,  6, 3, { 0xE2, 0xA5, 0xB8 } },  // gtrarr
+    {  6301,  4, 2, { 0xC2, 0xA2 } },  // cent
+    {  9287,  5, 3, { 0xE2, 0x87, 0x86 } },  // lrarr
+    { 13068, 15, 3, { 0xE2, 0x8A, 0xB5 } },  // trianglerighteq
+    {  6452,  7, 3, { 0xE2, 0xA7, 0x82 } },  // cirscir
+    {  2991, 11, 3, { 0xE2, 0x8A, 0x80 } },  // NotPrecedes
+    { 11960,  5, 3, { 0xE2, 0xAA, 0xBA } },  // scnap
+    {  2385,  3, 3, { 0xE2, 0xA4, 0x85 } },  // Map
+    {  5580,  6, 3, { 0xE2, 0x88, 0xB5 } },  // becaus
+    {  7835,  2, 3, { 0xE2, 0x89, 0xB7 } },  // gl
+    {  3553,  2, 2, { 0xCE, 0xA0 } },  // Pi
+    {  4603, 14, 3, { 0xE2, 0x89, 0x85 } },  // TildeFullEqual
+    {  4579,  9, 3, { 0xE2, 0x80, 0x89 } },  // ThinSpace
+    { 11996,  5, 3, { 0xE2, 0xA9, 0xA6 } },  // sdote
+    {  8580,  5, 2, { 0xC2, 0xAB } },  // laquo
+    {  3510, 11, 3, { 0xE2, 0x8E, 0xB4 } },  // OverBracket
+    {   411, 31, 3, { 0xE2, 0x88, 0xB3 } },  // CounterClockwiseContourIntegral
+    {  8000,  4, 3, { 0xE2, 0x87, 0x94 } },  // hArr
+    {  9311,  3, 3, { 0xE2, 0x80, 0x8E } },  // lrm
+    {  5755, 11, 3, { 0xE2, 0x96, 0xAA } },  // blacksquare
+    {   547, 22, 2, { 0xCB, 0x9D } },  // DiacriticalDoubleAcute
+    {  6772,  5, 3, { 0xE2, 0x8B, 0x8F } },  // cuwed
+    {  2458, 19, 3, { 0xE2, 0x80, 0x8B } },  // NegativeMediumSpace
+    {  9840,  2, 3, { 0xE2, 0x89, 0xA0 } },  // ne
+    {  4150,  4, 3, { 0xE2, 0x84, 0x9B } },  // Rscr
+    { 11927,  4, 3, { 0xE2, 0xAA, 0xB8 } },  // scap
+    {  6180,  5, 3, { 0xE2, 0xAA, 0xAE } },  // bumpE
+    {  8661,  5, 3, { 0xE2, 0x9D, 0xB2 } },  // lbbrk
+    {   140,  3, 4, { 0xF0, 0x9D, 0x94, 0x85 } },  // Bfr
+    {  8690,  7, 3, { 0xE2, 0xA6, 0x8D } },  // lbrkslu
+    { 10847,  4, 2, { 0xC3, 0xB6 } },  // ouml
+    { 10302,  5, 3, { 0xE2, 0x88, 0xA6 } },  // nspar
+    {   702, 20, 3, { 0xE2, 0x87, 0x94 } },  // DoubleLeftRightArrow
+    {  4758,  9, 3, { 0xE2, 0x8A, 0x8E } },  // UnionPlus
+    { 13046,  9, 3, { 0xE2, 0x89, 0x9C } },  // triangleq
+    { 11622, 16, 3, { 0xE2, 0x87, 0x81 } },  // rightharpoondown
+    {  3365,  4, 4, { 0xF0, 0x9D, 0x92, 0xA9 } },  // Nscr
+    {  6349,  6, 3, { 0xE2, 0x89, 0x97 } },  // circeq
+    { 13832,  4, 3, { 0xE2, 0x9F, 0xBC } },  // xmap
+    { 12460,  7, 3, { 0xE2, 0xAB, 0x81 } },  // submult
+    {  1077,  3, 2, { 0xC5, 0x8A } },  // ENG
+    { 10208,  6, 5, { 0xE2, 0xA4, 0xB3, 0xCC, 0xB8 } },  // nrarrc
+    {  4534,  3, 2, { 0xCE, 0xA4 } },  // Tau
+    {  9931,  5, 3, { 0xE2, 0x89, 0xB5 } },  // ngsim
+    {  9137,  5, 3, { 0xE2, 0x87, 0xBD } },  // loarr
+    {  3072, 19, 5, { 0xE2, 0xA7, 0x90, 0xCC, 0xB8 } },  // NotRightTriangleBar
+    {  9084,  6, 3, { 0xE2, 0x8E, 0xB0 } },  // lmoust
+    { 13789,  4, 3, { 0xE2, 0x8B, 0x82 } },  // xcap
+    {    97,  9, 3, { 0xE2, 0x88, 0x96 } },  // Backslash
+    {  1842, 19, 3, { 0xE2, 0x87, 0x86 } },  // LeftArrowRightArrow
+    { 11344,  5, 2, { 0xC2, 0xBB } },  // raquo
+    {  5611,  4, 2, { 0xCE, 0xB2 } },  // beta
+    {  1089,  6, 2, { 0xC4, 0x9A } },  // Ecaron
+    {  9215, 14, 3, { 0xE2, 0x86, 0xAC } },  // looparrowright
+    {  1776, 10, 3, { 0xE2, 0x84, 0x92 } },  // Laplacetrf
+    { 13258,  5, 3, { 0xE2, 0x86, 0xBE } },  // uharr
+    {  9994, 10, 3, { 0xE2, 0x86, 0x9A } },  // nleftarrow
+    {  9870,  6, 3, { 0xE2, 0x89, 0xA2 } },  // nequiv
+    { 13193,  6, 2, { 0xC3, 0xBA } },  // uacute
+    { 13638,  5, 3, { 0xE2, 0x8A, 0xA2 } },  // vdash
+    { 10531,  7, 3, { 0xE2, 0xA7, 0x9E } },  // nvinfin
+    { 12648,  7, 3, { 0xE2, 0xAB, 0x98 } },  // supdsub
+    {  5663,  9, 3, { 0xE2, 0xA8, 0x82 } },  // bigotimes
+    {  2840, 18, 5, { 0xE2, 0xA7, 0x8F, 0xCC, 0xB8 } },  // NotLeftTriangleBar
+    {  7581,  4, 2, { 0xC6, 0x92 } },  // fnof
+    {  6080,  4, 3, { 0xE2, 0x94, 0x82 } },  // boxv
+    { 11817,  4, 1, { 0x29 } },  // rpar
+    {  3466,  2, 3, { 0xE2, 0xA9, 0x94 } },  // Or
+    { 11413,  5, 3, { 0xE2, 0x86, 0x9D } },  // rarrw
+    {  6289,  5, 2, { 0xC2, 0xB8 } },  // cedil
+    {  5519,  7, 3, { 0xE2, 0x88, 0xBD } },  // backsim
+    {  3669,  4, 4, { 0xF0, 0x9D, 0x92, 0xAB } },  // Pscr
+    { 12028,  4, 1, { 0x3B } },  // semi
+    { 13802,  5, 3, { 0xE2, 0x96, 0xBD } },  // xdtri
+    {  8179,  2, 3, { 0xE2, 0x81, 0xA3 } },  // ic
+    { 10889,  6, 1, { 0x25 } },  // percnt
+    {  4948,  3, 3, { 0xE2, 0x8B, 0x81 } },  // Vee
+    { 12765,  6, 3, { 0xE2, 0xAB, 0x96 } },  // supsup
+    { 12905,  5, 3, { 0xE2, 0x89, 0x88 } },  // thkap
+    {  5841,  5, 3, { 0xE2, 0x96, 0x91 } },  // blk14
+    { 10142,  4, 3, { 0xE2, 0x88, 0xA6 } },  // npar
+    {  8257,  8, 3, { 0xE2, 0x84, 0x91 } },  // imagpart
+    {  7359,  4, 2, { 0xCE, 0xB5 } },  // epsi
+    {  9452,  4, 6, { 0xE2, 0x89, 0xA8, 0xEF, 0xB8, 0x80 } },  // lvnE
+    { 13136,  5, 2, { 0xD1, 0x9B } },  // tshcy
+    {  9626,  4, 4, { 0xF0, 0x9D, 0x95, 0x9E } },  // mopf
+    {  9234,  4, 4, { 0xF0, 0x9D, 0x95, 0x9D } },  // lopf
+    { 12069,  6, 2, { 0xD1, 0x89 } },  // shchcy
+    { 11529,  4, 3, { 0xE2, 0x84, 0x9C } },  // real
+    {  1575,  3, 3, { 0xE2, 0x84, 0x91 } },  // Ifr
+    {  1682,  5, 2, { 0xD0, 0x86 } },  // Iukcy
+    {  8265,  5, 2, { 0xC4, 0xB1 } },  // imath
+    { 13923,  3, 4, { 0xF0, 0x9D, 0x94, 0xB6 } },  // yfr
+    {   957, 14, 3, { 0xE2, 0x86, 0xBD } },  // DownLeftVector
+    { 11388,  6, 3, { 0xE2, 0x86, 0xAC } },  // rarrlp
+    { 13604, 15, 3, { 0xE2, 0x8A, 0xB2 } },  // vartriangleleft
+    {  8089,  8, 3, { 0xE2, 0xA4, 0xA6 } },  // hkswarow
+    {   250,  3, 3, { 0xE2, 0x84, 0xAD } },  // Cfr
+    {  1676,  6, 2, { 0xC4, 0xA8 } },  // Itilde
+    {    93,  4, 2, { 0xC3, 0x84 } },  // Auml
+    {  5559,  8, 3, { 0xE2, 0x8E, 0xB6 } },  // bbrktbrk
+    { 10231,  5, 3, { 0xE2, 0x8B, 0xAB } },  // nrtri
+    { 13775,  2, 3, { 0xE2, 0x84, 0x98 } },  // wp
+    {  3734,  2, 3, { 0xE2, 0x84, 0x9C } },  // Re
+    {  7375,  6, 3, { 0xE2, 0x89, 0x96 } },  // eqcirc
+    {  4290,  4, 3, { 0xE2, 0x88, 0x9A } },  // Sqrt
+    {  6557,  4, 2, { 0xC2, 0xA9 } },  // copy
+    {  3736, 14, 3, { 0xE2, 0x88, 0x8B } },  // ReverseElement
+    {  2229,  2, 3, { 0xE2, 0x8B, 0x98 } },  // Ll
+    {  6641,  3, 3, { 0xE2, 0x88, 0xAA } },  // cup
+    {  3186,  9, 6, { 0xE2, 0x8A, 0x82, 0xE2, 0x83, 0x92 } },  // NotSubset
+    { 10600,  6, 3, { 0xE2, 0xA4, 0xA7 } },  // nwnear
+    {  3768, 20, 3, { 0xE2, 0xA5, 0xAF } },  // ReverseUpEquilibrium
+    { 11652, 15, 3, { 0xE2, 0x87, 0x84 } },  // rightleftarrows
+    {  8355,  4, 4, { 0xF0, 0x9D, 0x95, 0x9A } },  // iopf
+    {  2732, 17, 5, { 0xE2, 0x89, 0xAB, 0xCC, 0xB8 } },  // NotGreaterGreater
+    {  9350,  5, 3, { 0xE2, 0x80, 0x98 } },  // lsquo
+    {    55,  4, 4, { 0xF0, 0x9D, 0x94, 0xB8 } },  // Aopf
+    {  5831,  5, 3, { 0xE2, 0x90, 0xA3 } },  // blank
+    { 12453,  7, 3, { 0xE2, 0xAB, 0x83 } },  // subedot
+    {  8566,  5, 3, { 0xE2, 0xA6, 0x91 } },  // langd
+    { 11035,  8, 3, { 0xE2, 0xA8, 0x95 } },  // pointint
+    {  4190,  2, 3, { 0xE2, 0xAA, 0xBC } },  // Sc
+    {  7771,  8, 3, { 0xE2, 0xA9, 0xBE } },  // geqslant
+    {  5615,  4, 3, { 0xE2, 0x84, 0xB6 } },  // beth
+    {   126, 10, 3, { 0xE2, 0x84, 0xAC } },  // Bernoullis
+    {  9918,  9, 5, { 0xE2, 0xA9, 0xBE, 0xCC, 0xB8 } },  // ngeqslant
+    {  3853, 12, 3, { 0xE2, 0x8C, 0x89 } },  // RightCeiling
+    {  3821, 13, 3, { 0xE2, 0x87, 0xA5 } },  // RightArrowBar
+    {  7808,  4, 6, { 0xE2, 0x8B, 0x9B, 0xEF, 0xB8, 0x80 } },  // gesl
+    { 11924,  3, 3, { 0xE2, 0xAA, 0xB4 } },  // scE
+    { 10984,  5, 3, { 0xE2, 0x8A, 0x9E } },  // plusb
+    { 11485,  6, 2, { 0xC5, 0x97 } },  // rcedil
+    {  5449,  3, 1, { 0x2A } },  // ast
+    {  9784,  4, 2, { 0xC2, 0xA0 } },  // nbsp
+    { 13416,  4, 4, { 0xF0, 0x9D, 0x93, 0x8A } },  // uscr
+    {  6956, 13, 3, { 0xE2, 0x8B, 0x87 } },  // divideontimes
+    {  7492, 11, 3, { 0xE2, 0x84, 0xB0 } },  // expectation
+    {  7109,  8, 3, { 0xE2, 0xA4, 0x90 } },  // drbkarow
+    {  9532,  5, 3, { 0xE2, 0x80, 0x94 } },  // mdash
+    { 13657,  6, 3, { 0xE2, 0x8B, 0xAE } },  // vellip
+    {  3564, 13, 3, { 0xE2, 0x84, 0x8C } },  // Poincareplane
+    {  3555,  9, 2, { 0xC2, 0xB1 } },  // PlusMinus
+    {  3750, 18, 3, { 0xE2, 0x87, 0x8B } },  // ReverseEquilibrium
+    { 10182,  4, 5, { 0xE2, 0xAA, 0xAF, 0xCC, 0xB8 } },  // npre
+    { 11759,  6, 3, { 0xE2, 0x8E, 0xB1 } },  // rmoust
+    {  8412,  6, 2, { 0xC4, 0xA9 } },  // itilde
+    {  8167,  6, 3, { 0xE2, 0x80, 0x90 } },  // hyphen
+    {  6628,  6, 3, { 0xE2, 0x86, 0xB6 } },  // cularr
+    {  9378,  5, 3, { 0xE2, 0x8B, 0x96 } },  // ltdot
+    {   988, 18, 3, { 0xE2, 0xA5, 0x9F } },  // DownRightTeeVector
+    {  7137,  4, 3, { 0xE2, 0xA7, 0xB6 } },  // dsol
+    {  7152,  4, 3, { 0xE2, 0x96, 0xBF } },  // dtri
+    {  6871,  3, 2, { 0xC2, 0xB0 } },  // deg
+    {  3811, 10, 3, { 0xE2, 0x86, 0x92 } },  // RightArrow
+    {  5156,  4, 2, { 0xCE, 0x96 } },  // Zeta
+    {  7981,  6, 3, { 0xE2, 0x89, 0xB3 } },  // gtrsim
+    {  1415, 11, 3, { 0xE2, 0x89, 0xB7 } },  // GreaterLess
+    {  9909,  4, 3, { 0xE2, 0x89, 0xB1 } },  // ngeq
+    {   841, 17, 3, { 0xE2, 0x87, 0x95 } },  // DoubleUpDownArrow
+    { 10793,  6, 3, { 0xE2, 0x8A, 0xB6 } },  // origof
+    {  1710,  6, 2, { 0xD0, 0x88 } },  // Jsercy
+    {  4911,  4, 4, { 0xF0, 0x9D, 0x92, 0xB0 } },  // Uscr
+    { 12340, 10, 3, { 0xE2, 0x8A, 0x92 } },  // sqsupseteq
+    {  4673,  6, 2, { 0xC5, 0xAC } },  // Ubreve
+    { 12505,  9, 3, { 0xE2, 0xAB, 0x85 } },  // subseteqq
+    {  2431,  2, 2, { 0xCE, 0x9C } },  // Mu
+    {  7199,  6, 2, { 0xC3, 0xA9 } },  // eacute
+    { 10833,  6, 3, { 0xE2, 0x8A, 0x97 } },  // otimes
+    { 11282,  4, 3, { 0xE2, 0x87, 0x92 } },  // rArr
+    {  5214,  6, 2, { 0xC3, 0xA0 } },  // agrave
+    {   798, 16, 3, { 0xE2, 0x87, 0x92 } },  // DoubleRightArrow
+    {  7133,  4, 2, { 0xD1, 0x95 } },  // dscy
+    {  5309,  8, 3, { 0xE2, 0xA6, 0xAA } },  // angmsdac
+    {  2119, 13, 3, { 0xE2, 0xA5, 0x92 } },  // LeftVectorBar
+    { 13896,  6, 3, { 0xE2, 0x8B, 0x80 } },  // xwedge
+    { 12776,  6, 3, { 0xE2, 0xA4, 0xA6 } },  // swarhk
+    {  9314,  5, 3, { 0xE2, 0x8A, 0xBF } },  // lrtri
+    { 10839,  8, 3, { 0xE2, 0xA8, 0xB6 } },  // otimesas
+    { 11277,  5, 3, { 0xE2, 0x87, 0x9B } },  // rAarr
+    {  2567,  7, 1, { 0x0A } },  // NewLine
+    {   276, 10, 3, { 0xE2, 0x8A, 0x95 } },  // CirclePlus
+    {  7316,  6, 3, { 0xE2, 0x80, 0x84 } },  // emsp13
+    {  8350,  5, 2, { 0xC4, 0xAF } },  // iogon
+    {  8281,  6, 3, { 0xE2, 0x84, 0x85 } },  // incare
+    { 13571, 12, 6, { 0xE2, 0x8A, 0x8B, 0xEF, 0xB8, 0x80 } },  // varsupsetneq
+    {  7129,  4, 4, { 0xF0, 0x9D, 0x92, 0xB9 } },  // dscr
+    {  1357, 12, 3, { 0xE2, 0x89, 0xA5 } },  // GreaterEqual
+    {   608, 13, 3, { 0xE2, 0x85, 0x86 } },  // DifferentialD
+    { 13101,  7, 3, { 0xE2, 0xA8, 0xB9 } },  // triplus
+    { 11382,  6, 3, { 0xE2, 0x86, 0xAA } },  // rarrhk
+    {  2034, 17, 3, { 0xE2, 0x8A, 0xB4 } },  // LeftTriangleEqual
+    {  9266,  7, 3, { 0xE2, 0x97, 0x8A } },  // lozenge
+    {  4419,  8, 3, { 0xE2, 0x89, 0xBB } },  // Succeeds
+    {  1750,  4, 4, { 0xF0, 0x9D, 0x92, 0xA6 } },  // Kscr
+    {  7195,  4, 3, { 0xE2, 0x89, 0x91 } },  // eDot
+    {  1336,  5, 2, { 0xC4, 0x9C } },  // Gcirc
+    {  7388,  5, 3, { 0xE2, 0x89, 0x82 } },  // eqsim
+    { 13341, 14, 3, { 0xE2, 0x86, 0xBE } },  // upharpoonright
+    {  1668,  4, 2, { 0xCE, 0x99 } },  // Iota
+    { 12390,  6, 3, { 0xE2, 0x8B, 0x86 } },  // sstarf
+    {  4820, 13, 3, { 0xE2, 0xA5, 0xAE } },  // UpEquilibrium
+    {  8625,  7, 3, { 0xE2, 0xA5, 0xB3 } },  // larrsim
+    { 13596,  8, 2, { 0xCF, 0x91 } },  // vartheta
+    {  5526,  9, 3, { 0xE2, 0x8B, 0x8D } },  // backsimeq
+    {  7738,  3, 3, { 0xE2, 0xAA, 0x86 } },  // gap
+    {   398,  4, 3, { 0xE2, 0x84, 0x82 } },  // Copf
+    {  6521,  9, 3, { 0xE2, 0x84, 0x82 } },  // complexes
+    {  7618,  6, 3, { 0xE2, 0x85, 0x93 } },  // frac13
+    {  6886,  6, 3, { 0xE2, 0xA5, 0xBF } },  // dfisht
+    { 10251,  4, 5, { 0xE2, 0xAA, 0xB0, 0xCC, 0xB8 } },  // nsce
+    {  5874,  3, 3, { 0xE2, 0x8A, 0xA5 } },  // bot
+    { 13686,  5, 6, { 0xE2, 0x8A, 0x83, 0xE2, 0x83, 0x92 } },  // vnsup
+    { 10941,  9, 3, { 0xE2, 0x8B, 0x94 } },  // pitchfork
+    {  9341,  5, 3, { 0xE2, 0xAA, 0x8F } },  // lsimg
+    {  8020,  6, 2, { 0xD1, 0x8A } },  // hardcy
+    {  9660,  3, 6, { 0xE2, 0x89, 0xAB, 0xE2, 0x83, 0x92 } },  // nGt
+    { 11846,  4, 4, { 0xF0, 0x9D, 0x93, 0x87 } },  // rscr
+    {  7654,  6, 3, { 0xE2, 0x85, 0x96 } },  // frac25
+    {  6623,  5, 3, { 0xE2, 0x8B, 0x9F } },  // cuesc
+    { 10645,  4, 3, { 0xE2, 0x8A, 0x99 } },  // odot
+    { 11840,  6, 3, { 0xE2, 0x80, 0xBA } },  // rsaquo
+    { 10095,  7, 3, { 0xE2, 0x88, 0x89 } },  // notinva
+    { 13887,  5, 3, { 0xE2, 0x96, 0xB3 } },  // xutri
+    {   940, 17, 3, { 0xE2, 0xA5, 0x9E } },  // DownLeftTeeVector
+    { 12087, 13, 3, { 0xE2, 0x88, 0xA5 } },  // shortparallel
+    {  1544,  4, 2, { 0xD0, 0x95 } },  // IEcy
+    { 12787,  7, 3, { 0xE2, 0x86, 0x99 } },  // swarrow
+    { 12147,  4, 3, { 0xE2, 0xAA, 0x9D } },  // siml
+    { 13646,  6, 3, { 0xE2, 0x8A, 0xBB } },  // veebar
+    { 12058,  6, 3, { 0xE2, 0x8C, 0xA2 } },  // sfrown
+    {  2477, 18, 3, { 0xE2, 0x80, 0x8B } },  // NegativeThickSpace
+    {  6979,  6, 3, { 0xE2, 0x8C, 0x9E } },  // dlcorn
+    { 11889,  5, 3, { 0xE2, 0x96, 0xB8 } },  // rtrif
+    { 12666,  7, 3, { 0xE2, 0x9F, 0x89 } },  // suphsol
+    {  5972,  5, 3, { 0xE2, 0x95, 0xAB } },  // boxVh
+    { 10037,  4, 5, { 0xE2, 0xA9, 0xBD, 0xCC, 0xB8 } },  // nles
+    {  7064, 14, 3, { 0xE2, 0x87, 0x8A } },  // downdownarrows
+    {  4479,  3, 3, { 0xE2, 0x88, 0x91 } },  // Sum
+    {  5163,  4, 3, { 0xE2, 0x84, 0xA4 } },  // Zopf
+    {  5250,  3, 3, { 0xE2, 0x88, 0xA7 } },  // and
+    {  7487,  5, 3, { 0xE2, 0x88, 0x83 } },  // exist
+    {  7161,  5, 3, { 0xE2, 0x87, 0xB5 } },  // duarr
+    { 10895,  6, 1, { 0x2E } },  // period
+    { 12211,  5, 3, { 0xE2, 0x8C, 0xA3 } },  // smile
+    {  5123,  6, 2, { 0xC5, 0xB9 } },  // Zacute
+    { 12228,  6, 2, { 0xD1, 0x8C } },  // softcy
+    {  7666,  6, 3, { 0xE2, 0x85, 0x97 } },  // frac35
+    {  5953,  4, 3, { 0xE2, 0x95, 0x91 } },  // boxV
+    { 13132,  4, 2, { 0xD1, 0x86 } },  // tscy
+    { 10161,  5, 5, { 0xE2, 0x88, 0x82, 0xCC, 0xB8 } },  // npart
+    { 13989,  4, 4, { 0xF0, 0x9D, 0x95, 0xAB } },  // zopf
+    {  3494,  7, 3, { 0xE2, 0x80, 0xBE } },  // OverBar
+    {  6185,  5, 3, { 0xE2, 0x89, 0x8F } },  // bumpe
+    { 13845,  4, 4, { 0xF0, 0x9D, 0x95, 0xA9 } },  // xopf
+    { 13558, 13, 6, { 0xE2, 0xAB, 0x8B, 0xEF, 0xB8, 0x80 } },  // varsubsetneqq
+    {  4198,  6, 2, { 0xC5, 0x9E } },  // Scedil
+    {  5034,  4, 4, { 0xF0, 0x9D, 0x92, 0xB1 } },  // Vscr
+    {  5743, 12, 3, { 0xE2, 0xA7, 0xAB } },  // blacklozenge
+    { 12962,  6, 3, { 0xE2, 0x8C, 0xB6 } },  // topbot
+    {  6847,  3, 2, { 0xD0, 0xB4 } },  // dcy
+    {  9305,  6, 3, { 0xE2, 0xA5, 0xAD } },  // lrhard
+    {  7420,  6, 3, { 0xE2, 0x89, 0x9F } },  // equest
+    {   152,  4, 3, { 0xE2, 0x84, 0xAC } },  // Bscr
+    { 11424,  5, 3, { 0xE2, 0x88, 0xB6 } },  // ratio
+    {  9644,  8, 3, { 0xE2, 0x8A, 0xB8 } },  // multimap
+    {  4925,  5, 3, { 0xE2, 0x8A, 0xAB } },  // VDash
+    { 12297,  6, 3, { 0xE2, 0x8A, 0x91 } },  // sqsube
+    {  2763, 20, 5, { 0xE2, 0xA9, 0xBE, 0xCC, 0xB8 } },  // NotGreaterSlantEqual
+    { 13355,  5, 3, { 0xE2, 0x8A, 0x8E } },  // uplus
+    {  5115,  4, 2, { 0xC5, 0xB8 } },  // Yuml
+    {  7205,  6, 3, { 0xE2, 0xA9, 0xAE } },  // easter
+    {  6114,  6, 3, { 0xE2, 0x80, 0xB5 } },  // bprime
+    {   778, 20, 3, { 0xE2, 0x9F, 0xB9 } },  // DoubleLongRightArrow
+    {  9698,  4, 5, { 0xE2, 0x89, 0xAA, 0xCC, 0xB8 } },  // nLtv
+    {  2713, 19, 5, { 0xE2, 0x89, 0xA7, 0xCC, 0xB8 } },  // NotGreaterFullEqual
+    {  9346,  4, 1, { 0x5B } },  // lsqb
+    { 11917,  5, 3, { 0xE2, 0x80, 0x9A } },  // sbquo
+    {  4951,  6, 3, { 0xE2, 0x80, 0x96 } },  // Verbar
+    {  5418,  4, 3, { 0xE2, 0x89, 0x8B } },  // apid
+    { 12659,  7, 3, { 0xE2, 0xAB, 0x84 } },  // supedot
+    {  1307,  4, 2, { 0xD0, 0x83 } },  // GJcy
+    {   402,  9, 3, { 0xE2, 0x88, 0x90 } },  // Coproduct
+    { 13676,  5, 3, { 0xE2, 0x8A, 0xB2 } },  // vltri
+    { 10588,  5, 3, { 0xE2, 0x86, 0x96 } },  // nwarr
+    {  6190,  6, 3, { 0xE2, 0x89, 0x8F } },  // bumpeq
+    {  7878,  4, 4, { 0xF0, 0x9D, 0x95, 0x98 } },  // gopf
+    {  8394,  5, 3, { 0xE2, 0x8B, 0xB4 } },  // isins
+    {  6170,  6, 3, { 0xE2, 0x80, 0xA2 } },  // bullet
+    { 11775,  5, 3, { 0xE2, 0xAB, 0xAE } },  // rnmid
+    { 10413,  4, 3, { 0xE2, 0x89, 0xB9 } },  // ntgl
+    {  7503, 12, 3, { 0xE2, 0x85, 0x87 } },  // exponentiale
+    { 11884,  5, 3, { 0xE2, 0x8A, 0xB5 } },  // rtrie
+    { 13875,  6, 3, { 0xE2, 0xA8, 0x86 } },  // xsqcup
+    {  2155, 16, 3, { 0xE2, 0x8B, 0x9A } },  // LessEqualGreater
+    {  8223,  6, 3, { 0xE2, 0xA7, 0x9C } },  // iinfin
+    {   912,  9, 2, { 0xCC, 0x91 } },  // DownBreve
+    {   170,  6, 2, { 0xC4, 0x86 } },  // Cacute
+    {  9142,  5, 3, { 0xE2, 0x9F, 0xA6 } },  // lobrk
+    { 11667, 17, 3, { 0xE2, 0x87, 0x8C } },  // rightleftharpoons
+    {  7761,  3, 3, { 0xE2, 0x8B, 0x9B } },  // gel
+    {  4684,  3, 2, { 0xD0, 0xA3 } },  // Ucy
+    { 13214,  5, 2, { 0xC3, 0xBB } },  // ucirc
+    {   368,  9, 3, { 0xE2, 0x89, 0xA1 } },  // Congruent
+    {   357,  5, 3, { 0xE2, 0x88, 0xB7 } },  // Colon
+    {  1239,  3, 2, { 0xD0, 0xA4 } },  // Fcy
+    {  1830, 12, 3, { 0xE2, 0x87, 0xA4 } },  // LeftArrowBar
+    {  3944,  8, 3, { 0xE2, 0x8A, 0xA2 } },  // RightTee
+    {  9395,  6, 3, { 0xE2, 0xA5, 0xB6 } },  // ltlarr
+    { 12899,  6, 3, { 0xE2, 0x80, 0x89 } },  // thinsp
+    {  1586,  5, 2, { 0xC4, 0xAA } },  // Imacr
+    {  8139,  6, 3, { 0xE2, 0x80, 0x95 } },  // horbar
+    {  3676,  4, 1, { 0x22 } },  // QUOT
+    {  9024,  3, 3, { 0xE2, 0xAA, 0x91 } },  // lgE
+    { 10487,  3, 1, { 0x23 } },  // num
+    {  4258, 12, 3, { 0xE2, 0x86, 0x91 } },  // ShortUpArrow
+    {  8910,  8, 3, { 0xE2, 0xA9, 0xBD } },  // leqslant
+    {    42,  5, 2, { 0xC4, 0x80 } },  // Amacr
+    { 10019,  4, 3, { 0xE2, 0x89, 0xB0 } },  // nleq
+    {  1758,  2, 1, { 0x3C } },  // LT
+    {  2374,  3, 3, { 0xE2, 0x86, 0xB0 } },  // Lsh
+    { 10373,  4, 3, { 0xE2, 0x8A, 0x85 } },  // nsup
+    {  6144,  5, 3, { 0xE2, 0x8B, 0x8D } },  // bsime
+    { 12467,  5, 3, { 0xE2, 0xAB, 0x8B } },  // subnE
+    { 11479,  6, 2, { 0xC5, 0x99 } },  // rcaron
+    { 13695,  5, 3, { 0xE2, 0x88, 0x9D } },  // vprop
+    { 13978,  4, 2, { 0xD0, 0xB6 } },  // zhcy
+    {  3308, 13, 3, { 0xE2, 0x89, 0x84 } },  // NotTildeEqual
+    {  6850,  2, 3, { 0xE2, 0x85, 0x86 } },  // dd
+    {  3375,  2, 2, { 0xCE, 0x9D } },  // Nu
+    {  5068,  2, 2, { 0xCE, 0x9E } },  // Xi
+    {  8331,  8, 3, { 0xE2, 0xA8, 0x97 } },  // intlarhk
+    {  6932,  3, 2, { 0xC2, 0xA8 } },  // die
+    { 12601,  8, 3, { 0xE2, 0x8B, 0xA9 } },  // succnsim
+    { 12630,  4, 2, { 0xC2, 0xB2 } },  // sup2
+    { 11566,  6, 3, { 0xE2, 0x8C, 0x8B } },  // rfloor
+    { 12916,  5, 2, { 0xC3, 0xBE } },  // thorn
+    {  7465,  4, 3, { 0xE2, 0x89, 0x82 } },  // esim
+    {  4204,  5, 2, { 0xC5, 0x9C } },  // Scirc
+    {   206,  6, 2, { 0xC4, 0x8C } },  // Ccaron
+    {  7147,  5, 3, { 0xE2, 0x8B, 0xB1 } },  // dtdot
+    {  7741,  6, 2, { 0xC4, 0x9F } },  // gbreve
+    { 12626,  4, 2, { 0xC2, 0xB9 } },  // sup1
+    { 10593,  7, 3, { 0xE2, 0x86, 0x96 } },  // nwarrow
+    {  5923,  5, 3, { 0xE2, 0x95, 0xA4 } },  // boxHd
+    {  5333,  8, 3, { 0xE2, 0xA6, 0xAD } },  // angmsdaf
+    { 11069,  4, 3, { 0xE2, 0x89, 0xBA } },  // prec
+    { 11008,  5, 3, { 0xE2, 0xA9, 0xB2 } },  // pluse
+    { 10203,  5, 3, { 0xE2, 0x86, 0x9B } },  // nrarr
+    { 10665,  3, 4, { 0xF0, 0x9D, 0x94, 0xAC } },  // ofr
+    {  3719,  6, 2, { 0xC5, 0x98 } },  // Rcaron
+    {  9702, 11, 3, { 0xE2, 0x87, 0x8F } },  // nRightarrow
+    {  9793,  6, 5, { 0xE2, 0x89, 0x8F, 0xCC, 0xB8 } },  // nbumpe
+    {  9100,  3, 3, { 0xE2, 0x89, 0xA8 } },  // lnE
+    {  6594,  5, 3, { 0xE2, 0xAB, 0x92 } },  // csupe
+    {  8835, 15, 3, { 0xE2, 0x87, 0x86 } },  // leftrightarrows
+    {  5440,  5, 2, { 0xC3, 0xA5 } },  // aring
+    {  8145,  4, 4, { 0xF0, 0x9D, 0x92, 0xBD } },  // hscr
+    {    28,  3, 4, { 0xF0, 0x9D, 0x94, 0x84 } },  // Afr
+    {  9329,  3, 3, { 0xE2, 0x86, 0xB0 } },  // lsh
+    {  4123,  4, 3, { 0xE2, 0x84, 0x9D } },  // Ropf
+    {  5487,  4, 3, { 0xE2, 0xAB, 0xAD } },  // bNot
+    {  7232,  3, 2, { 0xD1, 0x8D } },  // ecy
+    {   442,  5, 3, { 0xE2, 0xA8, 0xAF } },  // Cross
+    { 10455, 14, 3, { 0xE2, 0x8B, 0xAB } },  // ntriangleright
+    {  8239,  5, 2, { 0xC4, 0xAB } },  // imacr
+    {  2813, 12, 5, { 0xE2, 0x89, 0x8F, 0xCC, 0xB8 } },  // NotHumpEqual
+    {  6176,  4, 3, { 0xE2, 0x89, 0x8E } },  // bump
+    { 12833,  4, 3, { 0xE2, 0x83, 0x9B } },  // tdot
+    { 11229,  4, 4, { 0xF0, 0x9D, 0x95, 0xA2 } },  // qopf
+    {  1499, 14, 3, { 0xE2, 0x94, 0x80 } },  // HorizontalLine
+    { 10871,  6, 3, { 0xE2, 0xAB, 0xB3 } },  // parsim
+    { 10268, 14, 3, { 0xE2, 0x88, 0xA6 } },  // nshortparallel
+    {  5135,  3, 2, { 0xD0, 0x97 } },  // Zcy
+    {   478,  4, 2, { 0xD0, 0x8F } },  // DZcy
+    {  9570,  6, 3, { 0xE2, 0xAB, 0xB0 } },  // midcir
+    {  4184,  6, 2, { 0xC5, 0x9A } },  // Sacute
+    {  6335,  3, 2, { 0xCF, 0x87 } },  // chi
+    { 13152, 16, 3, { 0xE2, 0x86, 0x9E } },  // twoheadleftarrow
+    {  8900,  3, 3, { 0xE2, 0x8B, 0x9A } },  // leg
+    { 10715,  3, 3, { 0xE2, 0xA7, 0x80 } },  // olt
+    {  5415,  3, 3, { 0xE2, 0x89, 0x8A } },  // ape
+    {   460,  2, 3, { 0xE2, 0x85, 0x85 } },  // DD
+    {  4899,  7, 2, { 0xCE, 0xA5 } },  // Upsilon
+    {  4209,  3, 2, { 0xD0, 0xA1 } },  // Scy
+    {  8491,  4, 2, { 0xD1, 0x85 } },  // khcy
+    { 12711,  6, 3, { 0xE2, 0x8A, 0x83 } },  // supset
+    {  5395,  5, 2, { 0xC4, 0x85 } },  // aogon
+    { 12852,  9, 3, { 0xE2, 0x88, 0xB4 } },  // therefore
+    { 11585,  6, 3, { 0xE2, 0xA5, 0xAC } },  // rharul
+    { 11937,  5, 3, { 0xE2, 0x89, 0xBD } },  // sccue
+    { 11376,  6, 3, { 0xE2, 0xA4, 0x9E } },  // rarrfs
+    {  8779, 15, 3, { 0xE2, 0x86, 0xBD } },  // leftharpoondown
+    { 10693,  5, 3, { 0xE2, 0x86, 0xBA } },  // olarr
+    {  1734,  6, 2, { 0xC4, 0xB6 } },  // Kcedil
+    {  7328,  3, 2, { 0xC5, 0x8B } },  // eng
+    { 13691,  4, 4, { 0xF0, 0x9D, 0x95, 0xA7 } },  // vopf
+    { 11638, 14, 3, { 0xE2, 0x87, 0x80 } },  // rightharpoonup
+    {  5383,  5, 2, { 0xC3, 0x85 } },  // angst
+    {   482,  6, 3, { 0xE2, 0x80, 0xA1 } },  // Dagger
+    { 10282,  4, 3, { 0xE2, 0x89, 0x81 } },  // nsim
+    { 12251,  6, 3, { 0xE2, 0x99, 0xA0 } },  // spades
+    { 13168, 17, 3, { 0xE2, 0x86, 0xA0 } },  // twoheadrightarrow
+    {  5282,  5, 3, { 0xE2, 0x88, 0xA0 } },  // angle
+    {  6534,  7, 3, { 0xE2, 0xA9, 0xAD } },  // congdot
+    { 13793,  5, 3, { 0xE2, 0x97, 0xAF } },  // xcirc
+    {  7226,  6, 3, { 0xE2, 0x89, 0x95 } },  // ecolon
+    {  6810,  6, 3, { 0xE2, 0x84, 0xB8 } },  // daleth
+    {  2414,  9, 3, { 0xE2, 0x88, 0x93 } },  // MinusPlus
+    { 10186,  5, 3, { 0xE2, 0x8A, 0x80 } },  // nprec
+    { 11765, 10, 3, { 0xE2, 0x8E, 0xB1 } },  // rmoustache
+    { 10176,  6, 3, { 0xE2, 0x8B, 0xA0 } },  // nprcue
+    { 12880, 11, 3, { 0xE2, 0x89, 0x88 } },  // thickapprox
+    {  7340,  4, 4, { 0xF0, 0x9D, 0x95, 0x96 } },  // eopf
+    { 12103,  5, 2, { 0xCF, 0x83 } },  // sigma
+    {    81,  6, 3, { 0xE2, 0x89, 0x94 } },  // Assign
+    {  6916, 11, 3, { 0xE2, 0x99, 0xA6 } },  // diamondsuit
+    {  5993,  5, 3, { 0xE2, 0x95, 0x95 } },  // boxdL
+    {  8244,  5, 3, { 0xE2, 0x84, 0x91 } },  // image
+    { 12151,  5, 3, { 0xE2, 0xAA, 0x9F } },  // simlE
+    { 11311,  5, 3, { 0xE2, 0x88, 0x9A } },  // radic
+    {  1021, 18, 3, { 0xE2, 0xA5, 0x97 } },  // DownRightVectorBar
+    {  4168,  6, 2, { 0xD0, 0xA9 } },  // SHCHcy
+    {  9740,  3, 3, { 0xE2, 0x89, 0x89 } },  // nap
+    { 12120,  3, 3, { 0xE2, 0x88, 0xBC } },  // sim
+    { 13514,  5, 2, { 0xCF, 0x96 } },  // varpi
+    { 12642,  6, 3, { 0xE2, 0xAA, 0xBE } },  // supdot
+    { 11349,  4, 3, { 0xE2, 0x86, 0x92 } },  // rarr
+    {   321, 21, 3, { 0xE2, 0x80, 0x9D } },  // CloseCurlyDoubleQuote
+    { 11172,  8, 3, { 0xE2, 0x8C, 0x92 } },  // profline
+    {  8435,  3, 4, { 0xF0, 0x9D, 0x94, 0xA7 } },  // jfr
+    { 13469,  5, 3, { 0xE2, 0x8A, 0xA8 } },  // vDash
+    {  5138,  4, 2, { 0xC5, 0xBB } },  // Zdot
+    {  5567,  5, 3, { 0xE2, 0x89, 0x8C } },  // bcong
+    { 13328, 13, 3, { 0xE2, 0x86, 0xBF } },  // upharpoonleft
+    { 10342,  9, 3, { 0xE2, 0x8A, 0x88 } },  // nsubseteq
+    {    14,  6, 2, { 0xC4, 0x82 } },  // Abreve
+    {  1227, 12, 3, { 0xE2, 0x85, 0x87 } },  // ExponentialE
+    {  1313,  5, 2, { 0xCE, 0x93 } },  // Gamma
+    { 11002,  6, 3, { 0xE2, 0xA8, 0xA5 } },  // plusdu
+    {  6386,  8, 2, { 0xC2, 0xAE } },  // circledR
+    { 13930,  4, 4, { 0xF0, 0x9D, 0x95, 0xAA } },  // yopf
+    {  5586,  7, 3, { 0xE2, 0x88, 0xB5 } },  // because
+    {  9788,  5, 5, { 0xE2, 0x89, 0x8E, 0xCC, 0xB8 } },  // nbump
+    { 10953,  6, 3, { 0xE2, 0x84, 0x8F } },  // planck
+    {  3731,  3, 2, { 0xD0, 0xA0 } },  // Rcy
+    {  1353,  4, 4, { 0xF0, 0x9D, 0x94, 0xBE } },  // Gopf
+    {  1699,  3, 4, { 0xF0, 0x9D, 0x94, 0x8D } },  // Jfr
+    {  7363,  7, 2, { 0xCE, 0xB5 } },  // epsilon
+    { 13663,  6, 1, { 0x7C } },  // verbar
+    {  3257, 16, 5, { 0xE2, 0x89, 0xBF, 0xCC, 0xB8 } },  // NotSucceedsTilde
+    { 11751,  5, 3, { 0xE2, 0x87, 0x8C } },  // rlhar
+    {  6722, 10, 3, { 0xE2, 0x8B, 0x8F } },  // curlywedge
+    { 13203,  5, 2, { 0xD1, 0x9E } },  // ubrcy
+    {  3369,  6, 2, { 0xC3, 0x91 } },  // Ntilde
+    {  8447,  4, 4, { 0xF0, 0x9D, 0x92, 0xBF } },  // jscr
+    {  2195,  8, 3, { 0xE2, 0xAA, 0xA1 } },  // LessLess
+    {  5057,  4, 4, { 0xF0, 0x9D, 0x95, 0x8E } },  // Wopf
+    {  6423, 11, 3, { 0xE2, 0x8A, 0x9D } },  // circleddash
+    {  8821, 14, 3, { 0xE2, 0x86, 0x94 } },  // leftrightarrow
+    {  3934, 10, 3, { 0xE2, 0x8C, 0x8B } },  // RightFloor
+    { 11548,  5, 3, { 0xE2, 0x84, 0x9D } },  // reals
+    {  5107,  4, 4, { 0xF0, 0x9D, 0x95, 0x90 } },  // Yopf
+    { 13938,  4, 2, { 0xD1, 0x8E } },  // yucy
+    {  8656,  5, 3, { 0xE2, 0xA4, 0x8C } },  // lbarr
+    {  1716,  5, 2, { 0xD0, 0x84 } },  // Jukcy
+    {  7235,  4, 2, { 0xC4, 0x97 } },  // edot
+    { 13456,  4, 3, { 0xE2, 0x87, 0x95 } },  // vArr
+    {  8638,  3, 3, { 0xE2, 0xAA, 0xAB } },  // lat
+    {  7887,  4, 3, { 0xE2, 0x84, 0x8A } },  // gscr
+    {  1318,  6, 2, { 0xCF, 0x9C } },  // Gammad
+    {  4347, 14, 3, { 0xE2, 0x8A, 0x90 } },  // SquareSuperset
+    {  4471,  8, 3, { 0xE2, 0x88, 0x8B } },  // SuchThat
+    {  1401, 14, 3, { 0xE2, 0xAA, 0xA2 } },  // GreaterGreater
+    { 10728,  7, 2, { 0xCE, 0xBF } },  // omicron
+    { 13532,  6, 2, { 0xCF, 0xB1 } },  // varrho
+    { 12038,  8, 3, { 0xE2, 0x88, 0x96 } },  // setminus
+    {  8607,  6, 3, { 0xE2, 0x86, 0xA9 } },  // larrhk
+    {  3351, 14, 3, { 0xE2, 0x88, 0xA4 } },  // NotVerticalBar
+    {  9007,  6, 3, { 0xE2, 0xA5, 0xBC } },  // lfisht
+    {  5605,  6, 3, { 0xE2, 0x84, 0xAC } },  // bernou
+    { 10041,  5, 3, { 0xE2, 0x89, 0xAE } },  // nless
+    {  3791,  3, 2, { 0xCE, 0xA1 } },  // Rho
+    {  9408,  6, 3, { 0xE2, 0xA6, 0x96 } },  // ltrPar
+    {  7840,  3, 3, { 0xE2, 0xAA, 0xA5 } },  // gla
+    {  7431,  7, 3, { 0xE2, 0xA9, 0xB8 } },  // equivDD
+    {  5870,  4, 4, { 0xF0, 0x9D, 0x95, 0x93 } },  // bopf
+    {  9847,  6, 3, { 0xE2, 0xA4, 0xA4 } },  // nearhk
+    {  5555,  4, 3, { 0xE2, 0x8E, 0xB5 } },  // bbrk
+    { 10081,  6, 5, { 0xE2, 0x8B, 0xB9, 0xCC, 0xB8 } },  // notinE
+    { 12223,  5, 6, { 0xE2, 0xAA, 0xAC, 0xEF, 0xB8, 0x80 } },  // smtes
+    {  4725, 12, 3, { 0xE2, 0x8E, 0xB5 } },  // UnderBracket
+    {  4395,  4, 3, { 0xE2, 0x8B, 0x86 } },  // Star
+    {  1611,  8, 3, { 0xE2, 0x88, 0xAB } },  // Integral
+    { 13946,  6, 2, { 0xC5, 0xBA } },  // zacute
+    {  9115,  3, 3, { 0xE2, 0xAA, 0x87 } },  // lne
+    { 11931,  6, 2, { 0xC5, 0xA1 } },  // scaron
+    {  7599,  5, 3, { 0xE2, 0xAB, 0x99 } },  // forkv
+    { 13317, 11, 3, { 0xE2, 0x86, 0x95 } },  // updownarrow
+    { 12753,  6, 3, { 0xE2, 0xAB, 0x88 } },  // supsim
+    { 12477,  7, 3, { 0xE2, 0xAA, 0xBF } },  // subplus
+    {  4485,  8, 3, { 0xE2, 0x8A, 0x83 } },  // Superset
+    {  3581,  2, 3, { 0xE2, 0xAA, 0xBB } },  // Pr
+    { 12326,  6, 3, { 0xE2, 0x8A, 0x92 } },  // sqsupe
+    {  5259,  4, 3, { 0xE2, 0xA9, 0x9C } },  // andd
+    {  1729,  5, 2, { 0xCE, 0x9A } },  // Kappa
+    {  5086,  4, 2, { 0xD0, 0xAE } },  // YUcy
+    {  6305,  9, 2, { 0xC2, 0xB7 } },  // centerdot
+    {  6505,  6, 3, { 0xE2, 0x88, 0x98 } },  // compfn
+    {  8718,  3, 2, { 0xD0, 0xBB } },  // lcy
+    {  4942,  6, 3, { 0xE2, 0xAB, 0xA6 } },  // Vdashl
+    {  7595,  4, 3, { 0xE2, 0x8B, 0x94 } },  // fork
+    { 12365,  4, 3, { 0xE2, 0x96, 0xAA } },  // squf
+    { 13519,  9, 3, { 0xE2, 0x88, 0x9D } },  // varpropto
+    {  9373,  5, 3, { 0xE2, 0xA9, 0xB9 } },  // ltcir
+    {  2323, 14, 3, { 0xE2, 0x9F, 0xB9 } },  // Longrightarrow
+    {  5510,  9, 3, { 0xE2, 0x80, 0xB5 } },  // backprime
+    {  8292,  8, 3, { 0xE2, 0xA7, 0x9D } },  // infintie
+    { 11500,  3, 2, { 0xD1, 0x80 } },  // rcy
+    {  2292, 13, 3, { 0xE2, 0x9F, 0xB8 } },  // Longleftarrow
+    {  4330, 17, 3, { 0xE2, 0x8A, 0x91 } },  // SquareSubsetEqual
+    { 10242,  3, 3, { 0xE2, 0x8A, 0x81 } },  // nsc
+    {  3147, 17, 5, { 0xE2, 0x8A, 0x90, 0xCC, 0xB8 } },  // NotSquareSuperset
+    { 13411,  5, 3, { 0xE2, 0x97, 0xB9 } },  // urtri
+    { 11503,  4, 3, { 0xE2, 0xA4, 0xB7 } },  // rdca
+    { 13917,  3, 2, { 0xD1, 0x8B } },  // ycy
+    {  9048,  4, 2, { 0xD1, 0x99 } },  // ljcy
+    { 13032, 14, 3, { 0xE2, 0x8A, 0xB4 } },  // trianglelefteq
+    {  3432, 20, 3, { 0xE2, 0x80, 0x9C } },  // OpenCurlyDoubleQuote
+    {  6438,  8, 3, { 0xE2, 0xA8, 0x90 } },  // cirfnint
+    {  7589,  6, 3, { 0xE2, 0x88, 0x80 } },  // forall
+    {  7604,  8, 3, { 0xE2, 0xA8, 0x8D } },  // fpartint
+    { 12593,  8, 3, { 0xE2, 0xAA, 0xB6 } },  // succneqq
+    { 10749,  4, 3, { 0xE2, 0xA6, 0xB7 } },  // opar
+    {  8030,  7, 3, { 0xE2, 0xA5, 0x88 } },  // harrcir
+    {  9730,  6, 2, { 0xC5, 0x84 } },  // nacute
+    {  1221,  6, 3, { 0xE2, 0x88, 0x83 } },  // Exists
+    {    31,  6, 2, { 0xC3, 0x80 } },  // Agrave
+    {  1721,  4, 2, { 0xD0, 0xA5 } },  // KHcy
+    {  4527,  4, 2, { 0xD0, 0xA6 } },  // TScy
+    { 10618,  4, 3, { 0xE2, 0x8A, 0x9A } },  // ocir
+    {  2370,  4, 3, { 0xE2, 0x84, 0x92 } },  // Lscr
+    { 11874,  6, 3, { 0xE2, 0x8B, 0x8A } },  // rtimes
+    { 11026,  7, 3, { 0xE2, 0xA8, 0xA7 } },  // plustwo
+    {  5237,  5, 2, { 0xC4, 0x81 } },  // amacr
+    {  5111,  4, 4, { 0xF0, 0x9D, 0x92, 0xB4 } },  // Yscr
+    {  7660,  6, 2, { 0xC2, 0xBE } },  // frac34
+    {  7041, 14, 3, { 0xE2, 0x8C, 0x86 } },  // doublebarwedge
+    {  2951, 23, 5, { 0xE2, 0xAA, 0xA2, 0xCC, 0xB8 } },  // NotNestedGreaterGreater
+    {  5883,  6, 3, { 0xE2, 0x8B, 0x88 } },  // bowtie
+    {  9178, 10, 3, { 0xE2, 0x9F, 0xBC } },  // longmapsto
+    { 10501,  6, 3, { 0xE2, 0x8A, 0xAD } },  // nvDash
+    {  2337,  4, 4, { 0xF0, 0x9D, 0x95, 0x83 } },  // Lopf
+    {  5293,  8, 3, { 0xE2, 0xA6, 0xA8 } },  // angmsdaa
+    {  7712,  4, 4, { 0xF0, 0x9D, 0x92, 0xBB } },  // fscr
+    {  9517,  6, 3, { 0xE2, 0x96, 0xAE } },  // marker
+    { 10681,  5, 3, { 0xE2, 0xA6, 0xB5 } },  // ohbar
+    {  8512,  4, 3, { 0xE2, 0x87, 0x90 } },  // lArr
+    { 12843,  3, 4, { 0xF0, 0x9D, 0x94, 0xB1 } },  // tfr
+    { 13020, 12, 3, { 0xE2, 0x97, 0x83 } },  // triangleleft
+    {  1920, 17, 3, { 0xE2, 0xA5, 0x99 } },  // LeftDownVectorBar
+    {  8485,  6, 2, { 0xC4, 0xB8 } },  // kgreen
+    {  9652,  5, 3, { 0xE2, 0x8A, 0xB8 } },  // mumap
+    {  7690,  6, 3, { 0xE2, 0x85, 0x9D } },  // frac58
+    { 10770,  3, 3, { 0xE2, 0xA9, 0x9D } },  // ord
+    {  8993,  7, 3, { 0xE2, 0x89, 0xB6 } },  // lessgtr
+    {  8683,  7, 3, { 0xE2, 0xA6, 0x8F } },  // lbrksld
+    {  8462,  5, 2, { 0xCE, 0xBA } },  // kappa
+    {  2355, 15, 3, { 0xE2, 0x86, 0x98 } },  // LowerRightArrow
+    {  8198,  3, 3, { 0xE2, 0x87, 0x94 } },  // iff
+    { 11810,  7, 3, { 0xE2, 0xA8, 0xB5 } },  // rotimes
+    { 12623,  3, 3, { 0xE2, 0x8A, 0x83 } },  // sup
+    { 10627,  3, 2, { 0xD0, 0xBE } },  // ocy
+    {  3604, 18, 3, { 0xE2, 0x89, 0xBC } },  // PrecedesSlantEqual
+    {  2051, 16, 3, { 0xE2, 0xA5, 0x91 } },  // LeftUpDownVector
+    { 10440, 15, 3, { 0xE2, 0x8B, 0xAC } },  // ntrianglelefteq
+    {  5918,  5, 3, { 0xE2, 0x95, 0xA9 } },  // boxHU
+    { 12824,  6, 2, { 0xC5, 0xA3 } },  // tcedil
+    {  3865, 18, 3, { 0xE2, 0x9F, 0xA7 } },  // RightDoubleBracket
+    {  1495,  4, 3, { 0xE2, 0x84, 0x8D } },  // Hopf
+    {  9667, 10, 3, { 0xE2, 0x87, 0x8D } },  // nLeftarrow
+    {  1740,  3, 2, { 0xD0, 0x9A } },  // Kcy
+    {  5889,  5, 3, { 0xE2, 0x95, 0x97 } },  // boxDL
+    {  5074,  4, 4, { 0xF0, 0x9D, 0x92, 0xB3 } },  // Xscr
+    {  5278,  4, 3, { 0xE2, 0xA6, 0xA4 } },  // ange
+    {  6947,  3, 2, { 0xC3, 0xB7 } },  // div
+    {  5593,  7, 3, { 0xE2, 0xA6, 0xB0 } },  // bemptyv
+    {  9736,  4, 6, { 0xE2, 0x88, 0xA0, 0xE2, 0x83, 0x92 } },  // nang
+    { 11188,  4, 3, { 0xE2, 0x88, 0x9D } },  // prop
+    {  1173,  7, 2, { 0xCE, 0x95 } },  // Epsilon
+    { 13840,  5, 3, { 0xE2, 0xA8, 0x80 } },  // xodot
+    {  6935,  7, 2, { 0xCF, 0x9D } },  // digamma
+    {  9032,  5, 3, { 0xE2, 0x86, 0xBC } },  // lharu
+    {  8714,  4, 1, { 0x7B } },  // lcub
+    {  9809,  6, 2, { 0xC5, 0x86 } },  // ncedil
+    {  7721,  6, 2, { 0xC7, 0xB5 } },  // gacute
+    { 11127,  7, 3, { 0xE2, 0x89, 0xBE } },  // precsim
+    { 11448,  6, 1, { 0x7D } },  // rbrace
+    {  4043, 16, 3, { 0xE2, 0xA5, 0x9C } },  // RightUpTeeVector
+    {  5400,  4, 4, { 0xF0, 0x9D, 0x95, 0x92 } },  // aopf
+    {  7672,  6, 3, { 0xE2, 0x85, 0x9C } },  // frac38
+    { 12108,  6, 2, { 0xCF, 0x82 } },  // sigmaf
+    {  5101,  3, 2, { 0xD0, 0xAB } },  // Ycy
+    {  9564,  6, 1, { 0x2A } },  // midast
+    {  1946, 14, 3, { 0xE2, 0x86, 0x94 } },  // LeftRightArrow
+    {  9469,  4, 3, { 0xE2, 0x9C, 0xA0 } },  // malt
+    {   875,  9, 3, { 0xE2, 0x86, 0x93 } },  // DownArrow
+    {  1568,  3, 2, { 0xD0, 0x98 } },  // Icy
+    { 10966,  6, 3, { 0xE2, 0x84, 0x8F } },  // plankv
+    { 13700,  5, 3, { 0xE2, 0x8A, 0xB3 } },  // vrtri
+    { 13400,  6, 3, { 0xE2, 0x8C, 0x8E } },  // urcrop
+    { 13147,  5, 3, { 0xE2, 0x89, 0xAC } },  // twixt
+    { 10698,  5, 3, { 0xE2, 0xA6, 0xBE } },  // olcir
+    { 13827,  5, 3, { 0xE2, 0x9F, 0xB5 } },  // xlarr
+    { 13425,  6, 2, { 0xC5, 0xA9 } },  // utilde
+    { 13881,  6, 3, { 0xE2, 0xA8, 0x84 } },  // xuplus
+    {  4564,  5, 2, { 0xCE, 0x98 } },  // Theta
+    {  7934,  9, 3, { 0xE2, 0xAA, 0x86 } },  // gtrapprox
+    {   253,  3, 2, { 0xCE, 0xA7 } },  // Chi
+    { 11407,  6, 3, { 0xE2, 0x86, 0xA3 } },  // rarrtl
+    { 10469, 16, 3, { 0xE2, 0x8B, 0xAD } },  // ntrianglerighteq
+    {   722, 13, 3, { 0xE2, 0xAB, 0xA4 } },  // DoubleLeftTee
+    {  1786,  4, 3, { 0xE2, 0x86, 0x9E } },  // Larr
+    {  2391, 11, 3, { 0xE2, 0x81, 0x9F } },  // MediumSpace
+    {  1303,  4, 3, { 0xE2, 0x84, 0xB1 } },  // Fscr
+    {  5813, 18, 3, { 0xE2, 0x96, 0xB8 } },  // blacktriangleright
+    {  9027,  5, 3, { 0xE2, 0x86, 0xBD } },  // lhard
+    {  3127, 20, 3, { 0xE2, 0x8B, 0xA2 } },  // NotSquareSubsetEqual
+    { 13253,  5, 3, { 0xE2, 0x86, 0xBF } },  // uharl
+    {  6402, 10, 3, { 0xE2, 0x8A, 0x9B } },  // circledast
+    {  8210,  2, 3, { 0xE2, 0x85, 0x88 } },  // ii
+    {  7451,  5, 3, { 0xE2, 0xA5, 0xB1 } },  // erarr
+    { 10778,  7, 3, { 0xE2, 0x84, 0xB4 } },  // orderof
+    { 12680,  7, 3, { 0xE2, 0xA5, 0xBB } },  // suplarr
+    {  7787,  6, 3, { 0xE2, 0xAA, 0x80 } },  // gesdot
+    { 11429,  9, 3, { 0xE2, 0x84, 0x9A } },  // rationals
+    {   921, 19, 3, { 0xE2, 0xA5, 0x90 } },  // DownLeftRightVector
+    { 11821,  6, 3, { 0xE2, 0xA6, 0x94 } },  // rpargt
+    {  5432,  8, 3, { 0xE2, 0x89, 0x8A } },  // approxeq
+    { 10686,  3, 2, { 0xCE, 0xA9 } },  // ohm
+    {  1123,  5, 2, { 0xC4, 0x92 } },  // Emacr
+    {  6829,  7, 3, { 0xE2, 0xA4, 0x8F } },  // dbkarow
+    {  8181,  5, 2, { 0xC3, 0xAE } },  // icirc
+    { 13871,  4, 4, { 0xF0, 0x9D, 0x93, 0x8D } },  // xscr
+    {  9480,  3, 3, { 0xE2, 0x86, 0xA6 } },  // map
+    {  2247, 13, 3, { 0xE2, 0x9F, 0xB5 } },  // LongLeftArrow
+    {  4593, 10, 3, { 0xE2, 0x89, 0x83 } },  // TildeEqual
+    { 12974,  4, 4, { 0xF0, 0x9D, 0x95, 0xA5 } },  // topf
+    {  3699,  6, 2, { 0xC5, 0x94 } },  // Racute
+    {  5866,  4, 3, { 0xE2, 0x8C, 0x90 } },  // bnot
+    { 12275,  6, 6, { 0xE2, 0x8A, 0x93, 0xEF, 0xB8, 0x80 } },  // sqcaps
+    { 12064,  5, 3, { 0xE2, 0x99, 0xAF } },  // sharp
+    { 11795,  5, 3, { 0xE2, 0xA6, 0x86 } },  // ropar
+    { 10863,  8, 3, { 0xE2, 0x88, 0xA5 } },  // parallel
+    {  9903,  3, 5, { 0xE2, 0x89, 0xA7, 0xCC, 0xB8 } },  // ngE
+    { 12332,  8, 3, { 0xE2, 0x8A, 0x90 } },  // sqsupset
+    { 13635,  3, 2, { 0xD0, 0xB2 } },  // vcy
+    {  6166,  4, 3, { 0xE2, 0x80, 0xA2 } },  // bull
+    {  6679,  6, 3, { 0xE2, 0x86, 0xB7 } },  // curarr
+    {   256,  9, 3, { 0xE2, 0x8A, 0x99 } },  // CircleDot
+    {  8721,  4, 3, { 0xE2, 0xA4, 0xB6 } },  // ldca
+    {  4402,  6, 3, { 0xE2, 0x8B, 0x90 } },  // Subset
+    {  1144, 20, 3, { 0xE2, 0x96, 0xAB } },  // EmptyVerySmallSquare
+    {   754, 24, 3, { 0xE2, 0x9F, 0xBA } },  // DoubleLongLeftRightArrow
+    {  9229,  5, 3, { 0xE2, 0xA6, 0x85 } },  // lopar
+    {  1584,  2, 3, { 0xE2, 0x84, 0x91 } },  // Im
+    {  9960,  3, 3, { 0xE2, 0x8B, 0xBC } },  // nis
+    { 12079,  8, 3, { 0xE2, 0x88, 0xA3 } },  // shortmid
+    {  9979,  3, 5, { 0xE2, 0x89, 0xA6, 0xCC, 0xB8 } },  // nlE
+    { 11047,  5, 2, { 0xC2, 0xA3 } },  // pound
+    {  6804,  6, 3, { 0xE2, 0x80, 0xA0 } },  // dagger
+    {  2411,  3, 4, { 0xF0, 0x9D, 0x94, 0x90 } },  // Mfr
+    {   218,  5, 2, { 0xC4, 0x88 } },  // Ccirc
+    { 11328,  5, 3, { 0xE2, 0xA6, 0x92 } },  // rangd
+    {  3725,  6, 2, { 0xC5, 0x96 } },  // Rcedil
+    {  7276,  3, 3, { 0xE2, 0x84, 0x93 } },  // ell
+    { 12576,  6, 3, { 0xE2, 0xAA, 0xB0 } },  // succeq
+    {   156,  6, 3, { 0xE2, 0x89, 0x8E } },  // Bumpeq
+    {  5253,  6, 3, { 0xE2, 0xA9, 0x95 } },  // andand
+    {  6530,  4, 3, { 0xE2, 0x89, 0x85 } },  // cong
+    {  7779,  3, 3, { 0xE2, 0xA9, 0xBE } },  // ges
+    { 11945,  6, 2, { 0xC5, 0x9F } },  // scedil
+    {  6314,  3, 4, { 0xF0, 0x9D, 0x94, 0xA0 } },  // cfr
+    { 13958,  3, 2, { 0xD0, 0xB7 } },  // zcy
+    { 11700, 15, 3, { 0xE2, 0x86, 0x9D } },  // rightsquigarrow
+    {  7861,  3, 3, { 0xE2, 0xAA, 0x88 } },  // gne
+    {  7483,  4, 1, { 0x21 } },  // excl
+    {  8918,  3, 3, { 0xE2, 0xA9, 0xBD } },  // les
+    {  5242,  5, 3, { 0xE2, 0xA8, 0xBF } },  // amalg
+    {  7812,  6, 3, { 0xE2, 0xAA, 0x94 } },  // gesles
+    {  2911, 11, 5, { 0xE2, 0x89, 0xAA, 0xCC, 0xB8 } },  // NotLessLess
+    {  8794, 13, 3, { 0xE2, 0x86, 0xBC } },  // leftharpoonup
+    { 10325,  5, 5, { 0xE2, 0xAB, 0x85, 0xCC, 0xB8 } },  // nsubE
+    {  6618,  5, 3, { 0xE2, 0x8B, 0x9E } },  // cuepr
+    { 11192,  6, 3, { 0xE2, 0x88, 0x9D } },  // propto
+    { 11145,  4, 3, { 0xE2, 0xAA, 0xB5 } },  // prnE
+    {  2783, 15, 3, { 0xE2, 0x89, 0xB5 } },  // NotGreaterTilde
+    { 11862,  6, 3, { 0xE2, 0x80, 0x99 } },  // rsquor
+    { 10877,  5, 3, { 0xE2, 0xAB, 0xBD } },  // parsl
+    {  4493, 13, 3, { 0xE2, 0x8A, 0x87 } },  // SupersetEqual
+    {  4707,  8, 1, { 0x5F } },  // UnderBar
+    { 10076,  5, 3, { 0xE2, 0x88, 0x89 } },  // notin
+    { 10924,  4, 2, { 0xCF, 0x95 } },  // phiv
+    { 12032,  6, 3, { 0xE2, 0xA4, 0xA9 } },  // seswar
+    { 13715,  6, 6, { 0xE2, 0x8A, 0x8A, 0xEF, 0xB8, 0x80 } },  // vsubne
+    {   663,  9, 2, { 0xC2, 0xA8 } },  // DoubleDot
+    {  9389,  6, 3, { 0xE2, 0x8B, 0x89 } },  // ltimes
+    {  8382,  5, 3, { 0xE2, 0x8B, 0xB9 } },  // isinE
+    { 10608,  6, 2, { 0xC3, 0xB3 } },  // oacute
+    {  4178,  6, 2, { 0xD0, 0xAC } },  // SOFTcy
+    {  4099, 14, 3, { 0xE2, 0xA5, 0x93 } },  // RightVectorBar
+    {  1242,  3, 4, { 0xF0, 0x9D, 0x94, 0x89 } },  // Ffr
+    {  6278,  7, 3, { 0xE2, 0xA9, 0x90 } },  // ccupssm
+    {  7782,  5, 3, { 0xE2, 0xAA, 0xA9 } },  // gescc
+    {  9943,  5, 3, { 0xE2, 0x87, 0x8E } },  // nhArr
+    {  1217,  4, 2, { 0xC3, 0x8B } },  // Euml
+    {  8589,  5, 3, { 0xE2, 0x87, 0xA4 } },  // larrb
+    { 13785,  4, 4, { 0xF0, 0x9D, 0x93, 0x8C } },  // wscr
+    {  8651,  5, 6, { 0xE2, 0xAA, 0xAD, 0xEF, 0xB8, 0x80 } },  // lates
+    { 12311, 10, 3, { 0xE2, 0x8A, 0x91 } },  // sqsubseteq
+    { 13233,  5, 3, { 0xE2, 0xA5, 0xAE } },  // udhar
+    {  5271,  4, 3, { 0xE2, 0xA9, 0x9A } },  // andv
+    {  9456,  5, 3, { 0xE2, 0x88, 0xBA } },  // mDDot
+    { 13993,  4, 4, { 0xF0, 0x9D, 0x93, 0x8F } },  // zscr
+    { 10773,  5, 3, { 0xE2, 0x84, 0xB4 } },  // order
+    { 11043,  4, 4, { 0xF0, 0x9D, 0x95, 0xA1 } },  // popf
+    {  3544,  3, 2, { 0xD0, 0x9F } },  // Pcy
+    {  8189,  4, 2, { 0xD0, 0xB5 } },  // iecy
+    {  7306,  6, 3, { 0xE2, 0x88, 0x85 } },  // emptyv
+    {  9743,  4, 5, { 0xE2, 0xA9, 0xB0, 0xCC, 0xB8 } },  // napE
+    { 10622,  5, 2, { 0xC3, 0xB4 } },  // ocirc
+    {  7727,  5, 2, { 0xCE, 0xB3 } },  // gamma
+    {  6326,  9, 3, { 0xE2, 0x9C, 0x93 } },  // checkmark
+    {  1619, 12, 3, { 0xE2, 0x8B, 0x82 } },  // Intersection
+    {  9483,  6, 3, { 0xE2, 0x86, 0xA6 } },  // mapsto
+    { 11591,  3, 2, { 0xCF, 0x81 } },  // rho
+    {  8921,  5, 3, { 0xE2, 0xAA, 0xA8 } },  // lescc
+    {   286, 11, 3, { 0xE2, 0x8A, 0x97 } },  // CircleTimes
+    { 12133,  5, 3, { 0xE2, 0x89, 0x83 } },  // simeq
+    { 10259,  9, 3, { 0xE2, 0x88, 0xA4 } },  // nshortmid
+    {  1426, 17, 3, { 0xE2, 0xA9, 0xBE } },  // GreaterSlantEqual
+    {  4408, 11, 3, { 0xE2, 0x8A, 0x86 } },  // SubsetEqual
+    { 10023,  5, 5, { 0xE2, 0x89, 0xA6, 0xCC, 0xB8 } },  // nleqq
+    {     5,  3, 1, { 0x26 } },  // AMP
+    { 11254,  7, 3, { 0xE2, 0xA8, 0x96 } },  // quatint
+    { 10191,  7, 5, { 0xE2, 0xAA, 0xAF, 0xCC, 0xB8 } },  // npreceq
+    {  7537,  6, 3, { 0xEF, 0xAC, 0x83 } },  // ffilig
+    {  4809, 11, 3, { 0xE2, 0x86, 0x95 } },  // UpDownArrow
+    { 13208,  6, 2, { 0xC5, 0xAD } },  // ubreve
+    { 12193,  6, 3, { 0xE2, 0xA8, 0xB3 } },  // smashp
+    { 10046,  5, 3, { 0xE2, 0x89, 0xB4 } },  // nlsim
+    { 13420,  5, 3, { 0xE2, 0x8B, 0xB0 } },  // utdot
+    { 12443,  6, 3, { 0xE2, 0xAA, 0xBD } },  // subdot
+    { 12234,  3, 1, { 0x2F } },  // sol
+    { 13740,  5, 2, { 0xC5, 0xB5 } },  // wcirc
+    {  2628, 20, 3, { 0xE2, 0x88, 0xA6 } },  // NotDoubleVerticalBar
+    { 10146,  9, 3, { 0xE2, 0x88, 0xA6 } },  // nparallel
+    { 12985,  4, 3, { 0xE2, 0xA4, 0xA9 } },  // tosa
+    {  6022,  5, 3, { 0xE2, 0x95, 0xA8 } },  // boxhU
+    {  2512, 21, 3, { 0xE2, 0x80, 0x8B } },  // NegativeVeryThinSpace
+    { 10220, 11, 3, { 0xE2, 0x86, 0x9B } },  // nrightarrow
+    { 12782,  5, 3, { 0xE2, 0x86, 0x99 } },  // swarr
+    {  6089,  5, 3, { 0xE2, 0x95, 0xA1 } },  // boxvL
+    {  4679,  5, 2, { 0xC3, 0x9B } },  // Ucirc
+    {  6032,  5, 3, { 0xE2, 0x94, 0xB4 } },  // boxhu
+    { 12400,  5, 3, { 0xE2, 0x98, 0x85 } },  // starf
+    { 11273,  4, 1, { 0x22 } },  // quot
+    {  8339,  7, 3, { 0xE2, 0xA8, 0xBC } },  // intprod
+    { 12431,  5, 2, { 0xC2, 0xAF } },  // strns
+    { 13301,  5, 2, { 0xC5, 0xB3 } },  // uogon
+    {  8405,  5, 3, { 0xE2, 0x88, 0x88 } },  // isinv
+    {  4838, 10, 3, { 0xE2, 0x86, 0xA5 } },  // UpTeeArrow
+    {  4934,  3, 2, { 0xD0, 0x92 } },  // Vcy
+    {  9987,  4, 3, { 0xE2, 0x80, 0xA5 } },  // nldr
+    {   454,  6, 3, { 0xE2, 0x89, 0x8D } },  // CupCap
+    {  9865,  5, 5, { 0xE2, 0x89, 0x90, 0xCC, 0xB8 } },  // nedot
+    {  4294,  6, 3, { 0xE2, 0x96, 0xA1 } },  // Square
+    {  9620,  6, 3, { 0xE2, 0x8A, 0xA7 } },  // models
+    {  6446,  6, 3, { 0xE2, 0xAB, 0xAF } },  // cirmid
+    {  6196,  6, 2, { 0xC4, 0x87 } },  // cacute
+    {  1631, 14, 3, { 0xE2, 0x81, 0xA3 } },  // InvisibleComma
+    { 11835,  5, 3, { 0xE2, 0x87, 0x89 } },  // rrarr
+    {  9103,  4, 3, { 0xE2, 0xAA, 0x89 } },  // lnap
+    {  1578,  6, 2, { 0xC3, 0x8C } },  // Igrave
+    {  7288,  5, 2, { 0xC4, 0x93 } },  // emacr
+    {  2455,  3, 2, { 0xD0, 0x9D } },  // Ncy
+    {  6581,  4, 3, { 0xE2, 0xAB, 0x8F } },  // csub
+    {  4640,  4, 4, { 0xF0, 0x9D, 0x92, 0xAF } },  // Tscr
+    { 12937,  8, 3, { 0xE2, 0xA8, 0xB1 } },  // timesbar
+    {  5572,  3, 2, { 0xD0, 0xB1 } },  // bcy
+    {  3583,  8, 3, { 0xE2, 0x89, 0xBA } },  // Precedes
+    {  7354,  5, 3, { 0xE2, 0xA9, 0xB1 } },  // eplus
+    { 10321,  4, 3, { 0xE2, 0x8A, 0x84 } },  // nsub
+    {  1608,  3, 3, { 0xE2, 0x88, 0xAC } },  // Int
+    { 10703,  7, 3, { 0xE2, 0xA6, 0xBB } },  // olcross
+    {  1766,  6, 2, { 0xCE, 0x9B } },  // Lambda
+    { 12704,  7, 3, { 0xE2, 0xAB, 0x80 } },  // supplus
+    { 11951,  5, 2, { 0xC5, 0x9D } },  // scirc
+    {  1083,  6, 2, { 0xC3, 0x89 } },  // Eacute
+    {  5766, 13, 3, { 0xE2, 0x96, 0xB4 } },  // blacktriangle
+    {  3536,  8, 3, { 0xE2, 0x88, 0x82 } },  // PartialD
+    {  1180,  5, 3, { 0xE2, 0xA9, 0xB5 } },  // Equal
+    { 13902,  6, 2, { 0xC3, 0xBD } },  // yacute
+    {  7472,  3, 2, { 0xC3, 0xB0 } },  // eth
+    {  7826,  5, 3, { 0xE2, 0x84, 0xB7 } },  // gimel
+    {   377,  6, 3, { 0xE2, 0x88, 0xAF } },  // Conint
+    {  2922, 17, 5, { 0xE2, 0xA9, 0xBD, 0xCC, 0xB8 } },  // NotLessSlantEqual
+    {  9967,  3, 3, { 0xE2, 0x88, 0x8B } },  // niv
+    {  9257,  6, 1, { 0x5F } },  // lowbar
+    { 12861,  5, 2, { 0xCE, 0xB8 } },  // theta
+    {  3039, 17, 3, { 0xE2, 0x88, 0x8C } },  // NotReverseElement
+    { 11100, 11, 3, { 0xE2, 0xAA, 0xB9 } },  // precnapprox
+    { 10765,  5, 3, { 0xE2, 0x86, 0xBB } },  // orarr
+    {  6692, 11, 3, { 0xE2, 0x8B, 0x9E } },  // curlyeqprec
+    {  9913,  5, 5, { 0xE2, 0x89, 0xA7, 0xCC, 0xB8 } },  // ngeqq
+    { 11371,  5, 3, { 0xE2, 0xA4, 0xB3 } },  // rarrc
+    {  8234,  5, 2, { 0xC4, 0xB3 } },  // ijlig
+    { 11139,  6, 3, { 0xE2, 0x84, 0x99 } },  // primes
+    {  7624,  6, 2, { 0xC2, 0xBC } },  // frac14
+    {  5061,  4, 4, { 0xF0, 0x9D, 0x92, 0xB2 } },  // Wscr
+    {  1664,  4, 4, { 0xF0, 0x9D, 0x95, 0x80 } },  // Iopf
+    {  1889, 17, 3, { 0xE2, 0xA5, 0xA1 } },  // LeftDownTeeVector
+    {  7370,  5, 2, { 0xCF, 0xB5 } },  // epsiv
+    { 13756,  6, 3, { 0xE2, 0x89, 0x99 } },  // wedgeq
+    { 13866,  5, 3, { 0xE2, 0x9F, 0xB6 } },  // xrarr
+    {  4113, 10, 3, { 0xE2, 0x87, 0x92 } },  // Rightarrow
+    {  5426,  6, 3, { 0xE2, 0x89, 0x88 } },  // approx
+    {  2574,  3, 4, { 0xF0, 0x9D, 0x94, 0x91 } },  // Nfr
+    {  4588,  5, 3, { 0xE2, 0x88, 0xBC } },  // Tilde
+    { 11400,  7, 3, { 0xE2, 0xA5, 0xB4 } },  // rarrsim
+    {   474,  4, 2, { 0xD0, 0x85 } },  // DScy
+    {  2082, 12, 3, { 0xE2, 0x86, 0xBF } },  // LeftUpVector
+    {  3388,  5, 2, { 0xC3, 0x94 } },  // Ocirc
+    { 13997,  3, 3, { 0xE2, 0x80, 0x8D } },  // zwj
+    {  8556,  6, 2, { 0xCE, 0xBB } },  // lambda
+    { 12123,  6, 3, { 0xE2, 0xA9, 0xAA } },  // simdot
+    {  8939,  8, 3, { 0xE2, 0xAA, 0x83 } },  // lesdotor
+    { 10382,  5, 3, { 0xE2, 0x8A, 0x89 } },  // nsupe
+    {  7017,  8, 3, { 0xE2, 0x88, 0xB8 } },  // dotminus
+    { 11553,  4, 3, { 0xE2, 0x96, 0xAD } },  // rect
+    {  8666,  6, 1, { 0x7B } },  // lbrace
+    {  9820,  8, 5, { 0xE2, 0xA9, 0xAD, 0xCC, 0xB8 } },  // ncongdot
+    {  6131,  4, 4, { 0xF0, 0x9D, 0x92, 0xB7 } },  // bscr
+    { 10087,  8, 5, { 0xE2, 0x8B, 0xB5, 0xCC, 0xB8 } },  // notindot
+    {  7996,  4, 6, { 0xE2, 0x89, 0xA9, 0xEF, 0xB8, 0x80 } },  // gvnE
+    { 11594,  4, 2, { 0xCF, 0xB1 } },  // rhov
+    {  8249,  8, 3, { 0xE2, 0x84, 0x90 } },  // imagline
+    {  6052,  8, 3, { 0xE2, 0x8A, 0xA0 } },  // boxtimes
+    {  8161,  6, 3, { 0xE2, 0x81, 0x83 } },  // hybull
+    { 13643,  3, 3, { 0xE2, 0x88, 0xA8 } },  // vee
+    {  1351,  2, 3, { 0xE2, 0x8B, 0x99 } },  // Gg
+    { 10939,  2, 2, { 0xCF, 0x80 } },  // pi
+    { 13721,  6, 6, { 0xE2, 0xAB, 0x8C, 0xEF, 0xB8, 0x80 } },  // vsupnE
+    {  5729,  8, 3, { 0xE2, 0x8B, 0x80 } },  // bigwedge
+    { 11013,  6, 2, { 0xC2, 0xB1 } },  // plusmn
+    { 13727,  6, 6, { 0xE2, 0x8A, 0x8B, 0xEF, 0xB8, 0x80 } },  // vsupne
+    { 12241,  6, 3, { 0xE2, 0x8C, 0xBF } },  // solbar
+    {  1467,  5, 2, { 0xCB, 0x87 } },  // Hacek
+    {  3952, 13, 3, { 0xE2, 0x86, 0xA6 } },  // RightTeeArrow
+    {  1475,  5, 2, { 0xC4, 0xA4 } },  // Hcirc
+    {  2094, 15, 3, { 0xE2, 0xA5, 0x98 } },  // LeftUpVectorBar
+    {  8066,  6, 3, { 0xE2, 0x80, 0xA6 } },  // hellip
+    { 11164,  8, 3, { 0xE2, 0x8C, 0xAE } },  // profalar
+    { 12978,  7, 3, { 0xE2, 0xAB, 0x9A } },  // topfork
+    {  5377,  6, 3, { 0xE2, 0x88, 0xA2 } },  // angsph
+    { 13751,  5, 3, { 0xE2, 0x88, 0xA7 } },  // wedge
+    {  5474,  8, 3, { 0xE2, 0x88, 0xB3 } },  // awconint
+    {  4693,  3, 4, { 0xF0, 0x9D, 0x94, 0x98 } },  // Ufr
+    {   230,  4, 2, { 0xC4, 0x8A } },  // Cdot
+    { 10427, 13, 3, { 0xE2, 0x8B, 0xAA } },  // ntriangleleft
+    { 11472,  7, 3, { 0xE2, 0xA6, 0x90 } },  // rbrkslu
+    {  5001, 13, 3, { 0xE2, 0x89, 0x80 } },  // VerticalTilde
+    {  9122,  5, 3, { 0xE2, 0x89, 0xA8 } },  // lneqq
+    {  1195, 11, 3, { 0xE2, 0x87, 0x8C } },  // Equilibrium
+    {  8479,  3, 2, { 0xD0, 0xBA } },  // kcy
+    {  6590,  4, 3, { 0xE2, 0xAB, 0x90 } },  // csup
+    { 13108,  5, 3, { 0xE2, 0xA7, 0x8D } },  // trisb
+    { 10976,  8, 3, { 0xE2, 0xA8, 0xA3 } },  // plusacir
+    {  6017,  5, 3, { 0xE2, 0x95, 0xA5 } },  // boxhD
+    {  6338,  3, 3, { 0xE2, 0x97, 0x8B } },  // cir
+    {  5796, 17, 3, { 0xE2, 0x97, 0x82 } },  // blacktriangleleft
+    {  4531,  3, 1, { 0x09 } },  // Tab
+    { 10198,  5, 3, { 0xE2, 0x87, 0x8F } },  // nrArr
+    { 13538,  8, 2, { 0xCF, 0x82 } },  // varsigma
+    {  9067,  6, 3, { 0xE2, 0xA5, 0xAB } },  // llhard
+    { 11239,  4, 4, { 0xF0, 0x9D, 0x93, 0x86 } },  // qscr
+    {  8697,  6, 2, { 0xC4, 0xBE } },  // lcaron
+    {  2171, 13, 3, { 0xE2, 0x89, 0xA6 } },  // LessFullEqual
+    {  5642,  6, 3, { 0xE2, 0x8B, 0x83 } },  // bigcup
+    {  7764,  3, 3, { 0xE2, 0x89, 0xA5 } },  // geq
+    {  5977,  5, 3, { 0xE2, 0x95, 0xA2 } },  // boxVl
+    { 10723,  5, 2, { 0xCF, 0x89 } },  // omega
+    {  5078,  4, 2, { 0xD0, 0xAF } },  // YAcy
+    { 11496,  4, 1, { 0x7D } },  // rcub
+    {  7630,  6, 3, { 0xE2, 0x85, 0x95 } },  // frac15
+    { 12321,  5, 3, { 0xE2, 0x8A, 0x90 } },  // sqsup
+    {  7456,  4, 3, { 0xE2, 0x84, 0xAF } },  // escr
+    { 12207,  4, 3, { 0xE2, 0x88, 0xA3 } },  // smid
+    { 11922,  2, 3, { 0xE2, 0x89, 0xBB } },  // sc
+    {  7515, 13, 3, { 0xE2, 0x89, 0x92 } },  // fallingdotseq
+    { 12533,  6, 3, { 0xE2, 0xAB, 0x87 } },  // subsim
+    {  3220, 16, 5, { 0xE2, 0xAA, 0xB0, 0xCC, 0xB8 } },  // NotSucceedsEqual
+    {  9319,  6, 3, { 0xE2, 0x80, 0xB9 } },  // lsaquo
+    { 12449,  4, 3, { 0xE2, 0x8A, 0x86 } },  // sube
+    {  9090, 10, 3, { 0xE2, 0x8E, 0xB0 } },  // lmoustache
+    {  5464,  6, 2, { 0xC3, 0xA3 } },  // atilde
+    {  4793, 16, 3, { 0xE2, 0x87, 0x85 } },  // UpArrowDownArrow
+    {  9052,  2, 3, { 0xE2, 0x89, 0xAA } },  // ll
+    {  9043,  5, 3, { 0xE2, 0x96, 0x84 } },  // lhblk
+    {  5877,  6, 3, { 0xE2, 0x8A, 0xA5 } },  // bottom
+    { 13777,  2, 3, { 0xE2, 0x89, 0x80 } },  // wr
+    { 10718,  5, 2, { 0xC5, 0x8D } },  // omacr
+    { 13464,  5, 3, { 0xE2, 0xAB, 0xA9 } },  // vBarv
+    {  9882,  5, 5, { 0xE2, 0x89, 0x82, 0xCC, 0xB8 } },  // nesim
+    { 10548,  4, 4, { 0x3C, 0xE2, 0x83, 0x92 } },  // nvlt
+    { 11160,  4, 3, { 0xE2, 0x88, 0x8F } },  // prod
+    {  6561,  6, 3, { 0xE2, 0x84, 0x97 } },  // copysr
+    { 11956,  4, 3, { 0xE2, 0xAA, 0xB6 } },  // scnE
+    {  3696,  3, 2, { 0xC2, 0xAE } },  // REG
+    {  8081,  8, 3, { 0xE2, 0xA4, 0xA5 } },  // hksearow
+    { 12491,  6, 3, { 0xE2, 0x8A, 0x82 } },  // subset
+    {  7531,  6, 3, { 0xE2, 0x99, 0x80 } },  // female
+    {  8730,  6, 3, { 0xE2, 0x80, 0x9E } },  // ldquor
+    {  6459,  5, 3, { 0xE2, 0x99, 0xA3 } },  // clubs
+    {  7882,  5, 1, { 0x60 } },  // grave
+    { 11902,  7, 3, { 0xE2, 0xA5, 0xA8 } },  // ruluhar
+    { 13369,  7, 2, { 0xCF, 0x85 } },  // upsilon
+    { 11533,  7, 3, { 0xE2, 0x84, 0x9B } },  // realine
+    {  1067,  4, 4, { 0xF0, 0x9D, 0x92, 0x9F } },  // Dscr
+    {  7025,  7, 3, { 0xE2, 0x88, 0x94 } },  // dotplus
+    {  4702,  5, 2, { 0xC5, 0xAA } },  // Umacr
+    {    77,  4, 4, { 0xF0, 0x9D, 0x92, 0x9C } },  // Ascr
+    {  9636,  6, 3, { 0xE2, 0x88, 0xBE } },  // mstpos
+    {  7868,  5, 3, { 0xE2, 0x89, 0xA9 } },  // gneqq
+    {   265, 11, 3, { 0xE2, 0x8A, 0x96 } },  // CircleMinus
+    {  1330,  6, 2, { 0xC4, 0xA2 } },  // Gcedil
+    {  5541,  6, 3, { 0xE2, 0x8C, 0x85 } },  // barwed
+    {  9593,  6, 3, { 0xE2, 0x88, 0xB8 } },  // minusd
+    {  9769,  7, 3, { 0xE2, 0x99, 0xAE } },  // natural
+    {  1385, 16, 3, { 0xE2, 0x89, 0xA7 } },  // GreaterFullEqual
+    { 12138,  4, 3, { 0xE2, 0xAA, 0x9E } },  // simg
+    { 10745,  4, 4, { 0xF0, 0x9D, 0x95, 0xA0 } },  // oopf
+    {  1906, 14, 3, { 0xE2, 0x87, 0x83 } },  // LeftDownVector
+    {  8443,  4, 4, { 0xF0, 0x9D, 0x95, 0x9B } },  // jopf
+    {  7393, 10, 3, { 0xE2, 0xAA, 0x96 } },  // eqslantgtr
+    {  8149,  6, 3, { 0xE2, 0x84, 0x8F } },  // hslash
+    {  7849,  4, 3, { 0xE2, 0xAA, 0x8A } },  // gnap
+    { 13263,  5, 3, { 0xE2, 0x96, 0x80 } },  // uhblk
+    {     8,  6, 2, { 0xC3, 0x81 } },  // Aacute
+    { 12384,  6, 3, { 0xE2, 0x8C, 0xA3 } },  // ssmile
+    { 12075,  4, 2, { 0xD1, 0x88 } },  // shcy
+    {  6785,  5, 3, { 0xE2, 0x88, 0xB1 } },  // cwint
+    { 12931,  6, 3, { 0xE2, 0x8A, 0xA0 } },  // timesb
+    {  8932,  7, 3, { 0xE2, 0xAA, 0x81 } },  // lesdoto
+    { 11572,  3, 4, { 0xF0, 0x9D, 0x94, 0xAF } },  // rfr
+    {  2604,  3, 3, { 0xE2, 0xAB, 0xAC } },  // Not
+    { 10135,  7, 3, { 0xE2, 0x8B, 0xBD } },  // notnivc
+    { 13771,  4, 4, { 0xF0, 0x9D, 0x95, 0xA8 } },  // wopf
+    {  3673,  3, 2, { 0xCE, 0xA8 } },  // Psi
+    { 13247,  6, 2, { 0xC3, 0xB9 } },  // ugrave
+    { 10538,  6, 3, { 0xE2, 0xA4, 0x82 } },  // nvlArr
+    {  3428,  4, 4, { 0xF0, 0x9D, 0x95, 0x86 } },  // Oopf
+    { 12168,  7, 3, { 0xE2, 0xA5, 0xB2 } },  // simrarr
+    {  5982,  5, 3, { 0xE2, 0x95, 0x9F } },  // boxVr
+    { 13908,  4, 2, { 0xD1, 0x8F } },  // yacy
+    { 10660,  5, 3, { 0xE2, 0xA6, 0xBF } },  // ofcir
+    {  8886, 14, 3, { 0xE2, 0x8B, 0x8B } },  // leftthreetimes
+    {  2433,  4, 2, { 0xD0, 0x8A } },  // NJcy
+    {  9292,  8, 3, { 0xE2, 0x8C, 0x9F } },  // lrcorner
+    { 12436,  3, 3, { 0xE2, 0x8A, 0x82 } },  // sub
+    {  1369, 16, 3, { 0xE2, 0x8B, 0x9B } },  // GreaterEqualLess
+    { 12219,  4, 3, { 0xE2, 0xAA, 0xAC } },  // smte
+    { 10739,  6, 3, { 0xE2, 0x8A, 0x96 } },  // ominus
+    {  1245, 17, 3, { 0xE2, 0x97, 0xBC } },  // FilledSmallSquare
+    {  9642,  2, 2, { 0xCE, 0xBC } },  // mu
+    {  6495,  6, 1, { 0x40 } },  // commat
+    {  8601,  6, 3, { 0xE2, 0xA4, 0x9D } },  // larrfs
+    {  6800,  4, 3, { 0xE2, 0xA5, 0xA5 } },  // dHar
+    {  8014,  6, 3, { 0xE2, 0x84, 0x8B } },  // hamilt
+    {  6060,  5, 3, { 0xE2, 0x95, 0x9B } },  // boxuL
+    {  4427, 13, 3, { 0xE2, 0xAA, 0xB0 } },  // SucceedsEqual
+    {  4783, 10, 3, { 0xE2, 0xA4, 0x92 } },  // UpArrowBar
+    { 11465,  7, 3, { 0xE2, 0xA6, 0x8E } },  // rbrksld
+    {  4569, 10, 6, { 0xE2, 0x81, 0x9F, 0xE2, 0x80, 0x8A } },  // ThickSpace
+    { 10121,  7, 3, { 0xE2, 0x88, 0x8C } },  // notniva
+    {  7293,  5, 3, { 0xE2, 0x88, 0x85 } },  // empty
+    {  9776,  8, 3, { 0xE2, 0x84, 0x95 } },  // naturals
+    {  8368,  6, 2, { 0xC2, 0xBF } },  // iquest
+    { 12694,  5, 3, { 0xE2, 0xAB, 0x8C } },  // supnE
+    {  5177,  6, 2, { 0xC4, 0x83 } },  // abreve
+    {  9858,  7, 3, { 0xE2, 0x86, 0x97 } },  // nearrow
+    {  3002, 16, 5, { 0xE2, 0xAA, 0xAF, 0xCC, 0xB8 } },  // NotPrecedesEqual
+    {  8279,  2, 3, { 0xE2, 0x88, 0x88 } },  // in
+    { 12619,  4, 3, { 0xE2, 0x99, 0xAA } },  // sung
+    { 11868,  6, 3, { 0xE2, 0x8B, 0x8C } },  // rthree
+    { 11203,  6, 3, { 0xE2, 0x8A, 0xB0 } },  // prurel
+    {  2679,  9, 3, { 0xE2, 0x88, 0x84 } },  // NotExists
+    { 12565, 11, 3, { 0xE2, 0x89, 0xBD } },  // succcurlyeq
+    {  3916, 18, 3, { 0xE2, 0xA5, 0x95 } },  // RightDownVectorBar
+    { 10065,  4, 3, { 0xE2, 0x88, 0xA4 } },  // nmid
+    {  6490,  5, 1, { 0x2C } },  // comma
+    {  5070,  4, 4, { 0xF0, 0x9D, 0x95, 0x8F } },  // Xopf
+    { 12303,  8, 3, { 0xE2, 0x8A, 0x8F } },  // sqsubset
+    {  5723,  6, 3, { 0xE2, 0x8B, 0x81 } },  // bigvee
+    {  4984, 17, 3, { 0xE2, 0x9D, 0x98 } },  // VerticalSeparator
+    { 10417,  6, 2, { 0xC3, 0xB1 } },  // ntilde
+    { 13274,  8, 3, { 0xE2, 0x8C, 0x9C } },  // ulcorner
+    {  9599,  7, 3, { 0xE2, 0xA8, 0xAA } },  // minusdu
+    { 12024,  4, 2, { 0xC2, 0xA7 } },  // sect
+    {  1861, 11, 3, { 0xE2, 0x8C, 0x88 } },  // LeftCeiling
+    {  5038,  6, 3, { 0xE2, 0x8A, 0xAA } },  // Vvdash
+    {  1324,  6, 2, { 0xC4, 0x9E } },  // Gbreve
+    {  7927,  7, 3, { 0xE2, 0xA9, 0xBC } },  // gtquest
+    { 11324,  4, 3, { 0xE2, 0x9F, 0xA9 } },  // rang
+    {  7123,  6, 3, { 0xE2, 0x8C, 0x8C } },  // drcrop
+    {  8562,  4, 3, { 0xE2, 0x9F, 0xA8 } },  // lang
+    {  6003,  5, 3, { 0xE2, 0x94, 0x90 } },  // boxdl
+    { 13508,  6, 2, { 0xCF, 0x95 } },  // varphi
+    {  5227,  5, 3, { 0xE2, 0x84, 0xB5 } },  // aleph
+    {  6120,  5, 2, { 0xCB, 0x98 } },  // breve
+    {  5648,  7, 3, { 0xE2, 0xA8, 0x80 } },  // bigodot
+    {  1937,  9, 3, { 0xE2, 0x8C, 0x8A } },  // LeftFloor
+    {  8121, 14, 3, { 0xE2, 0x86, 0xAA } },  // hookrightarrow
+    { 13528,  4, 3, { 0xE2, 0x86, 0x95 } },  // varr
+    {  3547,  3, 4, { 0xF0, 0x9D, 0x94, 0x93 } },  // Pfr
+    {  6969,  6, 3, { 0xE2, 0x8B, 0x87 } },  // divonx
+    {  2974, 17, 5, { 0xE2, 0xAA, 0xA1, 0xCC, 0xB8 } },  // NotNestedLessLess
+    {  6135,  5, 3, { 0xE2, 0x81, 0x8F } },  // bsemi
+    {  6321,  5, 3, { 0xE2, 0x9C, 0x93 } },  // check
+    { 10630,  5, 3, { 0xE2, 0x8A, 0x9D } },  // odash
+    {  9132,  5, 3, { 0xE2, 0x9F, 0xAC } },  // loang
+    {  1472,  3, 1, { 0x5E } },  // Hat
+    {  6241,  5, 3, { 0xE2, 0x81, 0x81 } },  // caret
+    {  1103,  4, 2, { 0xC4, 0x96 } },  // Edot
+    {  9418,  5, 3, { 0xE2, 0x8A, 0xB4 } },  // ltrie
+    {  5160,  3, 3, { 0xE2, 0x84, 0xA8 } },  // Zfr
+    { 10255,  4, 4, { 0xF0, 0x9D, 0x93, 0x83 } },  // nscr
+    {  2698, 15, 3, { 0xE2, 0x89, 0xB1 } },  // NotGreaterEqual
+    { 11286,  6, 3, { 0xE2, 0xA4, 0x9C } },  // rAtail
+    {  2377,  6, 2, { 0xC5, 0x81 } },  // Lstrok
+    {  9936,  3, 3, { 0xE2, 0x89, 0xAF } },  // ngt
+    { 13942,  4, 2, { 0xC3, 0xBF } },  // yuml
+    {  7403, 11, 3, { 0xE2, 0xAA, 0x95 } },  // eqslantless
+    {  9842,  5, 3, { 0xE2, 0x87, 0x97 } },  // neArr
+    {  6511, 10, 3, { 0xE2, 0x88, 0x81 } },  // complement
+    {  7767,  4, 3, { 0xE2, 0x89, 0xA7 } },  // geqq
+    {  6037,  8, 3, { 0xE2, 0x8A, 0x9F } },  // boxminus
+    {  6219,  6, 3, { 0xE2, 0xA9, 0x8B } },  // capcap
+    {  4617, 10, 3, { 0xE2, 0x89, 0x88 } },  // TildeTilde
+    {  7469,  3, 2, { 0xCE, 0xB7 } },  // eta
+    { 11454,  6, 1, { 0x5D } },  // rbrack
+    {  3405,  6, 2, { 0xC3, 0x92 } },  // Ograve
+    {  8427,  5, 2, { 0xC4, 0xB5 } },  // jcirc
+    {  4391,  4, 4, { 0xF0, 0x9D, 0x92, 0xAE } },  // Sscr
+    {  1645, 14, 3, { 0xE2, 0x81, 0xA2 } },  // InvisibleTimes
+    {  4552,  3, 4, { 0xF0, 0x9D, 0x94, 0x97 } },  // Tfr
+    {  9828,  4, 3, { 0xE2, 0xA9, 0x82 } },  // ncup
+    {  3834, 19, 3, { 0xE2, 0x87, 0x84 } },  // RightArrowLeftArrow
+    {  8672,  6, 1, { 0x5B } },  // lbrack
+    { 11119,  8, 3, { 0xE2, 0x8B, 0xA8 } },  // precnsim
+    {   533, 14, 2, { 0xCB, 0x99 } },  // DiacriticalDot
+    {  2437,  6, 2, { 0xC5, 0x83 } },  // Nacute
+    {  9078,  6, 2, { 0xC5, 0x80 } },  // lmidot
+    {  2688, 10, 3, { 0xE2, 0x89, 0xAF } },  // NotGreater
+    {  1006, 15, 3, { 0xE2, 0x87, 0x81 } },  // DownRightVector
+    {   503,  3, 2, { 0xD0, 0x94 } },  // Dcy
+    { 12814,  4, 3, { 0xE2, 0x8E, 0xB4 } },  // tbrk
+    {  1960, 15, 3, { 0xE2, 0xA5, 0x8E } },  // LeftRightVector
+    { 12910,  6, 3, { 0xE2, 0x88, 0xBC } },  // thksim
+    {  8947,  4, 6, { 0xE2, 0x8B, 0x9A, 0xEF, 0xB8, 0x80 } },  // lesg
+    { 10753,  5, 3, { 0xE2, 0xA6, 0xB9 } },  // operp
+    { 12247,  4, 4, { 0xF0, 0x9D, 0x95, 0xA4 } },  // sopf
+    { 10403, 10, 5, { 0xE2, 0xAB, 0x86, 0xCC, 0xB8 } },  // nsupseteqq
+    { 12100,  3, 2, { 0xC2, 0xAD } },  // shy
+    {  2577,  7, 3, { 0xE2, 0x81, 0xA0 } },  // NoBreak
+    {  9991,  3, 3, { 0xE2, 0x89, 0xB0 } },  // nle
+    { 11880,  4, 3, { 0xE2, 0x96, 0xB9 } },  // rtri
+    {  4008, 18, 3, { 0xE2, 0x8A, 0xB5 } },  // RightTriangleEqual
+    {   621,  4, 4, { 0xF0, 0x9D, 0x94, 0xBB } },  // Dopf
+    {  9473,  7, 3, { 0xE2, 0x9C, 0xA0 } },  // maltese
+    {  8359,  4, 2, { 0xCE, 0xB9 } },  // iota
+    {  4482,  3, 3, { 0xE2, 0x8B, 0x91 } },  // Sup
+    { 11233,  6, 3, { 0xE2, 0x81, 0x97 } },  // qprime
+    {  9499, 10, 3, { 0xE2, 0x86, 0xA4 } },  // mapstoleft
+    {  6909,  7, 3, { 0xE2, 0x8B, 0x84 } },  // diamond
+    {  1872, 17, 3, { 0xE2, 0x9F, 0xA6 } },  // LeftDoubleBracket
+    {  5119,  4, 2, { 0xD0, 0x96 } },  // ZHcy
+    {  2241,  6, 2, { 0xC4, 0xBF } },  // Lmidot
+    {  6483,  7, 3, { 0xE2, 0x89, 0x94 } },  // coloneq
+    {  7684,  6, 3, { 0xE2, 0x85, 0x9A } },  // frac56
+    {  6231,  6, 3, { 0xE2, 0xA9, 0x80 } },  // capdot
+    {  6370, 16, 3, { 0xE2, 0x86, 0xBB } },  // circlearrowright
+    {  9118,  4, 3, { 0xE2, 0xAA, 0x87 } },  // lneq
+    {  8346,  4, 2, { 0xD1, 0x91 } },  // iocy
+    {   223,  7, 3, { 0xE2, 0x88, 0xB0 } },  // Cconint
+    {  7344,  4, 3, { 0xE2, 0x8B, 0x95 } },  // epar
+    { 10102,  7, 3, { 0xE2, 0x8B, 0xB7 } },  // notinvb
+    {  4154,  3, 3, { 0xE2, 0x86, 0xB1 } },  // Rsh
+    {  6256,  6, 2, { 0xC4, 0x8D } },  // ccaron
+    {  6246,  5, 2, { 0xCB, 0x87 } },  // caron
+    {  6547,  4, 4, { 0xF0, 0x9D, 0x95, 0x94 } },  // copf
+    {  3591, 13, 3, { 0xE2, 0xAA, 0xAF } },  // PrecedesEqual
+    {  8641,  6, 3, { 0xE2, 0xA4, 0x99 } },  // latail
+    { 12353,  6, 3, { 0xE2, 0x96, 0xA1 } },  // square
+    {  6577,  4, 4, { 0xF0, 0x9D, 0x92, 0xB8 } },  // cscr
+    {  5349,  8, 3, { 0xE2, 0xA6, 0xAF } },  // angmsdah
+    { 11491,  5, 3, { 0xE2, 0x8C, 0x89 } },  // rceil
+    {  8229,  5, 3, { 0xE2, 0x84, 0xA9 } },  // iiota
+    { 11850,  3, 3, { 0xE2, 0x86, 0xB1 } },  // rsh
+    { 10552,  7, 6, { 0xE2, 0x8A, 0xB4, 0xE2, 0x83, 0x92 } },  // nvltrie
+    {  8577,  3, 3, { 0xE2, 0xAA, 0x85 } },  // lap
+    {  2217,  9, 3, { 0xE2, 0x89, 0xB2 } },  // LessTilde
+    {  5082,  4, 2, { 0xD0, 0x87 } },  // YIcy
+    {  5275,  3, 3, { 0xE2, 0x88, 0xA0 } },  // ang
+    {  8457,  5, 2, { 0xD1, 0x94 } },  // jukcy
+    {  4772,  4, 4, { 0xF0, 0x9D, 0x95, 0x8C } },  // Uopf
+    {  6205,  6, 3, { 0xE2, 0xA9, 0x84 } },  // capand
+    {  3647, 10, 3, { 0xE2, 0x88, 0xB7 } },  // Proportion
+    {  8499,  4, 4, { 0xF0, 0x9D, 0x95, 0x9C } },  // kopf
+    {  2600,  4, 3, { 0xE2, 0x84, 0x95 } },  // Nopf
+    { 11857,  5, 3, { 0xE2, 0x80, 0x99 } },  // rsquo
+    {  7335,  5, 2, { 0xC4, 0x99 } },  // eogon
+    {  9489, 10, 3, { 0xE2, 0x86, 0xA7 } },  // mapstodown
+    {  1754,  4, 2, { 0xD0, 0x89 } },  // LJcy
+    {  1455,  4, 4, { 0xF0, 0x9D, 0x92, 0xA2 } },  // Gscr
+    {  1341,  3, 2, { 0xD0, 0x93 } },  // Gcy
+    {  4930,  4, 3, { 0xE2, 0xAB, 0xAB } },  // Vbar
+    {  5957,  5, 3, { 0xE2, 0x95, 0xAC } },  // boxVH
+    {  3236, 21, 3, { 0xE2, 0x8B, 0xA1 } },  // NotSucceedsSlantEqual
+    {  4855, 11, 3, { 0xE2, 0x87, 0x95 } },  // Updownarrow
+    {     0,  5, 2, { 0xC3, 0x86 } },  // AElig
+    {  7460,  5, 3, { 0xE2, 0x89, 0x90 } },  // esdot
+    {  8423,  4, 2, { 0xC3, 0xAF } },  // iuml
+    { 13120,  8, 3, { 0xE2, 0x8F, 0xA2 } },  // trpezium
+    { 13982,  7, 3, { 0xE2, 0x87, 0x9D } },  // zigrarr
+    {  7557,  5, 3, { 0xEF, 0xAC, 0x81 } },  // filig
+    {  5687, 15, 3, { 0xE2, 0x96, 0xBD } },  // bigtriangledown
+    {  7322,  6, 3, { 0xE2, 0x80, 0x85 } },  // emsp14
+    { 12926,  5, 2, { 0xC3, 0x97 } },  // times
+    {  5575,  5, 3, { 0xE2, 0x80, 0x9E } },  // bdquo
+    { 10689,  4, 3, { 0xE2, 0x88, 0xAE } },  // oint
+    { 11507,  7, 3, { 0xE2, 0xA5, 0xA9 } },  // rdldhar
+    {  8186,  3, 2, { 0xD0, 0xB8 } },  // icy
+    {  8026,  4, 3, { 0xE2, 0x86, 0x94 } },  // harr
+    { 10073,  3, 2, { 0xC2, 0xAC } },  // not
+    {  4026, 17, 3, { 0xE2, 0xA5, 0x8F } },  // RightUpDownVector
+    {  8204,  6, 2, { 0xC3, 0xAC } },  // igrave
+    { 12891,  8, 3, { 0xE2, 0x88, 0xBC } },  // thicksim
+    {  4696,  6, 2, { 0xC3, 0x99 } },  // Ugrave
+    {    25,  3, 2, { 0xD0, 0x90 } },  // Acy
+    {  3402,  3, 4, { 0xF0, 0x9D, 0x94, 0x92 } },  // Ofr
+    {  4275, 11, 3, { 0xE2, 0x88, 0x98 } },  // SmallCircle
+    {  9383,  6, 3, { 0xE2, 0x8B, 0x8B } },  // lthree
+    {  9273,  4, 3, { 0xE2, 0xA7, 0xAB } },  // lozf
+    { 13141,  6, 2, { 0xC5, 0xA7 } },  // tstrok
+    { 10641,  4, 3, { 0xE2, 0xA8, 0xB8 } },  // odiv
+    {  5362,  7, 3, { 0xE2, 0x8A, 0xBE } },  // angrtvb
+    {  4644,  6, 2, { 0xC5, 0xA6 } },  // Tstrok
+    { 11438,  5, 3, { 0xE2, 0xA4, 0x8D } },  // rbarr
+    {  8757,  9, 3, { 0xE2, 0x86, 0x90 } },  // leftarrow
+    {   119,  7, 3, { 0xE2, 0x88, 0xB5 } },  // Because
+    {  8102,  6, 3, { 0xE2, 0x88, 0xBB } },  // homtht
+    { 10649,  6, 3, { 0xE2, 0xA6, 0xBC } },  // odsold
+    { 12497,  8, 3, { 0xE2, 0x8A, 0x86 } },  // subseteq
+    {  4522,  5, 2, { 0xD0, 0x8B } },  // TSHcy
+    { 13975,  3, 4, { 0xF0, 0x9D, 0x94, 0xB7 } },  // zfr
+    {  5913,  5, 3, { 0xE2, 0x95, 0xA6 } },  // boxHD
+    {  7716,  2, 3, { 0xE2, 0x89, 0xA7 } },  // gE
+    { 10856,  3, 3, { 0xE2, 0x88, 0xA5 } },  // par
+    {  5341,  8, 3, { 0xE2, 0xA6, 0xAE } },  // angmsdag
+    {  8906,  4, 3, { 0xE2, 0x89, 0xA6 } },  // leqq
+    {  4157, 11, 3, { 0xE2, 0xA7, 0xB4 } },  // RuleDelayed
+    { 10577,  5, 3, { 0xE2, 0x87, 0x96 } },  // nwArr
+    { 10069,  4, 4, { 0xF0, 0x9D, 0x95, 0x9F } },  // nopf
+    { 11054,  3, 3, { 0xE2, 0xAA, 0xB3 } },  // prE
+    {  5600,  5, 2, { 0xCF, 0xB6 } },  // bepsi
+    {  4537,  6, 2, { 0xC5, 0xA4 } },  // Tcaron
+    {  1994, 13, 3, { 0xE2, 0xA5, 0x9A } },  // LeftTeeVector
+    {  7414,  6, 1, { 0x3D } },  // equals
+    {  7846,  3, 3, { 0xE2, 0x89, 0xA9 } },  // gnE
+    { 10810,  3, 3, { 0xE2, 0xA9, 0x9B } },  // orv
+    {  6991,  6, 1, { 0x24 } },  // dollar
+    { 13440,  5, 3, { 0xE2, 0x87, 0x88 } },  // uuarr
+    {  4895,  4, 2, { 0xCF, 0x92 } },  // Upsi
+    {  9799,  4, 3, { 0xE2, 0xA9, 0x83 } },  // ncap
+    { 13952,  6, 2, { 0xC5, 0xBE } },  // zcaron
+    {  8536,  6, 2, { 0xC4, 0xBA } },  // lacute
+    { 10314,  7, 3, { 0xE2, 0x8B, 0xA3 } },  // nsqsupe
+    {  2885, 12, 3, { 0xE2, 0x89, 0xB0 } },  // NotLessEqual
+    { 12180, 13, 3, { 0xE2, 0x88, 0x96 } },  // smallsetminus
+    {  5211,  3, 4, { 0xF0, 0x9D, 0x94, 0x9E } },  // afr
+    {  6237,  4, 6, { 0xE2, 0x88, 0xA9, 0xEF, 0xB8, 0x80 } },  // caps
+    { 11292,  5, 3, { 0xE2, 0xA4, 0x8F } },  // rBarr
+    {  4517,  5, 3, { 0xE2, 0x84, 0xA2 } },  // TRADE
+    {  5369,  8, 3, { 0xE2, 0xA6, 0x9D } },  // angrtvbd
+    {  1185, 10, 3, { 0xE2, 0x89, 0x82 } },  // EqualTilde
+    {  7221,  5, 2, { 0xC3, 0xAA } },  // ecirc
+    {  6900,  5, 3, { 0xE2, 0x87, 0x82 } },  // dharr
+    { 12472,  5, 3, { 0xE2, 0x8A, 0x8A } },  // subne
+    {   136,  4, 2, { 0xCE, 0x92 } },  // Beta
+    {  8467,  6, 2, { 0xCF, 0xB0 } },  // kappav
+    { 11333,  5, 3, { 0xE2, 0xA6, 0xA5 } },  // range
+    { 12017,  7, 3, { 0xE2, 0x86, 0x98 } },  // searrow
+    {  6703, 11, 3, { 0xE2, 0x8B, 0x9F } },  // curlyeqsucc
+    {  9953,  5, 3, { 0xE2, 0xAB, 0xB2 } },  // nhpar
+    {  2184, 11, 3, { 0xE2, 0x89, 0xB6 } },  // LessGreater
+    {  5325,  8, 3, { 0xE2, 0xA6, 0xAC } },  // angmsdae
+    {  7331,  4, 3, { 0xE2, 0x80, 0x82 } },  // ensp
+    {  4072, 16, 3, { 0xE2, 0xA5, 0x94 } },  // RightUpVectorBar
+    {  8270,  4, 3, { 0xE2, 0x8A, 0xB7 } },  // imof
+    {  2658,  8, 3, { 0xE2, 0x89, 0xA0 } },  // NotEqual
+    {  3091, 21, 3, { 0xE2, 0x8B, 0xAD } },  // NotRightTriangleEqual
+    {  6285,  4, 2, { 0xC4, 0x8B } },  // cdot
+    {  6644,  8, 3, { 0xE2, 0xA9, 0x88 } },  // cupbrcap
+    {  5482,  5, 3, { 0xE2, 0xA8, 0x91 } },  // awint
+    { 10678,  3, 3, { 0xE2, 0xA7, 0x81 } },  // ogt
+    {  9054,  5, 3, { 0xE2, 0x87, 0x87 } },  // llarr
+    { 12216,  3, 3, { 0xE2, 0xAA, 0xAA } },  // smt
+    { 10921,  3, 2, { 0xCF, 0x86 } },  // phi
+    {  9677, 15, 3, { 0xE2, 0x87, 0x8E } },  // nLeftrightarrow
+    {  5030,  4, 4, { 0xF0, 0x9D, 0x95, 0x8D } },  // Vopf
+    {   628,  6, 3, { 0xE2, 0x83, 0x9C } },  // DotDot
+    { 11909,  2, 3, { 0xE2, 0x84, 0x9E } },  // rx
+    { 12257,  9, 3, { 0xE2, 0x99, 0xA0 } },  // spadesuit
+    {  7907,  4, 3, { 0xE2, 0xAA, 0xA7 } },  // gtcc
+    {  5457,  7, 3, { 0xE2, 0x89, 0x8D } },  // asympeq
+    { 10763,  2, 3, { 0xE2, 0x88, 0xA8 } },  // or
+    { 12734,  9, 3, { 0xE2, 0x8A, 0x8B } },  // supsetneq
+    {  6149,  4, 1, { 0x5C } },  // bsol
+    {  7479,  4, 3, { 0xE2, 0x82, 0xAC } },  // euro
+    {  9906,  3, 3, { 0xE2, 0x89, 0xB1 } },  // nge
+    { 10330,  5, 3, { 0xE2, 0x8A, 0x88 } },  // nsube
+    {  4866, 14, 3, { 0xE2, 0x86, 0x96 } },  // UpperLeftArrow
+    {  6153,  5, 3, { 0xE2, 0xA7, 0x85 } },  // bsolb
+    {  1706,  4, 4, { 0xF0, 0x9D, 0x92, 0xA5 } },  // Jscr
+    {   514,  3, 4, { 0xF0, 0x9D, 0x94, 0x87 } },  // Dfr
+    {  7055,  9, 3, { 0xE2, 0x86, 0x93 } },  // downarrow
+    {  5499, 11, 2, { 0xCF, 0xB6 } },  // backepsilon
+    { 13926,  4, 2, { 0xD1, 0x97 } },  // yicy
+    {  5626,  3, 4, { 0xF0, 0x9D, 0x94, 0x9F } },  // bfr
+    {  4458, 13, 3, { 0xE2, 0x89, 0xBF } },  // SucceedsTilde
+    {  3377,  5, 2, { 0xC5, 0x92 } },  // OElig
+    {   362,  6, 3, { 0xE2, 0xA9, 0xB4 } },  // Colone
+    {  7004,  5, 3, { 0xE2, 0x89, 0x90 } },  // doteq
+    { 12874,  6, 2, { 0xCF, 0x91 } },  // thetav
+    { 13199,  4, 3, { 0xE2, 0x86, 0x91 } },  // uarr
+    {  3687,  4, 4, { 0xF0, 0x9D, 0x92, 0xAC } },  // Qscr
+    { 10918,  3, 4, { 0xF0, 0x9D, 0x94, 0xAD } },  // pfr
+    { 11894,  8, 3, { 0xE2, 0xA7, 0x8E } },  // rtriltri
+    {  7747,  5, 2, { 0xC4, 0x9D } },  // gcirc
+    {  7171,  7, 3, { 0xE2, 0xA6, 0xA6 } },  // dwangle
+    { 13093,  8, 3, { 0xE2, 0xA8, 0xBA } },  // triminus
+    {  6732,  6, 2, { 0xC2, 0xA4 } },  // curren
+    {  7446,  5, 3, { 0xE2, 0x89, 0x93 } },  // erDot
+    {  7211,  6, 2, { 0xC4, 0x9B } },  // ecaron
+    { 13934,  4, 4, { 0xF0, 0x9D, 0x93, 0x8E } },  // yscr
+    { 12743, 10, 3, { 0xE2, 0xAB, 0x8C } },  // supsetneqq
+    { 12609,  7, 3, { 0xE2, 0x89, 0xBF } },  // succsim
+    {  1214,  3, 2, { 0xCE, 0x97 } },  // Eta
+    {  8399,  6, 3, { 0xE2, 0x8B, 0xB3 } },  // isinsv
+    {   634,  8, 3, { 0xE2, 0x89, 0x90 } },  // DotEqual
+    {  6997,  4, 4, { 0xF0, 0x9D, 0x95, 0x95 } },  // dopf
+    {  6013,  4, 3, { 0xE2, 0x94, 0x80 } },  // boxh
+    {  6045,  7, 3, { 0xE2, 0x8A, 0x9E } },  // boxplus
+    {  4753,  5, 3, { 0xE2, 0x8B, 0x83 } },  // Union
+    {  7678,  6, 3, { 0xE2, 0x85, 0x98 } },  // frac45
+    {  3284, 16, 3, { 0xE2, 0x8A, 0x89 } },  // NotSupersetEqual
+    { 12237,  4, 3, { 0xE2, 0xA7, 0x84 } },  // solb
+    {  1169,  4, 4, { 0xF0, 0x9D, 0x94, 0xBC } },  // Eopf
+    {  5846,  5, 3, { 0xE2, 0x96, 0x93 } },  // blk34
+    {  7567,  4, 3, { 0xE2, 0x99, 0xAD } },  // flat
+    {  6065,  5, 3, { 0xE2, 0x95, 0x98 } },  // boxuR
+    {  7266,  2, 3, { 0xE2, 0xAA, 0x99 } },  // el
+    {  9757,  7, 3, { 0xE2, 0x89, 0x89 } },  // napprox
+    {  6572,  5, 3, { 0xE2, 0x9C, 0x97 } },  // cross
+    {  5014, 13, 3, { 0xE2, 0x80, 0x8A } },  // VeryThinSpace
+    { 13779,  6, 3, { 0xE2, 0x89, 0x80 } },  // wreath
+    { 10377,  5, 5, { 0xE2, 0xAB, 0x86, 0xCC, 0xB8 } },  // nsupE
+    {   896, 16, 3, { 0xE2, 0x87, 0xB5 } },  // DownArrowUpArrow
+    {  6841,  6, 2, { 0xC4, 0x8F } },  // dcaron
+    {  3577,  4, 3, { 0xE2, 0x84, 0x99 } },  // Popf
+    {  6927,  5, 3, { 0xE2, 0x99, 0xA6 } },  // diams
+    { 12514,  9, 3, { 0xE2, 0x8A, 0x8A } },  // subsetneq
+    { 11134,  5, 3, { 0xE2, 0x80, 0xB2 } },  // prime
+    {  3112, 15, 5, { 0xE2, 0x8A, 0x8F, 0xCC, 0xB8 } },  // NotSquareSubset
+    {  4059, 13, 3, { 0xE2, 0x86, 0xBE } },  // RightUpVector
+    {  9657,  3, 5, { 0xE2, 0x8B, 0x99, 0xCC, 0xB8 } },  // nGg
+    {  1483, 12, 3, { 0xE2, 0x84, 0x8B } },  // HilbertSpace
+    {  3209, 11, 3, { 0xE2, 0x8A, 0x81 } },  // NotSucceeds
+    {  1293, 10, 3, { 0xE2, 0x84, 0xB1 } },  // Fouriertrf
+    { 10361,  5, 3, { 0xE2, 0x8A, 0x81 } },  // nsucc
+    {  4906,  5, 2, { 0xC5, 0xAE } },  // Uring
+    {  2231, 10, 3, { 0xE2, 0x87, 0x9A } },  // Lleftarrow
+    { 12129,  4, 3, { 0xE2, 0x89, 0x83 } },  // sime
+    {   143,  4, 4, { 0xF0, 0x9D, 0x94, 0xB9 } },  // Bopf
+    {  5129,  6, 2, { 0xC5, 0xBD } },  // Zcaron
+    {  9000,  7, 3, { 0xE2, 0x89, 0xB2 } },  // lesssim
+    { 10911,  7, 3, { 0xE2, 0x80, 0xB1 } },  // pertenk
+    {  8703,  6, 2, { 0xC4, 0xBC } },  // lcedil
+    {  9927,  4, 5, { 0xE2, 0xA9, 0xBE, 0xCC, 0xB8 } },  // nges
+    {  7837,  3, 3, { 0xE2, 0xAA, 0x92 } },  // glE
+    {  5899,  5, 3, { 0xE2, 0x95, 0x96 } },  // boxDl
+    { 12420, 11, 2, { 0xCF, 0x95 } },  // straightphi
+    {  9725,  5, 3, { 0xE2, 0x88, 0x87 } },  // nabla
+    {  8193,  5, 2, { 0xC2, 0xA1 } },  // iexcl
+    {  8051,  6, 3, { 0xE2, 0x99, 0xA5 } },  // hearts
+    {  7853,  8, 3, { 0xE2, 0xAA, 0x8A } },  // gnapprox
+    { 10051,  3, 3, { 0xE2, 0x89, 0xAE } },  // nlt
+    {  7718,  3, 3, { 0xE2, 0xAA, 0x8C } },  // gEl
+    { 10606,  2, 3, { 0xE2, 0x93, 0x88 } },  // oS
+    {  6317,  4, 2, { 0xD1, 0x87 } },  // chcy
+    {  6879,  7, 3, { 0xE2, 0xA6, 0xB1 } },  // demptyv
+    {  8974,  9, 3, { 0xE2, 0x8B, 0x9A } },  // lesseqgtr
+    {  8542,  8, 3, { 0xE2, 0xA6, 0xB4 } },  // laemptyv
+    { 11790,  5, 3, { 0xE2, 0x9F, 0xA7 } },  // robrk
+    {  9367,  2, 1, { 0x3C } },  // lt
+    { 12616,  3, 3, { 0xE2, 0x88, 0x91 } },  // sum
+    {  6604,  7, 3, { 0xE2, 0xA4, 0xB8 } },  // cudarrl
+    {  6790,  6, 3, { 0xE2, 0x8C, 0xAD } },  // cylcty
+    { 13546, 12, 6, { 0xE2, 0x8A, 0x8A, 0xEF, 0xB8, 0x80 } },  // varsubsetneq
+    {  2260, 18, 3, { 0xE2, 0x9F, 0xB7 } },  // LongLeftRightArrow
+    {  6027,  5, 3, { 0xE2, 0x94, 0xAC } },  // boxhd
+    { 12055,  3, 4, { 0xF0, 0x9D, 0x94, 0xB0 } },  // sfr
+    { 11853,  4, 1, { 0x5D } },  // rsqb
+    {  6104,  5, 3, { 0xE2, 0x94, 0xA4 } },  // boxvl
+    { 13822,  5, 3, { 0xE2, 0x9F, 0xB8 } },  // xlArr
+    {   147,  5, 2, { 0xCB, 0x98 } },  // Breve
+    {  9401,  7, 3, { 0xE2, 0xA9, 0xBB } },  // ltquest
+    {  7696,  6, 3, { 0xE2, 0x85, 0x9E } },  // frac78
+    { 11266,  7, 3, { 0xE2, 0x89, 0x9F } },  // questeq
+    {  9300,  5, 3, { 0xE2, 0x87, 0x8B } },  // lrhar
+    { 10166,  7, 3, { 0xE2, 0xA8, 0x94 } },  // npolint
+    {  7241,  5, 3, { 0xE2, 0x89, 0x92 } },  // efDot
+    {  5065,  3, 4, { 0xF0, 0x9D, 0x94, 0x9B } },  // Xfr
+    {  4631,  9, 3, { 0xE2, 0x83, 0x9B } },  // TripleDot
+    { 11316,  8, 3, { 0xE2, 0xA6, 0xB3 } },  // raemptyv
+    {  8867, 19, 3, { 0xE2, 0x86, 0xAD } },  // leftrightsquigarrow
+    {  8135,  4, 4, { 0xF0, 0x9D, 0x95, 0x99 } },  // hopf
+    { 13406,  5, 2, { 0xC5, 0xAF } },  // uring
+    { 12921,  5, 2, { 0xCB, 0x9C } },  // tilde
+    { 10155,  6, 6, { 0xE2, 0xAB, 0xBD, 0xE2, 0x83, 0xA5 } },  // nparsl
+    { 12846,  6, 3, { 0xE2, 0x88, 0xB4 } },  // there4
+    {  7562,  5, 2, { 0x66, 0x6A } },  // fjlig
+    {  7911,  5, 3, { 0xE2, 0xA9, 0xBA } },  // gtcir
+    {  4229, 14, 3, { 0xE2, 0x86, 0x90 } },  // ShortLeftArrow
+    { 13807,  3, 4, { 0xF0, 0x9D, 0x94, 0xB5 } },  // xfr
+    {  6767,  5, 3, { 0xE2, 0x8B, 0x8E } },  // cuvee
+    { 12717,  8, 3, { 0xE2, 0x8A, 0x87 } },  // supseteq
+    { 10513,  4, 6, { 0xE2, 0x89, 0x8D, 0xE2, 0x83, 0x92 } },  // nvap
+    { 11804,  6, 3, { 0xE2, 0xA8, 0xAE } },  // roplus
+    { 10059,  6, 3, { 0xE2, 0x8B, 0xAC } },  // nltrie
+    {  9332,  4, 3, { 0xE2, 0x89, 0xB2 } },  // lsim
+    { 11971,  8, 3, { 0xE2, 0xA8, 0x93 } },  // scpolint
+    { 10214,  6, 5, { 0xE2, 0x86, 0x9D, 0xCC, 0xB8 } },  // nrarrw
+    {  9509,  8, 3, { 0xE2, 0x86, 0xA5 } },  // mapstoup
+    {  8678,  5, 3, { 0xE2, 0xA6, 0x8B } },  // lbrke
+    {  7891,  4, 3, { 0xE2, 0x89, 0xB3 } },  // gsim
+    { 10335,  7, 6, { 0xE2, 0x8A, 0x82, 0xE2, 0x83, 0x92 } },  // nsubset
+    { 12951,  4, 3, { 0xE2, 0x88, 0xAD } },  // tint
+    { 11608, 14, 3, { 0xE2, 0x86, 0xA3 } },  // rightarrowtail
+    {  6099,  5, 3, { 0xE2, 0x94, 0xBC } },  // boxvh
+    {  9939,  4, 3, { 0xE2, 0x89, 0xAF } },  // ngtr
+    {  2939, 12, 3, { 0xE2, 0x89, 0xB4 } },  // NotLessTilde
+    {  2749, 14, 3, { 0xE2, 0x89, 0xB9 } },  // NotGreaterLess
+    {  7916,  5, 3, { 0xE2, 0x8B, 0x97 } },  // gtdot
+    { 10799,  4, 3, { 0xE2, 0xA9, 0x96 } },  // oror
+    {  6836,  5, 2, { 0xCB, 0x9D } },  // dblac
+    { 11942,  3, 3, { 0xE2, 0xAA, 0xB0 } },  // sce
+    {  3421,  7, 2, { 0xCE, 0x9F } },  // Omicron
+    {  1100,  3, 2, { 0xD0, 0xAD } },  // Ecy
+    {  8218,  5, 3, { 0xE2, 0x88, 0xAD } },  // iiint
+    { 11800,  4, 4, { 0xF0, 0x9D, 0x95, 0xA3 } },  // ropf
+    { 10901,  6, 3, { 0xE2, 0x80, 0xB0 } },  // permil
+    {  9663,  4, 5, { 0xE2, 0x89, 0xAB, 0xCC, 0xB8 } },  // nGtv
+    { 12142,  5, 3, { 0xE2, 0xAA, 0xA0 } },  // simgE
+    { 11575,  5, 3, { 0xE2, 0x87, 0x81 } },  // rhard
+    {  1772,  4, 3, { 0xE2, 0x9F, 0xAA } },  // Lang
+    {   492,  5, 3, { 0xE2, 0xAB, 0xA4 } },  // Dashv
+    { 12771,  5, 3, { 0xE2, 0x87, 0x99 } },  // swArr
+    {  8503,  4, 4, { 0xF0, 0x9D, 0x93, 0x80 } },  // kscr
+    { 13798,  4, 3, { 0xE2, 0x8B, 0x83 } },  // xcup
+    {  8042,  4, 3, { 0xE2, 0x84, 0x8F } },  // hbar
+    {  1982, 12, 3, { 0xE2, 0x86, 0xA4 } },  // LeftTeeArrow
+    { 11785,  5, 3, { 0xE2, 0x87, 0xBE } },  // roarr
+    {  3490,  4, 2, { 0xC3, 0x96 } },  // Ouml
+    { 12539,  6, 3, { 0xE2, 0xAB, 0x95 } },  // subsub
+    {  8807, 14, 3, { 0xE2, 0x87, 0x87 } },  // leftleftarrows
+    {  6816,  4, 3, { 0xE2, 0x86, 0x93 } },  // darr
+    {  6675,  4, 6, { 0xE2, 0x88, 0xAA, 0xEF, 0xB8, 0x80 } },  // cups
+    { 10996,  6, 3, { 0xE2, 0x88, 0x94 } },  // plusdo
+    { 10710,  5, 3, { 0xE2, 0x80, 0xBE } },  // oline
+    {  1696,  3, 2, { 0xD0, 0x99 } },  // Jcy
+    {  5404,  2, 3, { 0xE2, 0x89, 0x88 } },  // ap
+    {  8613,  6, 3, { 0xE2, 0x86, 0xAB } },  // larrlp
+    {  5702, 13, 3, { 0xE2, 0x96, 0xB3 } },  // bigtriangleup
+    {  2226,  3, 4, { 0xF0, 0x9D, 0x94, 0x8F } },  // Lfr
+    {  7732,  6, 2, { 0xCF, 0x9D } },  // gammad
+    {  1790,  6, 2, { 0xC4, 0xBD } },  // Lcaron
+    { 11540,  8, 3, { 0xE2, 0x84, 0x9C } },  // realpart
+    {   179, 20, 3, { 0xE2, 0x85, 0x85 } },  // CapitalDifferentialD
+    {  1459,  2, 3, { 0xE2, 0x89, 0xAB } },  // Gt
+    {  1743,  3, 4, { 0xF0, 0x9D, 0x94, 0x8E } },  // Kfr
+    {  1461,  6, 2, { 0xD0, 0xAA } },  // HARDcy
+    {  8495,  4, 2, { 0xD1, 0x9C } },  // kjcy
+    {  2383,  2, 3, { 0xE2, 0x89, 0xAA } },  // Lt
+    {  9803,  6, 2, { 0xC5, 0x88 } },  // ncaron
+    {  9876,  6, 3, { 0xE2, 0xA4, 0xA8 } },  // nesear
+    { 11209,  4, 4, { 0xF0, 0x9D, 0x93, 0x85 } },  // pscr
+    { 11984,  3, 2, { 0xD1, 0x81 } },  // scy
+    { 12396,  4, 3, { 0xE2, 0x98, 0x86 } },  // star
+    { 13449,  7, 3, { 0xE2, 0xA6, 0xA7 } },  // uwangle
+    {  1563,  5, 2, { 0xC3, 0x8E } },  // Icirc
+    { 13306,  4, 4, { 0xF0, 0x9D, 0x95, 0xA6 } },  // uopf
+    {  7009,  8, 3, { 0xE2, 0x89, 0x91 } },  // doteqdot
+    {   462,  8, 3, { 0xE2, 0xA4, 0x91 } },  // DDotrahd
+    {  6895,  5, 3, { 0xE2, 0x87, 0x83 } },  // dharl
+    {  7246,  3, 4, { 0xF0, 0x9D, 0x94, 0xA2 } },  // efr
+    { 13965,  6, 3, { 0xE2, 0x84, 0xA8 } },  // zeetrf
+    {  8951,  6, 3, { 0xE2, 0xAA, 0x93 } },  // lesges
+    {  5027,  3, 4, { 0xF0, 0x9D, 0x94, 0x99 } },  // Vfr
+    {  2878,  7, 3, { 0xE2, 0x89, 0xAE } },  // NotLess
+    { 13815,  5, 3, { 0xE2, 0x9F, 0xB7 } },  // xharr
+    {  3484,  6, 3, { 0xE2, 0xA8, 0xB7 } },  // Otimes
+    { 12405, 15, 2, { 0xCF, 0xB5 } },  // straightepsilon
+    {  9719,  6, 3, { 0xE2, 0x8A, 0xAE } },  // nVdash
+    { 10859,  4, 2, { 0xC2, 0xB6 } },  // para
+    {  5547,  8, 3, { 0xE2, 0x8C, 0x85 } },  // barwedge
+    { 13971,  4, 2, { 0xCE, 0xB6 } },  // zeta
+    {  3883, 18, 3, { 0xE2, 0xA5, 0x9D } },  // RightDownTeeVector
+    { 12794,  6, 3, { 0xE2, 0xA4, 0xAA } },  // swnwar
+    {  4776,  7, 3, { 0xE2, 0x86, 0x91 } },  // UpArrow
+    {  6599,  5, 3, { 0xE2, 0x8B, 0xAF } },  // ctdot
+    { 12001,  5, 3, { 0xE2, 0x87, 0x98 } },  // seArr
+    { 11057,  4, 3, { 0xE2, 0xAA, 0xB7 } },  // prap
+    { 13083,  6, 3, { 0xE2, 0x97, 0xAC } },  // tridot
+    {  3382,  6, 2, { 0xC3, 0x93 } },  // Oacute
+    {  1975,  7, 3, { 0xE2, 0x8A, 0xA3 } },  // LeftTee
+    {  8173,  6, 2, { 0xC3, 0xAD } },  // iacute
+    {  2388,  3, 2, { 0xD0, 0x9C } },  // Mcy
+    {  9160, 18, 3, { 0xE2, 0x9F, 0xB7 } },  // longleftrightarrow
+    { 13709,  6, 6, { 0xE2, 0xAB, 0x8B, 0xEF, 0xB8, 0x80 } },  // vsubnE
+    {  1535,  9, 3, { 0xE2, 0x89, 0x8F } },  // HumpEqual
+    { 10366,  7, 5, { 0xE2, 0xAA, 0xB0, 0xCC, 0xB8 } },  // nsucceq
+    {  1058,  9, 3, { 0xE2, 0x87, 0x93 } },  // Downarrow
+    {  3164, 22, 3, { 0xE2, 0x8B, 0xA3 } },  // NotSquareSupersetEqual
+    {  9263,  3, 3, { 0xE2, 0x97, 0x8A } },  // loz
+    { 10109,  7, 3, { 0xE2, 0x8B, 0xB6 } },  // notinvc
+    {  4957,  4, 3, { 0xE2, 0x80, 0x96 } },  // Vert
+    {  8432,  3, 2, { 0xD0, 0xB9 } },  // jcy
+    {  8751,  4, 3, { 0xE2, 0x86, 0xB2 } },  // ldsh
+    {  4555,  9, 3, { 0xE2, 0x88, 0xB4 } },  // Therefore
+    {  9436,  7, 3, { 0xE2, 0xA5, 0xA6 } },  // luruhar
+    { 12811,  3, 2, { 0xCF, 0x84 } },  // tau
+    { 13435,  5, 3, { 0xE2, 0x96, 0xB4 } },  // utrif
+    {  5987,  6, 3, { 0xE2, 0xA7, 0x89 } },  // boxbox
+    {  5204,  5, 2, { 0xC3, 0xA6 } },  // aelig
+    {  1659,  5, 2, { 0xC4, 0xAE } },  // Iogon
+    {  4687,  6, 2, { 0xC5, 0xB0 } },  // Udblac
+    {  3979, 13, 3, { 0xE2, 0x8A, 0xB3 } },  // RightTriangle
+    { 11094,  6, 3, { 0xE2, 0xAA, 0xAF } },  // preceq
+    {  3683,  4, 3, { 0xE2, 0x84, 0x9A } },  // Qopf
+    { 12582, 11, 3, { 0xE2, 0xAA, 0xBA } },  // succnapprox
+    {  7438,  8, 3, { 0xE2, 0xA7, 0xA5 } },  // eqvparsl
+    { 10004, 15, 3, { 0xE2, 0x86, 0xAE } },  // nleftrightarrow
+    {  8072,  6, 3, { 0xE2, 0x8A, 0xB9 } },  // hercon
+    {  2067, 15, 3, { 0xE2, 0xA5, 0xA0 } },  // LeftUpTeeVector
+    { 13460,  4, 3, { 0xE2, 0xAB, 0xA8 } },  // vBar
+    {  1311,  2, 1, { 0x3E } },  // GT
+    {   828, 13, 3, { 0xE2, 0x87, 0x91 } },  // DoubleUpArrow
+    { 13912,  5, 2, { 0xC5, 0xB7 } },  // ycirc
+    { 11443,  5, 3, { 0xE2, 0x9D, 0xB3 } },  // rbbrk
+    {  7282,  6, 3, { 0xE2, 0xAA, 0x97 } },  // elsdot
+    {  5220,  7, 3, { 0xE2, 0x84, 0xB5 } },  // alefsym
+    {  7093, 16, 3, { 0xE2, 0x87, 0x82 } },  // downharpoonright
+    {  5406,  3, 3, { 0xE2, 0xA9, 0xB0 } },  // apE
+    { 11149,  5, 3, { 0xE2, 0xAA, 0xB9 } },  // prnap
+    { 13376, 10, 3, { 0xE2, 0x87, 0x88 } },  // upuparrows
+    {  1760,  6, 2, { 0xC4, 0xB9 } },  // Lacute
+    {  7585,  4, 4, { 0xF0, 0x9D, 0x95, 0x97 } },  // fopf
+    { 10351, 10, 5, { 0xE2, 0xAB, 0x85, 0xCC, 0xB8 } },  // nsubseteqq
+    {  6109,  5, 3, { 0xE2, 0x94, 0x9C } },  // boxvr
+    { 12866,  8, 2, { 0xCF, 0x91 } },  // thetasym
+    { 11684, 16, 3, { 0xE2, 0x87, 0x89 } },  // rightrightarrows
+    {  7921,  6, 3, { 0xE2, 0xA6, 0x95 } },  // gtlPar
+    {  9887,  6, 3, { 0xE2, 0x88, 0x84 } },  // nexist
+    {  5635,  7, 3, { 0xE2, 0x97, 0xAF } },  // bigcirc
+    { 10173,  3, 3, { 0xE2, 0x8A, 0x80 } },  // npr
+    { 11111,  8, 3, { 0xE2, 0xAA, 0xB5 } },  // precneqq
+    { 10758,  5, 3, { 0xE2, 0x8A, 0x95 } },  // oplus
+    {  8078,  3, 4, { 0xF0, 0x9D, 0x94, 0xA5 } },  // hfr
+    {  2278, 14, 3, { 0xE2, 0x9F, 0xB6 } },  // LongRightArrow
+    {  9523,  6, 3, { 0xE2, 0xA8, 0xA9 } },  // mcomma
+    {  9325,  4, 4, { 0xF0, 0x9D, 0x93, 0x81 } },  // lscr
+    { 10544,  4, 6, { 0xE2, 0x89, 0xA4, 0xE2, 0x83, 0x92 } },  // nvle
+    {  2109, 10, 3, { 0xE2, 0x86, 0xBC } },  // LeftVector
+    {  8571,  6, 3, { 0xE2, 0x9F, 0xA8 } },  // langle
+    {  8323,  8, 3, { 0xE2, 0x8A, 0xBA } },  // intercal
+    {  8755,  2, 3, { 0xE2, 0x89, 0xA4 } },  // le
+    { 12638,  4, 3, { 0xE2, 0xAB, 0x86 } },  // supE
+    {  2619,  9, 3, { 0xE2, 0x89, 0xAD } },  // NotCupCap
+    {  1805, 16, 3, { 0xE2, 0x9F, 0xA8 } },  // LeftAngleBracket
+    {  5409,  6, 3, { 0xE2, 0xA9, 0xAF } },  // apacir
+    {  9835,  5, 3, { 0xE2, 0x80, 0x93 } },  // ndash
+    { 11052,  2, 3, { 0xE2, 0x89, 0xBA } },  // pr
+    { 11243, 11, 3, { 0xE2, 0x84, 0x8D } },  // quaternions
+    {  4543,  6, 2, { 0xC5, 0xA2 } },  // Tcedil
+    {  7905,  2, 1, { 0x3E } },  // gt
+    {  9893,  7, 3, { 0xE2, 0x88, 0x84 } },  // nexists
+    { 10496,  5, 3, { 0xE2, 0x80, 0x87 } },  // numsp
+    {  5232,  5, 2, { 0xCE, 0xB1 } },  // alpha
+    { 11073, 10, 3, { 0xE2, 0xAA, 0xB7 } },  // precapprox
+    {  6942,  5, 3, { 0xE2, 0x8B, 0xB2 } },  // disin
+    {  8585,  4, 3, { 0xE2, 0x86, 0x90 } },  // larr
+    {  6158,  8, 3, { 0xE2, 0x9F, 0x88 } },  // bsolhsub
+    { 12687,  7, 3, { 0xE2, 0xAB, 0x82 } },  // supmult
+    {  2897, 14, 3, { 0xE2, 0x89, 0xB8 } },  // NotLessGreater
+    { 12800,  5, 2, { 0xC3, 0x9F } },  // szlig
+    {  7895,  5, 3, { 0xE2, 0xAA, 0x8E } },  // gsime
+    {   176,  3, 3, { 0xE2, 0x8B, 0x92 } },  // Cap
+    {  8507,  5, 3, { 0xE2, 0x87, 0x9A } },  // lAarr
+    { 13673,  3, 4, { 0xF0, 0x9D, 0x94, 0xB3 } },  // vfr
+    {  2019, 15, 3, { 0xE2, 0xA7, 0x8F } },  // LeftTriangleBar
+    {  7156,  5, 3, { 0xE2, 0x96, 0xBE } },  // dtrif
+    {  4243, 15, 3, { 0xE2, 0x86, 0x92 } },  // ShortRightArrow
+    {  6341,  4, 3, { 0xE2, 0xA7, 0x83 } },  // cirE
+    {   687, 15, 3, { 0xE2, 0x87, 0x90 } },  // DoubleLeftArrow
+    {  8527,  2, 3, { 0xE2, 0x89, 0xA6 } },  // lE
+    {  7702,  5, 3, { 0xE2, 0x81, 0x84 } },  // frasl
+    {  9037,  6, 3, { 0xE2, 0xA5, 0xAA } },  // lharul
+    {  4650,  6, 2, { 0xC3, 0x9A } },  // Uacute
+    { 11364,  7, 3, { 0xE2, 0xA4, 0xA0 } },  // rarrbfs
+    { 10668,  4, 2, { 0xCB, 0x9B } },  // ogon
+    {  3452, 14, 3, { 0xE2, 0x80, 0x98 } },  // OpenCurlyQuote
+    {  7249,  2, 3, { 0xE2, 0xAA, 0x9A } },  // eg
+    {  8306,  3, 3, { 0xE2, 0x88, 0xAB } },  // int
+    {  7190,  5, 3, { 0xE2, 0xA9, 0xB7 } },  // eDDot
+    {  6464,  8, 3, { 0xE2, 0x99, 0xA3 } },  // clubsuit
+    {  4737, 16, 3, { 0xE2, 0x8F, 0x9D } },  // UnderParenthesis
+    { 13310,  7, 3, { 0xE2, 0x86, 0x91 } },  // uparrow
+    {   971, 17, 3, { 0xE2, 0xA5, 0x96 } },  // DownLeftVectorBar
+    { 12523, 10, 3, { 0xE2, 0xAB, 0x8B } },  // subsetneqq
+    {  7348,  6, 3, { 0xE2, 0xA7, 0xA3 } },  // eparsl
+    {  1080,  3, 2, { 0xC3, 0x90 } },  // ETH
+    { 10886,  3, 2, { 0xD0, 0xBF } },  // pcy
+    { 12995,  5, 3, { 0xE2, 0x84, 0xA2 } },  // trade
+    {  3635,  5, 3, { 0xE2, 0x80, 0xB3 } },  // Prime
+    { 10565,  7, 6, { 0xE2, 0x8A, 0xB5, 0xE2, 0x83, 0x92 } },  // nvrtrie
+    { 10582,  6, 3, { 0xE2, 0xA4, 0xA3 } },  // nwarhk
+    {  1480,  3, 3, { 0xE2, 0x84, 0x8C } },  // Hfr
+    { 10635,  6, 2, { 0xC5, 0x91 } },  // odblac
+    { 11216,  6, 3, { 0xE2, 0x80, 0x88 } },  // puncsp
+    {  7642,  6, 3, { 0xE2, 0x85, 0x9B } },  // frac18
+    { 10517,  6, 3, { 0xE2, 0x8A, 0xAC } },  // nvdash
+    { 11827,  8, 3, { 0xE2, 0xA8, 0x92 } },  // rppolint
+    {  4961, 11, 3, { 0xE2, 0x88, 0xA3 } },  // VerticalBar
+    {  5142, 14, 3, { 0xE2, 0x80, 0x8B } },  // ZeroWidthSpace
+    {  5201,  3, 2, { 0xD0, 0xB0 } },  // acy
+    {  8212,  6, 3, { 0xE2, 0xA8, 0x8C } },  // iiiint
+    {  6501,  4, 3, { 0xE2, 0x88, 0x81 } },  // comp
+    {  5894,  5, 3, { 0xE2, 0x95, 0x94 } },  // boxDR
+    {  2141, 14, 3, { 0xE2, 0x87, 0x94 } },  // Leftrightarrow
+    {   106,  4, 3, { 0xE2, 0xAB, 0xA7 } },  // Barv
+    { 11734, 12, 3, { 0xE2, 0x89, 0x93 } },  // risingdotseq
+    { 13861,  5, 3, { 0xE2, 0x9F, 0xB9 } },  // xrArr
+    {  7032,  9, 3, { 0xE2, 0x8A, 0xA1 } },  // dotsquare
+    {    72,  5, 2, { 0xC3, 0x85 } },  // Aring
+    {  1687,  4, 2, { 0xC3, 0x8F } },  // Iuml
+    {  9281,  6, 3, { 0xE2, 0xA6, 0x93 } },  // lparlt
+    { 13768,  3, 4, { 0xF0, 0x9D, 0x94, 0xB4 } },  // wfr
+    {  5191,  5, 2, { 0xC3, 0xA2 } },  // acirc
+    {  1672,  4, 3, { 0xE2, 0x84, 0x90 } },  // Iscr
+    {  4174,  4, 2, { 0xD0, 0xA8 } },  // SHcy
+    {  5104,  3, 4, { 0xF0, 0x9D, 0x94, 0x9C } },  // Yfr
+    {  7381,  7, 3, { 0xE2, 0x89, 0x95 } },  // eqcolon
+    {  5851,  5, 3, { 0xE2, 0x96, 0x88 } },  // block
+    { 12699,  5, 3, { 0xE2, 0x8A, 0x8B } },  // supne
+    {  1523, 12, 3, { 0xE2, 0x89, 0x8E } },  // HumpDownHump
+    {   166,  4, 2, { 0xC2, 0xA9 } },  // COPY
+    { 13855,  6, 3, { 0xE2, 0xA8, 0x82 } },  // xotime
+    {   383, 15, 3, { 0xE2, 0x88, 0xAE } },  // ContourIntegral
+    {  6950,  6, 2, { 0xC3, 0xB7 } },  // divide
+    { 13669,  4, 1, { 0x7C } },  // vert
+    {  7648,  6, 3, { 0xE2, 0x85, 0x94 } },  // frac23
+    { 13583, 13, 6, { 0xE2, 0xAB, 0x8C, 0xEF, 0xB8, 0x80 } },  // varsupsetneqq
+    {  7279,  3, 3, { 0xE2, 0xAA, 0x95 } },  // els
+    { 13849,  6, 3, { 0xE2, 0xA8, 0x81 } },  // xoplus
+    {    47,  3, 3, { 0xE2, 0xA9, 0x93 } },  // And
+    { 10286,  5, 3, { 0xE2, 0x89, 0x84 } },  // nsime
+    { 10490,  6, 3, { 0xE2, 0x84, 0x96 } },  // numero
+    { 12555, 10, 3, { 0xE2, 0xAA, 0xB8 } },  // succapprox
+    {   116,  3, 2, { 0xD0, 0x91 } },  // Bcy
+    { 10116,  5, 3, { 0xE2, 0x88, 0x8C } },  // notni
+    { 12281,  5, 3, { 0xE2, 0x8A, 0x94 } },  // sqcup
+    {  7178,  4, 2, { 0xD1, 0x9F } },  // dzcy
+    {   672, 15, 3, { 0xE2, 0x87, 0x93 } },  // DoubleDownArrow
+    { 10394,  9, 3, { 0xE2, 0x8A, 0x89 } },  // nsupseteq
+    {  9013,  6, 3, { 0xE2, 0x8C, 0x8A } },  // lfloor
+    {  9752,  5, 2, { 0xC5, 0x89 } },  // napos
+    { 12175,  5, 3, { 0xE2, 0x86, 0x90 } },  // slarr
+    {  7576,  5, 3, { 0xE2, 0x96, 0xB1 } },  // fltns
+    {   814, 14, 3, { 0xE2, 0x8A, 0xA8 } },  // DoubleRightTee
+    {  1116,  7, 3, { 0xE2, 0x88, 0x88 } },  // Element
+    {  7707,  5, 3, { 0xE2, 0x8C, 0xA2 } },  // frown
+    { 13185,  4, 3, { 0xE2, 0x87, 0x91 } },  // uArr
+    {   601,  7, 3, { 0xE2, 0x8B, 0x84 } },  // Diamond
+    {  8926,  6, 3, { 0xE2, 0xA9, 0xBF } },  // lesdot
+    {  5909,  4, 3, { 0xE2, 0x95, 0x90 } },  // boxH
+    {  8743,  8, 3, { 0xE2, 0xA5, 0x8B } },  // ldrushar
+    {  7260,  6, 3, { 0xE2, 0xAA, 0x98 } },  // egsdot
+    {  6434,  4, 3, { 0xE2, 0x89, 0x97 } },  // cire
+    {  4512,  5, 2, { 0xC3, 0x9E } },  // THORN
+    {  5836,  5, 3, { 0xE2, 0x96, 0x92 } },  // blk12
+    {  9369,  4, 3, { 0xE2, 0xAA, 0xA6 } },  // ltcc
+    {  6670,  5, 3, { 0xE2, 0xA9, 0x85 } },  // cupor
+    { 10785,  4, 2, { 0xC2, 0xAA } },  // ordf
+    {  4286,  4, 4, { 0xF0, 0x9D, 0x95, 0x8A } },  // Sopf
+    {  8522,  5, 3, { 0xE2, 0xA4, 0x8E } },  // lBarr
+    {  9815,  5, 3, { 0xE2, 0x89, 0x87 } },  // ncong
+    {  9428,  8, 3, { 0xE2, 0xA5, 0x8A } },  // lurdshar
+    {  8632,  6, 3, { 0xE2, 0x86, 0xA2 } },  // larrtl
+    { 13619, 16, 3, { 0xE2, 0x8A, 0xB3 } },  // vartriangleright
+    {  3713,  6, 3, { 0xE2, 0xA4, 0x96 } },  // Rarrtl
+    {  7001,  3, 2, { 0xCB, 0x99 } },  // dot
+    {  9355,  6, 3, { 0xE2, 0x80, 0x9A } },  // lsquor
+    {  6140,  4, 3, { 0xE2, 0x88, 0xBD } },  // bsim
+    {   497,  6, 2, { 0xC4, 0x8E } },  // Dcaron
+    { 12012,  5, 3, { 0xE2, 0x86, 0x98 } },  // searr
+    {  4767,  5, 2, { 0xC5, 0xB2 } },  // Uogon
+    {  6738, 14, 3, { 0xE2, 0x86, 0xB6 } },  // curvearrowleft
+    { 12161,  7, 3, { 0xE2, 0xA8, 0xA4 } },  // simplus
+    {  1746,  4, 4, { 0xF0, 0x9D, 0x95, 0x82 } },  // Kopf
+    { 10928,  6, 3, { 0xE2, 0x84, 0xB3 } },  // phmmat
+    {  3622, 13, 3, { 0xE2, 0x89, 0xBE } },  // PrecedesTilde
+    {  3640,  7, 3, { 0xE2, 0x88, 0x8F } },  // Product
+    { 13490,  8, 2, { 0xCF, 0xB0 } },  // varkappa
+    {   625,  3, 2, { 0xC2, 0xA8 } },  // Dot
+    {  7426,  5, 3, { 0xE2, 0x89, 0xA1 } },  // equiv
+    { 13008, 12, 3, { 0xE2, 0x96, 0xBF } },  // triangledown
+    {  1107,  3, 4, { 0xF0, 0x9D, 0x94, 0x88 } },  // Efr
+    {  6905,  4, 3, { 0xE2, 0x8B, 0x84 } },  // diam
+    {    20,  5, 2, { 0xC3, 0x82 } },  // Acirc
+    {  8155,  6, 2, { 0xC4, 0xA7 } },  // hstrok
+    { 13000,  8, 3, { 0xE2, 0x96, 0xB5 } },  // triangle
+    {  7949,  6, 3, { 0xE2, 0x8B, 0x97 } },  // gtrdot
+    {  8378,  4, 3, { 0xE2, 0x88, 0x88 } },  // isin
+    { 11580,  5, 3, { 0xE2, 0x87, 0x80 } },  // rharu
+    {   517, 16, 2, { 0xC2, 0xB4 } },  // DiacriticalAcute
+    {  4215, 14, 3, { 0xE2, 0x86, 0x93 } },  // ShortDownArrow
+    {  3056, 16, 3, { 0xE2, 0x8B, 0xAB } },  // NotRightTriangle
+    {  4318, 12, 3, { 0xE2, 0x8A, 0x8F } },  // SquareSubset
+    {  7864,  4, 3, { 0xE2, 0xAA, 0x88 } },  // gneq
+    {  1553,  4, 2, { 0xD0, 0x81 } },  // IOcy
+    {  4915,  6, 2, { 0xC5, 0xA8 } },  // Utilde
+    {  1821,  9, 3, { 0xE2, 0x86, 0x90 } },  // LeftArrow
+    { 13244,  3, 4, { 0xF0, 0x9D, 0x94, 0xB2 } },  // ufr
+    {  9059,  8, 3, { 0xE2, 0x8C, 0x9E } },  // llcorner
+    { 12439,  4, 3, { 0xE2, 0xAB, 0x85 } },  // subE
+    {  6685,  7, 3, { 0xE2, 0xA4, 0xBC } },  // curarrm
+    { 13705,  4, 4, { 0xF0, 0x9D, 0x93, 0x8B } },  // vscr
+    {  9764,  5, 3, { 0xE2, 0x99, 0xAE } },  // natur
+    {  7900,  5, 3, { 0xE2, 0xAA, 0x90 } },  // gsiml
+    {   642, 21, 3, { 0xE2, 0x88, 0xAF } },  // DoubleContourIntegral
+    {  2007, 12, 3, { 0xE2, 0x8A, 0xB2 } },  // LeftTriangle
+    {  7752,  3, 2, { 0xD0, 0xB3 } },  // gcy
+    { 12968,  6, 3, { 0xE2, 0xAB, 0xB1 } },  // topcir
+    {  4715, 10, 3, { 0xE2, 0x8F, 0x9F } },  // UnderBrace
+    {  1128, 16, 3, { 0xE2, 0x97, 0xBB } },  // EmptySmallSquare
+    {  5452,  5, 3, { 0xE2, 0x89, 0x88 } },  // asymp
+    {  8037,  5, 3, { 0xE2, 0x86, 0xAD } },  // harrw
+    { 12006,  6, 3, { 0xE2, 0xA4, 0xA5 } },  // searhk
+    {  8482,  3, 4, { 0xF0, 0x9D, 0x94, 0xA8 } },  // kfr
+    {  7239,  2, 3, { 0xE2, 0x85, 0x87 } },  // ee
+    { 12378,  6, 3, { 0xE2, 0x88, 0x96 } },  // ssetmn
+    {  3468,  4, 4, { 0xF0, 0x9D, 0x92, 0xAA } },  // Oscr
+    {  8309,  6, 3, { 0xE2, 0x8A, 0xBA } },  // intcal
+    {  2341, 14, 3, { 0xE2, 0x86, 0x99 } },  // LowerLeftArrow
+    { 12545,  6, 3, { 0xE2, 0xAB, 0x93 } },  // subsup
+    {  8287,  5, 3, { 0xE2, 0x88, 0x9E } },  // infin
+    { 10789,  4, 2, { 0xC2, 0xBA } },  // ordm
+    { 13445,  4, 2, { 0xC3, 0xBC } },  // uuml
+    {  3273, 11, 6, { 0xE2, 0x8A, 0x83, 0xE2, 0x83, 0x92 } },  // NotSuperset
+    {  6094,  5, 3, { 0xE2, 0x95, 0x9E } },  // boxvR
+    { 11987,  4, 3, { 0xE2, 0x8B, 0x85 } },  // sdot
+    {  6125,  6, 2, { 0xC2, 0xA6 } },  // brvbar
+    {  1206,  4, 3, { 0xE2, 0x84, 0xB0 } },  // Escr
+    { 11019,  7, 3, { 0xE2, 0xA8, 0xA6 } },  // plussim
+    { 12369,  5, 3, { 0xE2, 0x86, 0x92 } },  // srarr
+    {  5044,  5, 2, { 0xC5, 0xB4 } },  // Wcirc
+    {  9414,  4, 3, { 0xE2, 0x97, 0x83 } },  // ltri
+    {  3901, 15, 3, { 0xE2, 0x87, 0x82 } },  // RightDownVector
+    {  8274,  5, 2, { 0xC6, 0xB5 } },  // imped
+    { 10735,  4, 3, { 0xE2, 0xA6, 0xB6 } },  // omid
+    {  1287,  6, 3, { 0xE2, 0x88, 0x80 } },  // ForAll
+    {  7166,  5, 3, { 0xE2, 0xA5, 0xAF } },  // duhar
+    {  3300,  8, 3, { 0xE2, 0x89, 0x81 } },  // NotTilde
+    { 11198,  5, 3, { 0xE2, 0x89, 0xBE } },  // prsim
+    {  1110,  6, 2, { 0xC3, 0x88 } },  // Egrave
+    { 12051,  4, 3, { 0xE2, 0x9C, 0xB6 } },  // sext
+    {  6262,  6, 2, { 0xC3, 0xA7 } },  // ccedil
+    {  3321, 17, 3, { 0xE2, 0x89, 0x87 } },  // NotTildeFullEqual
+    { 11598, 10, 3, { 0xE2, 0x86, 0x92 } },  // rightarrow
+    {  8315,  8, 3, { 0xE2, 0x84, 0xA4 } },  // integers
+    {  1557,  6, 2, { 0xC3, 0x8D } },  // Iacute
+    {   451,  3, 3, { 0xE2, 0x8B, 0x93 } },  // Cup
+    {  6852,  7, 3, { 0xE2, 0x80, 0xA1 } },  // ddagger
+    {   162,  4, 2, { 0xD0, 0xA7 } },  // CHcy
+    { 11083, 11, 3, { 0xE2, 0x89, 0xBC } },  // preccurlyeq
+    {  9073,  5, 3, { 0xE2, 0x97, 0xBA } },  // lltri
+    {  8387,  7, 3, { 0xE2, 0x8B, 0xB5 } },  // isindot
+    {  6084,  5, 3, { 0xE2, 0x95, 0xAA } },  // boxvH
+    {  9423,  5, 3, { 0xE2, 0x97, 0x82 } },  // ltrif
+    {  4399,  3, 3, { 0xE2, 0x8B, 0x90 } },  // Sub
+    {  8516,  6, 3, { 0xE2, 0xA4, 0x9B } },  // lAtail
+    {  6273,  5, 3, { 0xE2, 0xA9, 0x8C } },  // ccups
+    {  7759,  2, 3, { 0xE2, 0x89, 0xA5 } },  // ge
+    { 11460,  5, 3, { 0xE2, 0xA6, 0x8C } },  // rbrke
+    {  3794, 17, 3, { 0xE2, 0x9F, 0xA9 } },  // RightAngleBracket
+    {  5998,  5, 3, { 0xE2, 0x95, 0x92 } },  // boxdR
+    {  1039,  7, 3, { 0xE2, 0x8A, 0xA4 } },  // DownTee
+    {  5938,  5, 3, { 0xE2, 0x95, 0x9A } },  // boxUR
+    {  7078, 15, 3, { 0xE2, 0x87, 0x83 } },  // downharpoonleft
+    {  4668,  5, 2, { 0xD0, 0x8E } },  // Ubrcy
+    {  1443, 12, 3, { 0xE2, 0x89, 0xB3 } },  // GreaterTilde
+    {  6567,  5, 3, { 0xE2, 0x86, 0xB5 } },  // crarr
+    { 12156,  5, 3, { 0xE2, 0x89, 0x86 } },  // simne
+    { 12837,  6, 3, { 0xE2, 0x8C, 0x95 } },  // telrec
+    {   509,  5, 2, { 0xCE, 0x94 } },  // Delta
+    {  7182,  8, 3, { 0xE2, 0x9F, 0xBF } },  // dzigrarr
+    {  7298,  8, 3, { 0xE2, 0x88, 0x85 } },  // emptyset
+    {  5287,  6, 3, { 0xE2, 0x88, 0xA1 } },  // angmsd
+    { 13498, 10, 3, { 0xE2, 0x88, 0x85 } },  // varnothing
+    { 12270,  5, 3, { 0xE2, 0x8A, 0x93 } },  // sqcap
+    {  1571,  4, 2, { 0xC4, 0xB0 } },  // Idot
+    { 10236,  6, 3, { 0xE2, 0x8B, 0xAD } },  // nrtrie
+    { 11756,  3, 3, { 0xE2, 0x80, 0x8F } },  // rlm
+    {  9630,  2, 3, { 0xE2, 0x88, 0x93 } },  // mp
+    {    87,  6, 2, { 0xC3, 0x83 } },  // Atilde
+    {  8725,  5, 3, { 0xE2, 0x80, 0x9C } },  // ldquo
+    {  2666, 13, 5, { 0xE2, 0x89, 0x82, 0xCC, 0xB8 } },  // NotEqualTilde
+    {  7268,  8, 3, { 0xE2, 0x8F, 0xA7 } },  // elinters
+    {  7823,  3, 3, { 0xE2, 0x8B, 0x99 } },  // ggg
+    {  6652,  6, 3, { 0xE2, 0xA9, 0x86 } },  // cupcap
+    {  3709,  4, 3, { 0xE2, 0x86, 0xA0 } },  // Rarr
+    {  8108, 13, 3, { 0xE2, 0x86, 0xA9 } },  // hookleftarrow
+    {  5904,  5, 3, { 0xE2, 0x95, 0x93 } },  // boxDr
+    {  9019,  3, 4, { 0xF0, 0x9D, 0x94, 0xA9 } },  // lfr
+    {  1702,  4, 4, { 0xF0, 0x9D, 0x95, 0x81 } },  // Jopf
+    {  5090,  6, 2, { 0xC3, 0x9D } },  // Yacute
+    {   234,  7, 2, { 0xC2, 0xB8 } },  // Cedilla
+    {  6796,  4, 3, { 0xE2, 0x87, 0x93 } },  // dArr
+    {  5948,  5, 3, { 0xE2, 0x95, 0x99 } },  // boxUr
+    {  5962,  5, 3, { 0xE2, 0x95, 0xA3 } },  // boxVL
+    { 12959,  3, 3, { 0xE2, 0x8A, 0xA4 } },  // top
+    {  4506,  6, 3, { 0xE2, 0x8B, 0x91 } },  // Supset
+    {  9147, 13, 3, { 0xE2, 0x9F, 0xB5 } },  // longleftarrow
+    {  1601,  7, 3, { 0xE2, 0x87, 0x92 } },  // Implies
+    {  2553, 14, 3, { 0xE2, 0x89, 0xAA } },  // NestedLessLess
+    {  8903,  3, 3, { 0xE2, 0x89, 0xA4 } },  // leq
+    {  9443,  9, 6, { 0xE2, 0x89, 0xA8, 0xEF, 0xB8, 0x80 } },  // lvertneqq
+    {  1348,  3, 4, { 0xF0, 0x9D, 0x94, 0x8A } },  // Gfr
+    { 13892,  4, 3, { 0xE2, 0x8B, 0x81 } },  // xvee
+    { 12818,  6, 2, { 0xC5, 0xA5 } },  // tcaron
+    {  9361,  6, 2, { 0xC5, 0x82 } },  // lstrok
+    {  9561,  3, 3, { 0xE2, 0x88, 0xA3 } },  // mid
+    { 10423,  4, 3, { 0xE2, 0x89, 0xB8 } },  // ntlg
+    { 13219,  3, 2, { 0xD1, 0x83 } },  // ucy
+    {  5445,  4, 4, { 0xF0, 0x9D, 0x92, 0xB6 } },  // ascr
+    {  4937,  5, 3, { 0xE2, 0x8A, 0xA9 } },  // Vdash
+    {  5167,  4, 4, { 0xF0, 0x9D, 0x92, 0xB5 } },  // Zscr
+    { 13733,  7, 3, { 0xE2, 0xA6, 0x9A } },  // vzigzag
+    { 10559,  6, 3, { 0xE2, 0xA4, 0x83 } },  // nvrArr
+    { 10959,  7, 3, { 0xE2, 0x84, 0x8E } },  // planckh
+    { 11519,  6, 3, { 0xE2, 0x80, 0x9D } },  // rdquor
+    {  1071,  6, 2, { 0xC4, 0x90 } },  // Dstrok
+    { 13360,  4, 2, { 0xCF, 0x85 } },  // upsi
+    {  9461,  4, 2, { 0xC2, 0xAF } },  // macr
+    {  3550,  3, 2, { 0xCE, 0xA6 } },  // Phi
+    {  9713,  6, 3, { 0xE2, 0x8A, 0xAF } },  // nVDash
+    {  1513,  4, 3, { 0xE2, 0x84, 0x8B } },  // Hscr
+    {  7793,  7, 3, { 0xE2, 0xAA, 0x82 } },  // gesdoto
+    {  6268,  5, 2, { 0xC4, 0x89 } },  // ccirc
+    {  9853,  5, 3, { 0xE2, 0x86, 0x97 } },  // nearr
+    { 10614,  4, 3, { 0xE2, 0x8A, 0x9B } },  // oast
+    { 10827,  6, 2, { 0xC3, 0xB5 } },  // otilde
+    {  1262, 21, 3, { 0xE2, 0x96, 0xAA } },  // FilledVerySmallSquare
+    { 10813,  4, 3, { 0xE2, 0x84, 0xB4 } },  // oscr
+    { 13392,  8, 3, { 0xE2, 0x8C, 0x9D } },  // urcorner
+    {  2449,  6, 2, { 0xC5, 0x85 } },  // Ncedil
+    {    37,  5, 2, { 0xCE, 0x91 } },  // Alpha
+    { 13810,  5, 3, { 0xE2, 0x9F, 0xBA } },  // xhArr
+    {  6892,  3, 4, { 0xF0, 0x9D, 0x94, 0xA1 } },  // dfr
+    {  5054,  3, 4, { 0xF0, 0x9D, 0x94, 0x9A } },  // Wfr
+    {  5049,  5, 3, { 0xE2, 0x8B, 0x80 } },  // Wedge
+    {  5263,  8, 3, { 0xE2, 0xA9, 0x98 } },  // andslope
+    {  5209,  2, 3, { 0xE2, 0x81, 0xA1 } },  // af
+    { 10672,  6, 2, { 0xC3, 0xB2 } },  // ograve
+    {  6008,  5, 3, { 0xE2, 0x94, 0x8C } },  // boxdr
+    { 13189,  4, 3, { 0xE2, 0xA5, 0xA3 } },  // uHar
+    { 12292,  5, 3, { 0xE2, 0x8A, 0x8F } },  // sqsub
+    {  9188, 14, 3, { 0xE2, 0x9F, 0xB6 } },  // longrightarrow
+    {  6611,  7, 3, { 0xE2, 0xA4, 0xB5 } },  // cudarrr
+    { 12634,  4, 2, { 0xC2, 0xB3 } },  // sup3
+    {  6477,  6, 3, { 0xE2, 0x89, 0x94 } },  // colone
+    {  9529,  3, 2, { 0xD0, 0xBC } },  // mcy
+    {  9107,  8, 3, { 0xE2, 0xAA, 0x89 } },  // lnapprox
+    {  5856,  3, 4, { 0x3D, 0xE2, 0x83, 0xA5 } },  // bne
+    {  2495, 17, 3, { 0xE2, 0x80, 0x8B } },  // NegativeThinSpace
+    { 12266,  4, 3, { 0xE2, 0x88, 0xA5 } },  // spar
+    {  4848,  7, 3, { 0xE2, 0x87, 0x91 } },  // Uparrow
+    { 12655,  4, 3, { 0xE2, 0x8A, 0x87 } },  // supe
+    {  8709,  5, 3, { 0xE2, 0x8C, 0x88 } },  // lceil
+    {  9022,  2, 3, { 0xE2, 0x89, 0xB6 } },  // lg
+    {  9576,  6, 2, { 0xC2, 0xB7 } },  // middot
+    {  5422,  4, 1, { 0x27 } },  // apos
+    {  7818,  3, 4, { 0xF0, 0x9D, 0x94, 0xA4 } },  // gfr
+    { 10851,  5, 3, { 0xE2, 0x8C, 0xBD } },  // ovbar
+    {  7141,  6, 2, { 0xC4, 0x91 } },  // dstrok
+    {  7217,  4, 3, { 0xE2, 0x89, 0x96 } },  // ecir
+    {  9695,  3, 6, { 0xE2, 0x89, 0xAA, 0xE2, 0x83, 0x92 } },  // nLt
+    { 11154,  6, 3, { 0xE2, 0x8B, 0xA8 } },  // prnsim
+    { 13089,  4, 3, { 0xE2, 0x89, 0x9C } },  // trie
+    {  3195, 14, 3, { 0xE2, 0x8A, 0x88 } },  // NotSubsetEqual
+    {  5388,  7, 3, { 0xE2, 0x8D, 0xBC } },  // angzarr
+    { 13288,  5, 3, { 0xE2, 0x97, 0xB8 } },  // ultri
+    { 10291,  6, 3, { 0xE2, 0x89, 0x84 } },  // nsimeq
+    {  3393,  3, 2, { 0xD0, 0x9E } },  // Ocy
+    {  4300, 18, 3, { 0xE2, 0x8A, 0x93 } },  // SquareIntersection
+    {  7257,  3, 3, { 0xE2, 0xAA, 0x96 } },  // egs
+    { 12374,  4, 4, { 0xF0, 0x9D, 0x93, 0x88 } },  // sscr
+    {  3965, 14, 3, { 0xE2, 0xA5, 0x9B } },  // RightTeeVector
+    {  4192,  6, 2, { 0xC5, 0xA0 } },  // Scaron
+    { 11911,  6, 2, { 0xC5, 0x9B } },  // sacute
+    { 10572,  5, 6, { 0xE2, 0x88, 0xBC, 0xE2, 0x83, 0x92 } },  // nvsim
+    {  3691,  5, 3, { 0xE2, 0xA4, 0x90 } },  // RBarr
+    {  9982,  5, 3, { 0xE2, 0x86, 0x9A } },  // nlarr
+    {  5301,  8, 3, { 0xE2, 0xA6, 0xA9 } },  // angmsdab
+    {  6864,  7, 3, { 0xE2, 0xA9, 0xB7 } },  // ddotseq
+    { 11301,  4, 5, { 0xE2, 0x88, 0xBD, 0xCC, 0xB1 } },  // race
+    {  8619,  6, 3, { 0xE2, 0xA4, 0xB9 } },  // larrpl
+    { 11353,  6, 3, { 0xE2, 0xA5, 0xB5 } },  // rarrap
+    {  8097,  5, 3, { 0xE2, 0x87, 0xBF } },  // hoarr
+    {  7543,  5, 3, { 0xEF, 0xAC, 0x80 } },  // fflig
+    { 13820,  2, 2, { 0xCE, 0xBE } },  // xi
+    {  7475,  4, 2, { 0xC3, 0xAB } },  // euml
+    {  9900,  3, 4, { 0xF0, 0x9D, 0x94, 0xAB } },  // nfr
+    { 13227,  6, 2, { 0xC5, 0xB1 } },  // udblac
+    { 13222,  5, 3, { 0xE2, 0x87, 0x85 } },  // udarr
+    { 13128,  4, 4, { 0xF0, 0x9D, 0x93, 0x89 } },  // tscr
+    { 11514,  5, 3, { 0xE2, 0x80, 0x9D } },  // rdquo
+    { 12286,  6, 6, { 0xE2, 0x8A, 0x94, 0xEF, 0xB8, 0x80 } },  // sqcups
+    { 10128,  7, 3, { 0xE2, 0x8B, 0xBE } },  // notnivb
+    {  1344,  4, 2, { 0xC4, 0xA0 } },  // Gdot
+    { 11418,  6, 3, { 0xE2, 0xA4, 0x9A } },  // ratail
+    {  8057,  9, 3, { 0xE2, 0x99, 0xA5 } },  // heartsuit
+    {  9550,  3, 4, { 0xF0, 0x9D, 0x94, 0xAA } },  // mfr
+    {  8647,  4, 3, { 0xE2, 0xAA, 0xAD } },  // late
+    {  9277,  4, 1, { 0x28 } },  // lpar
+    {   506,  3, 3, { 0xE2, 0x88, 0x87 } },  // Del
+    {  5943,  5, 3, { 0xE2, 0x95, 0x9C } },  // boxUl
+    { 10387,  7, 6, { 0xE2, 0x8A, 0x83, 0xE2, 0x83, 0x92 } },  // nsupset
+    {  6985,  6, 3, { 0xE2, 0x8C, 0x8D } },  // dlcrop
+    {  6777,  8, 3, { 0xE2, 0x88, 0xB2 } },  // cwconint
+    {  2203, 14, 3, { 0xE2, 0xA9, 0xBD } },  // LessSlantEqual
+    {   199,  7, 3, { 0xE2, 0x84, 0xAD } },  // Cayleys
+    {  9958,  2, 3, { 0xE2, 0x88, 0x8B } },  // ni
+    {  9963,  4, 3, { 0xE2, 0x8B, 0xBA } },  // nisd
+    {  7528,  3, 2, { 0xD1, 0x84 } },  // fcy
+    {  3338, 13, 3, { 0xE2, 0x89, 0x89 } },  // NotTildeTilde
+    {   241,  9, 2, { 0xC2, 0xB7 } },  // CenterDot
+    { 10972,  4, 1, { 0x2B } },  // plus
+    {   858, 17, 3, { 0xE2, 0x88, 0xA5 } },  // DoubleVerticalBar
+    {   488,  4, 3, { 0xE2, 0x86, 0xA1 } },  // Darr
+    {  6251,  5, 3, { 0xE2, 0xA9, 0x8D } },  // ccaps
+    {  9336,  5, 3, { 0xE2, 0xAA, 0x8D } },  // lsime
+    {   447,  4, 4, { 0xF0, 0x9D, 0x92, 0x9E } },  // Cscr
+    { 12199,  8, 3, { 0xE2, 0xA7, 0xA4 } },  // smeparsl
+    { 11730,  4, 2, { 0xCB, 0x9A } },  // ring
+    { 13681,  5, 6, { 0xE2, 0x8A, 0x82, 0xE2, 0x83, 0x92 } },  // vnsub
+    {  6859,  5, 3, { 0xE2, 0x87, 0x8A } },  // ddarr
+    {  2443,  6, 2, { 0xC5, 0x87 } },  // Ncaron
+    {  9614,  6, 3, { 0xE2, 0x88, 0x93 } },  // mnplus
+    { 11991,  5, 3, { 0xE2, 0x8A, 0xA1 } },  // sdotb
+    { 13298,  3, 2, { 0xC2, 0xA8 } },  // uml
+    {  1691,  5, 2, { 0xC4, 0xB4 } },  // Jcirc
+    {  1725,  4, 2, { 0xD0, 0x8C } },  // KJcy
+    { 14000,  4, 3, { 0xE2, 0x80, 0x8C } },  // zwnj
+    { 11965,  6, 3, { 0xE2, 0x8B, 0xA9 } },  // scnsim
+    {  6211,  8, 3, { 0xE2, 0xA9, 0x89 } },  // capbrcup
+    { 12484,  7, 3, { 0xE2, 0xA5, 0xB9 } },  // subrarr
+    {   884, 12, 3, { 0xE2, 0xA4, 0x93 } },  // DownArrowBar
+    { 10507,  6, 3, { 0xE2, 0xA4, 0x84 } },  // nvHarr
+    {  7612,  6, 2, { 0xC2, 0xBD } },  // frac12
+    {  8550,  6, 3, { 0xE2, 0x84, 0x92 } },  // lagran
+    {  9587,  6, 3, { 0xE2, 0x8A, 0x9F } },  // minusb
+    {   297, 24, 3, { 0xE2, 0x88, 0xB2 } },  // ClockwiseContourIntegral
+    {  9606,  4, 3, { 0xE2, 0xAB, 0x9B } },  // mlcp
+    {  2858, 20, 3, { 0xE2, 0x8B, 0xAC } },  // NotLeftTriangleEqual
+    {  8594,  7, 3, { 0xE2, 0xA4, 0x9F } },  // larrbfs
+    {  4833,  5, 3, { 0xE2, 0x8A, 0xA5 } },  // UpTee
+    {  2427,  4, 3, { 0xE2, 0x84, 0xB3 } },  // Mscr
+    { 12805,  6, 3, { 0xE2, 0x8C, 0x96 } },  // target
+    {  2584, 16, 2, { 0xC2, 0xA0 } },  // NonBreakingSpace
+    {  4380, 11, 3, { 0xE2, 0x8A, 0x94 } },  // SquareUnion
+    {  3478,  6, 2, { 0xC3, 0x95 } },  // Otilde
+    { 11222,  3, 4, { 0xF0, 0x9D, 0x94, 0xAE } },  // qfr
+    {  5672,  8, 3, { 0xE2, 0xA8, 0x86 } },  // bigsqcup
+    {   212,  6, 2, { 0xC3, 0x87 } },  // Ccedil
+    { 13364,  5, 2, { 0xCF, 0x92 } },  // upsih
+    {  9970,  4, 2, { 0xD1, 0x9A } },  // njcy
+    {  2305, 18, 3, { 0xE2, 0x9F, 0xBA } },  // Longleftrightarrow
+    {  7955,  9, 3, { 0xE2, 0x8B, 0x9B } },  // gtreqless
+    {  4972, 12, 1, { 0x7C } },  // VerticalLine
+    {  3501,  9, 3, { 0xE2, 0x8F, 0x9E } },  // OverBrace
+    {  8410,  2, 3, { 0xE2, 0x81, 0xA2 } },  // it
+    {  9974,  5, 3, { 0xE2, 0x87, 0x8D } },  // nlArr
+    {  3705,  4, 3, { 0xE2, 0x9F, 0xAB } },  // Rang
+    { 10245,  6, 3, { 0xE2, 0x8B, 0xA1 } },  // nsccue
+    { 10523,  4, 6, { 0xE2, 0x89, 0xA5, 0xE2, 0x83, 0x92 } },  // nvge
+    { 12359,  6, 3, { 0xE2, 0x96, 0xAA } },  // squarf
+    { 13745,  6, 3, { 0xE2, 0xA9, 0x9F } },  // wedbar
+    {  9582,  5, 3, { 0xE2, 0x88, 0x92 } },  // minus
+    {  9632,  4, 4, { 0xF0, 0x9D, 0x93, 0x82 } },  // mscr
+    {  6294,  7, 3, { 0xE2, 0xA6, 0xB2 } },  // cemptyv
+    {  8850, 17, 3, { 0xE2, 0x87, 0x8B } },  // leftrightharpoons
+    {  8010,  4, 2, { 0xC2, 0xBD } },  // half
+    {  8374,  4, 4, { 0xF0, 0x9D, 0x92, 0xBE } },  // iscr
+    {  5779, 17, 3, { 0xE2, 0x96, 0xBE } },  // blacktriangledown
+    {  9244,  7, 3, { 0xE2, 0xA8, 0xB4 } },  // lotimes
+    {  6472,  5, 1, { 0x3A } },  // colon
+    {  7974,  7, 3, { 0xE2, 0x89, 0xB7 } },  // gtrless
+    {  2402,  9, 3, { 0xE2, 0x84, 0xB3 } },  // Mellintrf
+    {  5183,  2, 3, { 0xE2, 0x88, 0xBE } },  // ac
+    {  8004,  6, 3, { 0xE2, 0x80, 0x8A } },  // hairsp
+    {  2825, 15, 3, { 0xE2, 0x8B, 0xAA } },  // NotLeftTriangle
+    {  8529,  3, 3, { 0xE2, 0xAA, 0x8B } },  // lEg
+    {  5188,  3, 3, { 0xE2, 0x88, 0xBF } },  // acd
+    {  9127,  5, 3, { 0xE2, 0x8B, 0xA6 } },  // lnsim
+    {  4880, 15, 3, { 0xE2, 0x86, 0x97 } },  // UpperRightArrow
+    {  5096,  5, 2, { 0xC5, 0xB6 } },  // Ycirc
+    { 11394,  6, 3, { 0xE2, 0xA5, 0x85 } },  // rarrpl
+    { 11560,  6, 3, { 0xE2, 0xA5, 0xBD } },  // rfisht
+    {  6541,  6, 3, { 0xE2, 0x88, 0xAE } },  // conint
+    { 11525,  4, 3, { 0xE2, 0x86, 0xB3 } },  // rdsh
+    {  9251,  6, 3, { 0xE2, 0x88, 0x97 } },  // lowast
+    {  4212,  3, 4, { 0xF0, 0x9D, 0x94, 0x96 } },  // Sfr
+    { 12955,  4, 3, { 0xE2, 0xA4, 0xA8 } },  // toea
+    {  6075,  5, 3, { 0xE2, 0x94, 0x94 } },  // boxur
+    {  4656,  4, 3, { 0xE2, 0x86, 0x9F } },  // Uarr
+    {  8418,  5, 2, { 0xD1, 0x96 } },  // iukcy
+    {  6412, 11, 3, { 0xE2, 0x8A, 0x9A } },  // circledcirc
+    {  5357,  5, 3, { 0xE2, 0x88, 0x9F } },  // angrt
+    {   585, 16, 2, { 0xCB, 0x9C } },  // DiacriticalTilde
+    {  1283,  4, 4, { 0xF0, 0x9D, 0x94, 0xBD } },  // Fopf
+    {  5715,  8, 3, { 0xE2, 0xA8, 0x84 } },  // biguplus
+    {  2798, 15, 5, { 0xE2, 0x89, 0x8E, 0xCC, 0xB8 } },  // NotHumpDownHump
+    {  5470,  4, 2, { 0xC3, 0xA4 } },  // auml
+    { 12551,  4, 3, { 0xE2, 0x89, 0xBB } },  // succ
+    {  1210,  4, 3, { 0xE2, 0xA9, 0xB3 } },  // Esim
+    {  4361, 19, 3, { 0xE2, 0x8A, 0x92 } },  // SquareSupersetEqual
+    { 13961,  4, 2, { 0xC5, 0xBC } },  // zdot
+    {  4270,  5, 2, { 0xCE, 0xA3 } },  // Sigma
+    {  3018, 21, 3, { 0xE2, 0x8B, 0xA0 } },  // NotPrecedesSlantEqual
+    { 10989,  7, 3, { 0xE2, 0xA8, 0xA2 } },  // pluscir
+    {   342, 15, 3, { 0xE2, 0x80, 0x99 } },  // CloseCurlyQuote
+    {  6752, 15, 3, { 0xE2, 0x86, 0xB7 } },  // curvearrowright
+    {  7821,  2, 3, { 0xE2, 0x89, 0xAB } },  // gg
+    {  6820,  4, 3, { 0xE2, 0x80, 0x90 } },  // dash
+    {  8451,  6, 2, { 0xD1, 0x98 } },  // jsercy
+    { 13920,  3, 2, { 0xC2, 0xA5 } },  // yen
+    {  6345,  4, 2, { 0xCB, 0x86 } },  // circ
+    {  8363,  5, 3, { 0xE2, 0xA8, 0xBC } },  // iprod
+    { 10655,  5, 2, { 0xC5, 0x93 } },  // oelig
+    { 11359,  5, 3, { 0xE2, 0x87, 0xA5 } },  // rarrb
+    {  6225,  6, 3, { 0xE2, 0xA9, 0x87 } },  // capcup
+    {  7548,  6, 3, { 0xEF, 0xAC, 0x84 } },  // ffllig
+    {  9465,  4, 3, { 0xE2, 0x99, 0x82 } },  // male
+    {  6634,  7, 3, { 0xE2, 0xA4, 0xBD } },  // cularrp
+    {    50,  5, 2, { 0xC4, 0x84 } },  // Aogon
+    {  4127, 12, 3, { 0xE2, 0xA5, 0xB0 } },  // RoundImplies
+    { 13762,  6, 3, { 0xE2, 0x84, 0x98 } },  // weierp
+    { 13386,  6, 3, { 0xE2, 0x8C, 0x9D } },  // urcorn
+    {  8473,  6, 2, { 0xC4, 0xB7 } },  // kcedil
+    { 13431,  4, 3, { 0xE2, 0x96, 0xB5 } },  // utri
+    {  9556,  5, 2, { 0xC2, 0xB5 } },  // micro
+    {  4921,  4, 2, { 0xC3, 0x9C } },  // Uuml
+    { 10527,  4, 4, { 0x3E, 0xE2, 0x83, 0x92 } },  // nvgt
+    { 11180,  8, 3, { 0xE2, 0x8C, 0x93 } },  // profsurf
+    { 11305,  6, 2, { 0xC5, 0x95 } },  // racute
+    { 11261,  5, 1, { 0x3F } },  // quest
+    {  8983, 10, 3, { 0xE2, 0xAA, 0x8B } },  // lesseqqgtr
+    {  5619,  7, 3, { 0xE2, 0x89, 0xAC } },  // between
+    { 10803,  7, 3, { 0xE2, 0xA9, 0x97 } },  // orslope
+    {  4660,  8, 3, { 0xE2, 0xA5, 0x89 } },  // Uarrocir
+    { 10907,  4, 3, { 0xE2, 0x8A, 0xA5 } },  // perp
+    {  6714,  8, 3, { 0xE2, 0x8B, 0x8E } },  // curlyvee
+    {  1517,  6, 2, { 0xC4, 0xA6 } },  // Hstrok
+    {  4549,  3, 2, { 0xD0, 0xA2 } },  // Tcy
+    {  8300,  6, 2, { 0xC4, 0xB1 } },  // inodot
+    {  1164,  5, 2, { 0xC4, 0x98 } },  // Eogon
+    {   110,  6, 3, { 0xE2, 0x8C, 0x86 } },  // Barwed
+    {  7964, 10, 3, { 0xE2, 0xAA, 0x8C } },  // gtreqqless
+    { 11297,  4, 3, { 0xE2, 0xA5, 0xA4 } },  // rHar
+    { 12945,  6, 3, { 0xE2, 0xA8, 0xB0 } },  // timesd
+    { 12673,  7, 3, { 0xE2, 0xAB, 0x97 } },  // suphsub
+    {  5680,  7, 3, { 0xE2, 0x98, 0x85 } },  // bigstar
+    { 10054,  5, 3, { 0xE2, 0x8B, 0xAA } },  // nltri
+    { 12759,  6, 3, { 0xE2, 0xAB, 0x94 } },  // supsub
+    { 11066,  3, 3, { 0xE2, 0xAA, 0xAF } },  // pre
+    {  9202, 13, 3, { 0xE2, 0x86, 0xAB } },  // looparrowleft
+    {  3992, 16, 3, { 0xE2, 0xA7, 0x90 } },  // RightTriangleBar
+    { 13293,  5, 2, { 0xC5, 0xAB } },  // umacr
+    {  5967,  5, 3, { 0xE2, 0x95, 0xA0 } },  // boxVR
+    {  6658,  6, 3, { 0xE2, 0xA9, 0x8A } },  // cupcup
+    { 10485,  2, 2, { 0xCE, 0xBD } },  // nu
+    {  8046,  5, 2, { 0xC4, 0xA5 } },  // hcirc
+    { 11033,  2, 2, { 0xC2, 0xB1 } },  // pm
+    {  6551,  6, 3, { 0xE2, 0x88, 0x90 } },  // coprod
+    {  6355, 15, 3, { 0xE2, 0x86, 0xBA } },  // circlearrowleft
+    {  9537, 13, 3, { 0xE2, 0x88, 0xA1 } },  // measuredangle
+    {  6585,  5, 3, { 0xE2, 0xAB, 0x91 } },  // csube
+    {  8532,  4, 3, { 0xE2, 0xA5, 0xA2 } },  // lHar
+    {  5491,  8, 3, { 0xE2, 0x89, 0x8C } },  // backcong
+    {  5737,  6, 3, { 0xE2, 0xA4, 0x8D } },  // bkarow
+    {  6070,  5, 3, { 0xE2, 0x94, 0x98 } },  // boxul
+    {  3521, 15, 3, { 0xE2, 0x8F, 0x9C } },  // OverParenthesis
+    {  2132,  9, 3, { 0xE2, 0x87, 0x90 } },  // Leftarrow
+    {  8967,  7, 3, { 0xE2, 0x8B, 0x96 } },  // lessdot
+    {  4440, 18, 3, { 0xE2, 0x89, 0xBD } },  // SucceedsSlantEqual
+    { 12350,  3, 3, { 0xE2, 0x96, 0xA1 } },  // squ
+    { 13480, 10, 2, { 0xCF, 0xB5 } },  // varepsilon
+    {  3472,  6, 2, { 0xC3, 0x98 } },  // Oslash
+    { 13268,  6, 3, { 0xE2, 0x8C, 0x9C } },  // ulcorn
+    {  4627,  4, 4, { 0xF0, 0x9D, 0x95, 0x8B } },  // Topf
+    {  5247,  3, 1, { 0x26 } },  // amp
+    { 10823,  4, 3, { 0xE2, 0x8A, 0x98 } },  // osol
+    { 11061,  5, 3, { 0xE2, 0x89, 0xBC } },  // prcue
+    { 13652,  5, 3, { 0xE2, 0x89, 0x9A } },  // veeeq
+    { 13113,  7, 3, { 0xE2, 0xA8, 0xBB } },  // tritime
+};
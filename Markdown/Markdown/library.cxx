@@ -0,0 +1,14 @@
+// The parser and the C API in markdown_api.h, without main.cpp or anything
+// that touches files, for building markdown as a static or shared library.
+// Region pages come from the converters' allocators, see markdown_api.cpp.
+#define LK_REGION_CUSTOM_PAGE_ALLOCATOR
+#define TEMP_MEMORY_IMPLEMENTATION
+#include "memory.h"
+
+#include "string.cpp"
+#include "utf8.cpp"
+#include "html_entities.cpp"
+#include "output.cpp"
+#include "parser.cpp"
+#include "formats.cpp"
+#include "markdown_api.cpp"
@@ -15,11 +15,16 @@ struct SLList
 
 	SLList_Node *head = NULL;
 	SLList_Node *tail = NULL;
+	umm count = 0;
 
+	// the value is dropped if the temp region is out of memory, see LK_Region::byte_limit
 	void append(T value)
 	{
 		SLList_Node *new_node = LK_RegionValue(temp, SLList_Node);
+		if (!new_node)
+			return;
 		new_node->value = value;
+		count++;
 
 		if (!head) // first element in list
 		{
@@ -21,6 +21,7 @@ DOCUMENTATION
 
 #include <stdint.h>
 #include <stddef.h>
+#include <string.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -69,6 +70,9 @@ extern "C"
 		void* page_end;
 		void* cursor;
 		void* alloc_head;
+		uintptr_t byte_limit;     /* 0 for no limit, see lk_region_alloc */
+		uintptr_t bytes_reserved; /* bytes currently taken from the OS */
+		uintptr_t failed_allocations;
 	} LK__REGION_CACHE_ALIGN_POST LK_Region;
 
 	/* Use this macro to initialize region variables. Like this:
@@ -76,8 +80,11 @@ extern "C"
 	If you're using C++, you can also do:
 	LK_Region region = { 0 };
 	LK_Region region = {}; // C++11 */
-#define LK_RegionInit { 0, 0, 0, 0 }
+#define LK_RegionInit { 0, 0, 0, 0, 0, 0, 0 }
 
+	/* With a byte_limit set, an allocation that would take the region
+	past it returns NULL, instead of asking the OS for more memory.
+	The region stays usable, rewinding it frees up room again. */
 #ifdef LK_REGION_COLLECT_CALLER_INFO
 #define lk_region_alloc(...) (lk_region_alloc_(__VA_ARGS__, __FUNCTION__))
 	void* lk_region_alloc_(LK_Region* region, size_t size, size_t alignment, const char* caller_name);
@@ -125,8 +132,11 @@ extern "C"
 {
 #endif
 
+	/* 'size' is what the memory was allocated with. A custom page allocator
+	defines these two, and can fall back on lk__region_os_reserve and
+	lk__region_os_release for the memory it doesn't supply itself. */
 	void* lk_region_os_alloc(size_t size, const char* caller_name);
-	void lk_region_os_free(void* memory);
+	void lk_region_os_free(void* memory, size_t size);
 
 #ifdef _WIN32
 	/*********************************************************************************************
@@ -138,22 +148,54 @@ extern "C"
 
 #include <windows.h>
 
-#ifndef LK_REGION_CUSTOM_PAGE_ALLOCATOR
-
-	void* lk_region_os_alloc(size_t size, const char* caller_name)
+	static void* lk__region_os_reserve(size_t size)
 	{
 		return VirtualAlloc(0, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
 	}
 
-	void lk_region_os_free(void* memory)
+	static void lk__region_os_release(void* memory, size_t size)
 	{
 		VirtualFree(memory, 0, MEM_RELEASE);
 	}
 
+#elif defined(__unix__) || defined(__APPLE__)
+	/*********************************************************************************************
+	POSIX-specific
+	*********************************************************************************************/
+#ifndef LK_REGION_DEFAULT_PAGE_SIZE
+#define LK_REGION_DEFAULT_PAGE_SIZE 0x10000 /* 64 kB */
 #endif
 
+#include <sys/mman.h>
+
+	static void* lk__region_os_reserve(size_t size)
+	{
+		/* anonymous mappings are zeroed, like VirtualAlloc gives them */
+		void* memory = mmap(0, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		return memory == MAP_FAILED ? 0 : memory;
+	}
+
+	static void lk__region_os_release(void* memory, size_t size)
+	{
+		munmap(memory, size);
+	}
+
 #else
 #error Unrecognized operating system
+#endif
+
+#ifndef LK_REGION_CUSTOM_PAGE_ALLOCATOR
+
+	void* lk_region_os_alloc(size_t size, const char* caller_name)
+	{
+		return lk__region_os_reserve(size);
+	}
+
+	void lk_region_os_free(void* memory, size_t size)
+	{
+		lk__region_os_release(memory, size);
+	}
+
 #endif
 
 	/*********************************************************************************************
@@ -184,14 +226,25 @@ extern "C"
 		umm big_allocation_threshold = (page_size >> 2);
 		if (size > big_allocation_threshold)
 		{
-			if (alignment < sizeof(void*))
-				alignment = sizeof(void*);
-
-			byte* page = (byte*)lk_region_os_alloc(size + alignment, caller_name);
+			/* the header is the next allocation and the allocation size */
+			if (alignment < 2 * sizeof(void*))
+				alignment = 2 * sizeof(void*);
+
+			umm allocation_size = size + alignment;
+			byte* page = 0;
+			if (!region->byte_limit || allocation_size <= region->byte_limit - region->bytes_reserved)
+				page = (byte*)lk_region_os_alloc(allocation_size, caller_name);
+			if (!page)
+			{
+				region->failed_allocations++;
+				return 0;
+			}
 
 			void** header = (void**)page;
-			*header = region->alloc_head;
+			header[0] = region->alloc_head;
+			header[1] = (void*)allocation_size;
 			region->alloc_head = header;
+			region->bytes_reserved += allocation_size;
 
 			return page + alignment;
 		}
@@ -209,16 +262,25 @@ extern "C"
 		if (end_address > (umm)region->page_end)
 		{
 			/* allocate another page */
-			byte* page = (byte*)lk_region_os_alloc(page_size, caller_name);
+			byte* page = 0;
+			if (!region->byte_limit || page_size <= region->byte_limit - region->bytes_reserved)
+				page = (byte*)lk_region_os_alloc(page_size, caller_name);
+			if (!page)
+			{
+				region->failed_allocations++;
+				return 0;
+			}
 			byte* page_end = page + page_size;
 
 			void** header = (void**)page;
-			*header = region->alloc_head;
+			header[0] = region->alloc_head;
+			header[1] = (void*)page_size;
 
 			region->page_end = page_end;
 			region->alloc_head = header;
+			region->bytes_reserved += page_size;
 
-			void* cursor = header + 1;
+			void* cursor = header + 2;
 
 			/* realign */
 			cursor_address = (umm)cursor;
@@ -243,15 +305,16 @@ extern "C"
 		while (memory)
 		{
 			void** header = (void**)memory;
-			void* next_memory = *header;
+			void* next_memory = header[0];
 
-			lk_region_os_free(memory);
+			lk_region_os_free(memory, (size_t)header[1]);
 			memory = next_memory;
 		}
 
 		region->page_end = 0;
 		region->cursor = 0;
 		region->alloc_head = 0;
+		region->bytes_reserved = 0;
 	}
 
 	void lk_region_cursor(LK_Region* region, LK_Region_Cursor* cursor)
@@ -271,13 +334,15 @@ extern "C"
 		while (memory != new_alloc_head)
 		{
 			void** header = (void**)memory;
-			void* next_memory = *header;
+			void* next_memory = header[0];
+			size_t size = (size_t)header[1];
+			region->bytes_reserved -= size;
 
-			lk_region_os_free(memory);
+			lk_region_os_free(memory, size);
 			memory = next_memory;
 		}
 
-		SIZE_T size;
+		size_t size;
 		if (cursor->page_end == region->page_end)
 		{
 			size = (char*)region->cursor - (char*)new_cursor;
@@ -286,7 +351,8 @@ extern "C"
 		{
 			size = (char*)new_page_end - (char*)new_cursor;
 		}
-		ZeroMemory(new_cursor, size);
+		if (size)
+			memset(new_cursor, 0, size);
 
 		region->page_end = new_page_end;
 		region->cursor = new_cursor;
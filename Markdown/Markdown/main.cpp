@@ -1,27 +1,343 @@
 #include <stdio.h>
+#include <stdlib.h>
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#endif
 
 #include "typedef.h"
 #include "string.h"
 #include "parser.h"
 #include "file_io.h"
+#include "utf8.h"
+#include "benchmark.h"
+#include "document_ir.h"
+#include "formats.h"
+#include "page_template.h"
+#include "search_index.h"
+#include "pipeline.h"
+#include "watch.h"
+#include "gzip_output.h"
+#include "background_output.h"
+#include "profile.h"
 
 #define TEMP_MEMORY_IMPLEMENTATION
 #include "memory.h"
 
 
+static const char *usage =
+	"Usage: markdown.exe [options] filename.md\n"
+	"  --reject-invalid-utf8    fail on invalid UTF-8 input\n"
+	"  --replace-invalid-utf8   replace invalid UTF-8 with U+FFFD (default)\n"
+	"  --utf16                  write UTF-16LE instead of UTF-8\n"
+	"  --gzip FILE              write the HTML gzip compressed to FILE instead of stdout, needs MARKDOWN_ZLIB=1 at compile time\n"
+	"  --out FILE               write the HTML to FILE from a writer thread while parsing, as UTF-8\n"
+	"  --out-buffers N          buffers the parser and the writer thread take turns on, 2 by default\n"
+	"  --out-buffer-size BYTES  size of each of them, 1 MB by default\n"
+	"  --plain-out FILE         with --gzip, also write the uncompressed HTML to FILE\n"
+	"  --toc                    emit a table of contents before the body\n"
+	"  --no-anchors             don't add ids to headers\n"
+	"  --no-front-matter        render a leading ---/+++ block as text instead of leaving it out\n"
+	"  --template FILE          write every document into the page layout in FILE, see page_template.h\n"
+	"  --unsafe-links           keep javascript:, vbscript:, file: and data: link urls, only for trusted input\n"
+	"  --sourcepos              add data-sourcepos=\"line:column-line:column\" to block tags\n"
+	"  --source-map FILE        also write a map from output offsets to input offsets to FILE\n"
+	"  --write-ir FILE          also write the parsed document to FILE as binary IR\n"
+	"  --read-ir FILE           render from the binary IR in FILE instead of parsing\n"
+	"  --text-out FILE          also write the plain text of the document to FILE\n"
+	"  --json-out FILE          also write the document tree as JSON to FILE\n"
+	"  --max-memory BYTES       stop if parsing needs more memory than this\n"
+	"  --max-tokens N           stop if the document has more tokens than this\n"
+	"  --max-depth N            stop if lists are nested deeper than this\n"
+	"  --max-output BYTES       stop if any output gets larger than this\n"
+	"  --bulk                   convert every file given, each to a .html file next to it\n"
+	"  --threads N              parsing threads for --bulk, one per core by default\n"
+	"  --index FILE             with --bulk, also write a search index of every file to FILE\n"
+	"  --search FILE WORD       list the files a search index written by --index has WORD in, by count\n"
+	"  --no-io-uring            use blocking reads for --bulk even where io_uring works\n"
+	"  --stats                  print word, link and code counts and the outline of every file given, as JSON Lines\n"
+	"  --watch DIR              convert every .md file under DIR, and again whenever one changes\n"
+	"  --profile                time the phases of the conversion, needs MARKDOWN_PROFILE=1 at compile time\n"
+	"  --benchmark-utf16        benchmark UTF-16 output instead of converting\n"
+	"  --benchmark-ir           benchmark binary IR loading instead of converting\n"
+	"  --benchmark-out          benchmark writing the output from a writer thread instead of converting\n"
+	"  --benchmark-scaling BYTES  check that parse time grows linearly on hostile input up to BYTES, 32 MB if not given, no file needed\n"
+	"  --benchmark-strings      time string.cpp primitives against libc, 8 B to 64 MB, no file needed\n";
+
 int main(int argc, char* argv[])
 {
 	String path = "C:\\Users\\gabri\\source\\repos\\markdown\\Markdown\\Debug\\test.txt"_s;
+	bool path_given = false;
+
+	UTF8_Policy utf8_policy = UTF8_REPLACE;
+	bool output_utf16 = false;
+	bool run_benchmark_utf16 = false;
+	bool run_benchmark_ir = false;
+	bool run_benchmark_out = false;
+	bool run_benchmark_scaling = false;
+	umm scaling_max_size = 32 * 1024 * 1024;
+	bool run_benchmark_strings = false;
+	bool run_profile = false;
+	String write_ir_path = {};
+	String read_ir_path = {};
+	String text_path = {};
+	String json_path = {};
+	String source_map_path = {};
+	String watch_path = {};
+	String gzip_path = {};
+	String plain_path = {};
+	String out_path = {};
+	umm out_buffer_size = BACKGROUND_OUTPUT_BUFFER_SIZE;
+	u32 out_buffer_count = BACKGROUND_OUTPUT_BUFFER_COUNT;
+	String search_index_path = {};
+	String search_word = {};
+	String template_path = {};
+	Parse_Options parse_options;
+
+	bool bulk = false;
+	bool run_stats = false;
+	Pipeline_Options pipeline_options = {};
+	pipeline_options.allow_io_uring = true;
+	Pipeline_Job* bulk_jobs = LK_RegionArray(temp, Pipeline_Job, argc);
+	umm bulk_job_count = 0;
 
-	if (argc == 2)
+	for (int i = 1; i < argc; i++)
 	{
-		path = make_string(argv[1]);
+		String arg = wrap_string(argv[i]);
+		bool has_value = i + 1 < argc;
+
+		if (arg == "--reject-invalid-utf8")
+			utf8_policy = UTF8_REJECT;
+		else if (arg == "--replace-invalid-utf8")
+			utf8_policy = UTF8_REPLACE;
+		else if (arg == "--utf16")
+			output_utf16 = true;
+		else if (arg == "--gzip" && has_value)
+			gzip_path = make_string(argv[++i]);
+		else if (arg == "--out" && has_value)
+			out_path = make_string(argv[++i]);
+		else if (arg == "--out-buffers" && has_value)
+			out_buffer_count = (u32) strtoul(argv[++i], NULL, 10);
+		else if (arg == "--out-buffer-size" && has_value)
+			out_buffer_size = strtoull(argv[++i], NULL, 10);
+		else if (arg == "--plain-out" && has_value)
+			plain_path = make_string(argv[++i]);
+		else if (arg == "--benchmark-utf16")
+			run_benchmark_utf16 = true;
+		else if (arg == "--benchmark-ir")
+			run_benchmark_ir = true;
+		else if (arg == "--benchmark-out")
+			run_benchmark_out = true;
+		else if (arg == "--benchmark-scaling")
+		{
+			run_benchmark_scaling = true;
+			if (has_value && argv[i + 1][0] >= '0' && argv[i + 1][0] <= '9')
+				scaling_max_size = strtoull(argv[++i], NULL, 10);
+		}
+		else if (arg == "--benchmark-strings")
+			run_benchmark_strings = true;
+		else if (arg == "--bulk")
+			bulk = true;
+		else if (arg == "--stats")
+			run_stats = true;
+		else if (arg == "--profile")
+			run_profile = true;
+		else if (arg == "--threads" && has_value)
+			pipeline_options.worker_count = (u32) strtoul(argv[++i], NULL, 10);
+		else if (arg == "--index" && has_value)
+			pipeline_options.index_path = make_string(argv[++i]);
+		else if (arg == "--search" && i + 2 < argc)
+		{
+			search_index_path = make_string(argv[++i]);
+			search_word = make_string(argv[++i]);
+		}
+		else if (arg == "--no-io-uring")
+			pipeline_options.allow_io_uring = false;
+		else if (arg == "--watch" && has_value)
+			watch_path = make_string(argv[++i]);
+		else if (arg == "--toc")
+			parse_options.table_of_contents = true;
+		else if (arg == "--no-anchors")
+			parse_options.heading_anchors = false;
+		else if (arg == "--no-front-matter")
+			parse_options.front_matter = false;
+		else if (arg == "--template" && has_value)
+			template_path = make_string(argv[++i]);
+		else if (arg == "--unsafe-links")
+			parse_options.unsafe_links = true;
+		else if (arg == "--sourcepos")
+			parse_options.data_sourcepos = true;
+		else if (arg == "--source-map" && has_value)
+		{
+			source_map_path = make_string(argv[++i]);
+			parse_options.source_map = true;
+		}
+		else if (arg == "--write-ir" && has_value)
+			write_ir_path = make_string(argv[++i]);
+		else if (arg == "--read-ir" && has_value)
+			read_ir_path = make_string(argv[++i]);
+		else if (arg == "--text-out" && has_value)
+			text_path = make_string(argv[++i]);
+		else if (arg == "--json-out" && has_value)
+			json_path = make_string(argv[++i]);
+		else if (arg == "--max-memory" && has_value)
+			parse_options.max_memory_bytes = strtoull(argv[++i], NULL, 10);
+		else if (arg == "--max-tokens" && has_value)
+			parse_options.max_tokens = strtoull(argv[++i], NULL, 10);
+		else if (arg == "--max-depth" && has_value)
+			parse_options.max_depth = (u32) strtoul(argv[++i], NULL, 10);
+		else if (arg == "--max-output" && has_value)
+			parse_options.max_output_bytes = strtoull(argv[++i], NULL, 10);
+		else
+		{
+			path = make_string(argv[i]);
+			path_given = true;
+
+			Pipeline_Job* job = &bulk_jobs[bulk_job_count++];
+			job->input_path = path;
+			job->output_path = get_html_path(path);
+			job->converted = false;
+		}
 	}
-	else
+
+	if (run_benchmark_scaling)
+	{
+		// exits with an error, so it can gate a build
+		bool linear = benchmark_scaling(scaling_max_size);
+		return linear ? 0 : 1;
+	}
+
+	if (run_benchmark_strings)
+	{
+		benchmark_string_primitives(64 * 1024 * 1024);
+		return 0;
+	}
+
+	if (search_index_path)
+	{
+		String index_data;
+		Search_Index index;
+		if (!map_entire_file(&index_data, search_index_path) || !open_search_index(&index, index_data))
+		{
+			printf("Failed to open search index: %.*s\n", StringArgs(search_index_path));
+			return 0;
+		}
+
+		// the index has lowercase terms
+		for (umm i = 0; i < search_word.length; i++)
+			if (search_word.data[i] >= 'A' && search_word.data[i] <= 'Z')
+				search_word.data[i] |= 0x20;
+
+		String postings;
+		if (find_search_term(&index, search_word, &postings))
+		{
+			Search_Posting posting;
+			while (next_search_posting(&postings, &posting))
+			{
+				String document_path;
+				u32 term_total;
+				if (get_search_document(&index, posting.document, &document_path, &term_total))
+					printf("%6u  %.*s\n", posting.frequency, StringArgs(document_path));
+			}
+		}
+		unmap_file(index_data);
+		return 0;
+	}
+
+#if !MARKDOWN_ZLIB
+	if (gzip_path)
+	{
+		printf("--gzip needs zlib, this build doesn't have MARKDOWN_ZLIB=1\n");
+		return 0;
+	}
+#endif
+
+	if (run_profile && !start_profiling())
+		fprintf(stderr, "--profile does nothing, this build doesn't have MARKDOWN_PROFILE=1\n");
+
+	// compiled once, every document of the run uses the same one
+	Page_Template page_template;
+	if (template_path)
+	{
+		String template_source;
+		if (!read_entire_file(&template_source, template_path) || sanitize_utf8(&template_source, utf8_policy) != UTF8_OK)
+		{
+			printf("Failed to read template: %.*s\n", StringArgs(template_path));
+			return 0;
+		}
+		if (!compile_page_template(&page_template, template_source))
+		{
+			printf("Template needs exactly one {{body}}: %.*s\n", StringArgs(template_path));
+			return 0;
+		}
+		pipeline_options.page_template = &page_template;
+	}
+
+	if (watch_path)
+	{
+		watch_directory(watch_path, utf8_policy, &parse_options);
+		return 0;
+	}
+
+	if (bulk)
+	{
+		pipeline_options.utf8_policy = utf8_policy;
+		pipeline_options.parse_options = parse_options;
+
+		Pipeline_Stats stats;
+		run_pipeline(bulk_jobs, bulk_job_count, &pipeline_options, &stats);
+
+		for (umm i = 0; i < bulk_job_count; i++)
+			if (!bulk_jobs[i].converted)
+				printf("Failed to convert %.*s\n", StringArgs(bulk_jobs[i].input_path));
+
+		printf("Converted %llu of %llu files, %.1f MB read, %.1f MB written in %.3f s (%s)\n",
+			(unsigned long long) stats.converted, (unsigned long long) bulk_job_count,
+			stats.bytes_read / 1e6, stats.bytes_written / 1e6, stats.seconds,
+			stats.used_io_uring ? "io_uring" : "blocking reads");
+		if (pipeline_options.index_path && !stats.index_written)
+			printf("Failed to write search index: %.*s\n", StringArgs(pipeline_options.index_path));
+		print_profile_report();
+		return 0;
+	}
+
+	if (run_stats)
+	{
+		// only scans, there's no HTML to write so the pipeline wouldn't buy much
+		for (umm i = 0; i < bulk_job_count; i++)
+		{
+			LK_Region_Cursor cursor;
+			lk_region_cursor(temp, &cursor);
+
+			String stats_path = bulk_jobs[i].input_path;
+			String stats_file;
+			if (!read_entire_file(&stats_file, stats_path) || sanitize_utf8(&stats_file, utf8_policy) != UTF8_OK)
+			{
+				fprintf(stderr, "Failed to read file: %.*s\n", StringArgs(stats_path));
+				lk_region_rewind(temp, &cursor);
+				continue;
+			}
+
+			Document_Stats stats;
+			scan_document(stats_file, &stats, &parse_options);
+
+			UTF8_Sink stats_sink;
+			init_utf8_sink(&stats_sink);
+			write_document_stats_json(&stats_sink.sink, stats_path, &stats);
+			fwrite(stats_sink.builder.string.data, 1, stats_sink.builder.string.length, stdout);
+
+			lk_region_rewind(temp, &cursor);
+		}
+		return 0;
+	}
+
+	if (!path_given)
 	{
-		printf("Usage: markdown.exe filename.md\nUsing default path: %.*s\n", StringArgs(path));
+		printf("%sUsing default path: %.*s\n", usage, StringArgs(path));
 	}
 
+	profile_begin_document();
+
 	String file;
 	bool read_success = read_entire_file(&file, path);
 	if (!read_success)
@@ -30,9 +346,198 @@ int main(int argc, char* argv[])
 		return 0;
 	}
 
-	String html = parse(file);
+	// invalid UTF-8 must never reach the output
+	UTF8_Status utf8_status = sanitize_utf8(&file, utf8_policy);
+	if (utf8_status != UTF8_OK)
+	{
+		if (utf8_status == UTF8_OUT_OF_MEMORY)
+			printf("Out of memory repairing UTF-8: %.*s", StringArgs(path));
+		else
+			printf("File is not valid UTF-8: %.*s", StringArgs(path));
+		return 0;
+	}
+
+	if (run_benchmark_utf16)
+	{
+		benchmark_utf16(file);
+		return 0;
+	}
+
+	if (run_benchmark_ir)
+	{
+		benchmark_document_ir(file);
+		return 0;
+	}
+
+	if (run_benchmark_out)
+	{
+		benchmark_background_output(file, concatenate(path, ".benchmark.html"_s));
+		return 0;
+	}
+
+	UTF8_Sink utf8_sink;
+	UTF16_Sink utf16_sink;
+	init_utf8_sink(&utf8_sink);
+	init_utf16_sink(&utf16_sink);
+	Output_Sink *sink = output_utf16 ? &utf16_sink.sink : &utf8_sink.sink;
+
+#if MARKDOWN_ZLIB
+	// compressed as it's produced, the HTML is never all in memory
+	GZip_File_Sink gzip_sink;
+	if (gzip_path)
+	{
+		if (!open_gzip_file_sink(&gzip_sink, gzip_path, plain_path))
+		{
+			printf("Failed to open output file: %.*s", StringArgs(gzip_path));
+			return 0;
+		}
+		sink = &gzip_sink.sink;
+	}
+#endif
+
+	// written while the parser goes on, the writer thread has to be joined on every way out
+	Background_File_Sink background_sink;
+	bool background_open = false;
+	Defer(if (background_open) close_background_file_sink(&background_sink));
+	if (out_path && !gzip_path)
+	{
+		if (!open_background_file_sink(&background_sink, out_path, out_buffer_size, out_buffer_count))
+		{
+			printf("Failed to open output file: %.*s", StringArgs(out_path));
+			return 0;
+		}
+		background_open = true;
+		sink = &background_sink.sink;
+	}
+
+	if (read_ir_path)
+	{
+		String ir_data;
+		Document_IR ir;
+		if (!map_entire_file(&ir_data, read_ir_path) || !open_document_ir(&ir, ir_data, file))
+		{
+			printf("Failed to open IR file for %.*s: %.*s", StringArgs(path), StringArgs(read_ir_path));
+			return 0;
+		}
 
+		// the header only has the input's length, a stale IR of the same length would render garbage
+		if (!ir_matches_input(&ir))
+		{
+			unmap_file(ir_data);
+			printf("IR file was made from a different version of %.*s, write it again with --write-ir: %.*s", StringArgs(path), StringArgs(read_ir_path));
+			return 0;
+		}
 
+		bool render_success = render_document_ir(&ir, sink, &parse_options);
+		unmap_file(ir_data);
+
+		if (!render_success)
+		{
+			printf("IR file is corrupt: %.*s", StringArgs(read_ir_path));
+			return 0;
+		}
+	}
+	else
+	{
+		// every requested format is produced from the same parse, in one traversal
+		HTML_Token_Sink html_format;
+		Template_Token_Sink template_format;
+		Text_Token_Sink text_format;
+		JSON_Token_Sink json_format;
+		UTF8_Sink text_sink;
+		UTF8_Sink json_sink;
+		init_utf8_sink(&text_sink);
+		init_utf8_sink(&json_sink);
+		init_html_token_sink(&html_format, sink, &parse_options);
+		if (template_path)
+			init_template_token_sink(&template_format, &page_template, sink, &parse_options);
+		init_text_token_sink(&text_format, &text_sink.sink);
+		init_json_token_sink(&json_format, &json_sink.sink);
+
+		Token_Sink *formats[3];
+		umm format_count = 0;
+		formats[format_count++] = template_path ? &template_format.sink : &html_format.sink;
+		if (text_path) formats[format_count++] = &text_format.sink;
+		if (json_path) formats[format_count++] = &json_format.sink;
+
+		Parse_Result result;
+		Parse_Status status = parse(file, formats, format_count, &parse_options, &result);
+		if (status != PARSE_OK)
+		{
+			printf("Failed to convert %.*s: %s", StringArgs(path), get_parse_status_message(status));
+			return 0;
+		}
+
+		if (text_path && !write_entire_file(text_path, text_sink.builder.string))
+		{
+			printf("Failed to write text file: %.*s", StringArgs(text_path));
+			return 0;
+		}
+
+		if (json_path && !write_entire_file(json_path, json_sink.builder.string))
+		{
+			printf("Failed to write JSON file: %.*s", StringArgs(json_path));
+			return 0;
+		}
+
+		if (source_map_path)
+		{
+			UTF8_Sink source_map_sink;
+			init_utf8_sink(&source_map_sink);
+			write_source_map_json(&source_map_sink.sink, result.source_map);
+			if (!write_entire_file(source_map_path, source_map_sink.builder.string))
+			{
+				printf("Failed to write source map file: %.*s", StringArgs(source_map_path));
+				return 0;
+			}
+		}
+
+		if (write_ir_path)
+		{
+			String ir_data = serialize_document_ir(file, &result);
+			if (!ir_data)
+			{
+				printf("Out of memory writing IR file: %.*s", StringArgs(write_ir_path));
+				return 0;
+			}
+			if (!write_entire_file(write_ir_path, ir_data))
+			{
+				printf("Failed to write IR file: %.*s", StringArgs(write_ir_path));
+				return 0;
+			}
+		}
+	}
+
+#if MARKDOWN_ZLIB
+	if (gzip_path)
+	{
+		if (!close_gzip_file_sink(&gzip_sink))
+			printf("Failed to write compressed file: %.*s", StringArgs(gzip_path));
+	}
+	else
+#endif
+	if (background_open)
+	{
+		background_open = false;
+		if (!close_background_file_sink(&background_sink))
+			printf("Failed to write output file: %.*s", StringArgs(out_path));
+	}
+	else if (output_utf16)
+	{
+		// UTF-16LE, for hosts that can't consume UTF-8
+		// stdout must not translate 0x0A bytes to CRLF here
+#ifdef _WIN32
+		_setmode(_fileno(stdout), _O_BINARY);
+#endif
+		fwrite(utf16_sink.string.data, sizeof(u16), utf16_sink.string.length, stdout);
+	}
+	else
+	{
+		String html = utf8_sink.builder.string;
+		fwrite(html.data, 1, html.length, stdout);
+	}
+
+	profile_end_document(path);
+	print_profile_report();
     return 0;
 }
-
@@ -0,0 +1,310 @@
+#pragma once
+
+#include <stdlib.h>
+
+#include "typedef.h"
+#include "macros.h"
+#include "memory.h"
+#include "string.h"
+#include "utf8.h"
+#include "output.h"
+#include "parser.h"
+#include "formats.h"
+#include "markdown_api.h"
+
+
+
+struct MD_Converter
+{
+    LK_Region memory;
+    LK_Region_Cursor empty;  // After the first page, which is kept between conversions.
+
+    MD_Options options;
+    MD_Allocator allocator;
+    bool has_allocator;
+};
+
+
+
+//
+// Region pages.
+// library.cxx defines LK_REGION_CUSTOM_PAGE_ALLOCATOR, so every page the
+// regions take comes through here. The region of the converter that is
+// currently running on the thread picks where it comes from.
+//
+
+
+#ifdef LK_REGION_CUSTOM_PAGE_ALLOCATOR
+
+static thread_local MD_Converter* page_owner;
+
+extern "C" void* lk_region_os_alloc(size_t size, const char* caller_name)
+{
+    if (!page_owner || !page_owner->has_allocator)
+        return lk__region_os_reserve(size);
+
+    // Regions count on new pages being zeroed, like the OS gives them.
+    void* memory = page_owner->allocator.allocate(page_owner->allocator.user, size);
+    if (memory)
+        memset(memory, 0, size);
+    return memory;
+}
+
+extern "C" void lk_region_os_free(void* memory, size_t size)
+{
+    if (!page_owner || !page_owner->has_allocator)
+    {
+        lk__region_os_release(memory, size);
+        return;
+    }
+
+    page_owner->allocator.release(page_owner->allocator.user, memory, size);
+}
+
+#endif
+
+
+// Points 'temp' and the page allocator at the converter until the end of the scope,
+// and rewinds its region then.
+struct Converter_Scope
+{
+    MD_Converter* converter;
+    LK_Region* previous_temp;
+#ifdef LK_REGION_CUSTOM_PAGE_ALLOCATOR
+    MD_Converter* previous_page_owner;
+#endif
+
+    Converter_Scope(MD_Converter* converter): converter(converter), previous_temp(temp)
+    {
+        temp = &converter->memory;
+#ifdef LK_REGION_CUSTOM_PAGE_ALLOCATOR
+        previous_page_owner = page_owner;
+        page_owner = converter;
+#endif
+    }
+
+    ~Converter_Scope()
+    {
+        lk_region_rewind(&converter->memory, &converter->empty);
+        temp = previous_temp;
+#ifdef LK_REGION_CUSTOM_PAGE_ALLOCATOR
+        page_owner = previous_page_owner;
+#endif
+    }
+};
+
+
+
+//
+// Converters.
+//
+
+
+void md_default_options(MD_Options* options)
+{
+    ZeroStruct(options);
+    options->format = MD_FORMAT_HTML;
+    options->heading_anchors = Parse_Options().heading_anchors;
+}
+
+const char* md_get_status_message(MD_Status status)
+{
+    switch (status)
+    {
+    case MD_OK:                return "ok";
+    case MD_OUT_OF_MEMORY:     return "out of memory";
+    case MD_TOO_MANY_TOKENS:   return "too many tokens";
+    case MD_TOO_DEEP:          return "lists nested too deep";
+    case MD_OUTPUT_TOO_LARGE:  return "output too large";
+    case MD_INVALID_UTF8:      return "input is not valid UTF-8";
+    case MD_BUFFER_TOO_SMALL:  return "output doesn't fit in the buffer";
+    case MD_INVALID_ARGUMENT:  return "invalid argument";
+    }
+    return "unknown status";
+}
+
+
+MD_Converter* md_create_converter(const MD_Options* options, const MD_Allocator* allocator)
+{
+    if (allocator && (!allocator->allocate || !allocator->release))
+        return NULL;
+
+    MD_Converter* converter = allocator
+        ? (MD_Converter*) allocator->allocate(allocator->user, sizeof(MD_Converter))
+        : (MD_Converter*) malloc(sizeof(MD_Converter));
+    if (!converter)
+        return NULL;
+
+    ZeroStruct(converter);
+    if (options)
+        converter->options = *options;
+    else
+        md_default_options(&converter->options);
+    if (allocator)
+    {
+        converter->allocator = *allocator;
+        converter->has_allocator = true;
+    }
+
+    // The first page stays, so small documents don't ask for memory at all.
+    {
+        Converter_Scope scope(converter);
+        lk_region_alloc(&converter->memory, 1, 1);
+        lk_region_cursor(&converter->memory, &converter->empty);
+    }
+    return converter;
+}
+
+void md_destroy_converter(MD_Converter* converter)
+{
+    if (!converter)
+        return;
+
+    {
+        Converter_Scope scope(converter);
+        lk_region_free(&converter->memory);
+        converter->empty = {};  // So the scope's rewind has nothing to do.
+    }
+
+    if (converter->has_allocator)
+        converter->allocator.release(converter->allocator.user, converter, sizeof(MD_Converter));
+    else
+        free(converter);
+}
+
+
+static MD_Status get_md_status(Parse_Status status)
+{
+    switch (status)
+    {
+    case PARSE_OK:                return MD_OK;
+    case PARSE_OUT_OF_MEMORY:     return MD_OUT_OF_MEMORY;
+    case PARSE_TOO_MANY_TOKENS:   return MD_TOO_MANY_TOKENS;
+    case PARSE_TOO_DEEP:          return MD_TOO_DEEP;
+    case PARSE_OUTPUT_TOO_LARGE:  return MD_OUTPUT_TOO_LARGE;
+    }
+    return MD_INVALID_ARGUMENT;
+}
+
+// Runs with the converter's scope open.
+static MD_Status convert(MD_Converter* converter, String input, Output_Sink* output)
+{
+    MD_Options* md_options = &converter->options;
+    switch (sanitize_utf8(&input, md_options->reject_invalid_utf8 ? UTF8_REJECT : UTF8_REPLACE))
+    {
+    case UTF8_OK:            break;
+    case UTF8_INVALID:       return MD_INVALID_UTF8;
+    case UTF8_OUT_OF_MEMORY: return MD_OUT_OF_MEMORY;
+    }
+
+    Parse_Options options;
+    options.heading_anchors   = md_options->heading_anchors != 0;
+    options.table_of_contents = md_options->table_of_contents != 0;
+    options.data_sourcepos    = md_options->data_sourcepos != 0;
+    options.max_memory_bytes  = md_options->max_memory_bytes;
+    options.max_tokens        = md_options->max_tokens;
+    options.max_depth         = md_options->max_depth;
+    options.max_output_bytes  = md_options->max_output_bytes;
+    options.unsafe_links      = md_options->unsafe_links != 0;
+
+    Parse_Status status;
+    switch (md_options->format)
+    {
+    case MD_FORMAT_HTML:
+    {
+        status = parse(input, output, &options);
+    } break;
+
+    case MD_FORMAT_TEXT:
+    {
+        Text_Token_Sink text;
+        init_text_token_sink(&text, output);
+        Token_Sink* sink = &text.sink;
+        status = parse(input, &sink, 1, &options);
+    } break;
+
+    case MD_FORMAT_JSON:
+    {
+        JSON_Token_Sink json;
+        init_json_token_sink(&json, output);
+        Token_Sink* sink = &json.sink;
+        status = parse(input, &sink, 1, &options);
+    } break;
+
+    default:
+        return MD_INVALID_ARGUMENT;
+    }
+    return get_md_status(status);
+}
+
+
+struct Callback_Sink
+{
+    Output_Sink sink;
+    MD_Write write;
+    void* user;
+};
+
+static void callback_sink_write(Output_Sink* output, String utf8)
+{
+    Callback_Sink* sink = (Callback_Sink*) output;
+    sink->write(sink->user, (const char*) utf8.data, utf8.length);
+}
+
+MD_Status md_convert(MD_Converter* converter, const char* input, size_t length, MD_Write write, void* user)
+{
+    if (!converter || !write || (!input && length))
+        return MD_INVALID_ARGUMENT;
+
+    Converter_Scope scope(converter);
+
+    Callback_Sink sink = {};
+    sink.sink.write = callback_sink_write;
+    sink.write = write;
+    sink.user = user;
+    return convert(converter, { length, (u8*) input }, &sink.sink);
+}
+
+
+// Keeps counting once the buffer is full, so the caller knows how much to allocate.
+struct Buffer_Sink
+{
+    Output_Sink sink;
+    u8* buffer;
+    umm capacity;
+    umm length;
+};
+
+static void buffer_sink_write(Output_Sink* output, String utf8)
+{
+    Buffer_Sink* sink = (Buffer_Sink*) output;
+    if (sink->length <= sink->capacity)
+    {
+        umm space = sink->capacity - sink->length;
+        copy(sink->buffer + sink->length, utf8.data, utf8.length < space ? utf8.length : space);
+    }
+    sink->length += utf8.length;
+}
+
+MD_Status md_convert_to_buffer(MD_Converter* converter, const char* input, size_t length,
+                               char* buffer, size_t capacity, size_t* out_length)
+{
+    if (out_length)
+        *out_length = 0;
+    if (!converter || (!input && length) || (!buffer && capacity))
+        return MD_INVALID_ARGUMENT;
+
+    Converter_Scope scope(converter);
+
+    Buffer_Sink sink = {};
+    sink.sink.write = buffer_sink_write;
+    sink.buffer = (u8*) buffer;
+    sink.capacity = capacity;
+
+    MD_Status status = convert(converter, { length, (u8*) input }, &sink.sink);
+    if (out_length)
+        *out_length = sink.length;
+    if (status == MD_OK && sink.length > capacity)
+        status = MD_BUFFER_TOO_SMALL;
+    return status;
+}
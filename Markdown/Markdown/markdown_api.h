@@ -0,0 +1,112 @@
+#pragma once
+
+#include <stddef.h>
+
+
+
+//
+// C API.
+// For converting inside another program instead of running markdown.exe for
+// every document. Build it with library.cxx, see MarkdownLibrary.vcxproj.
+// Hand this header out on its own, not this directory on the include path:
+// string.h in here would hide the C library's.
+//
+// Everything a conversion allocates comes from its converter's region, which
+// is rewound before md_convert returns, and output only ever goes to the
+// caller's callback or buffer. Nothing is printed and no global state is
+// used, so any number of converters can run on different threads at the same
+// time. A single converter is used by one thread at a time.
+//
+
+
+#if defined(_WIN32)
+    #if defined(MARKDOWN_BUILD_DLL)
+        #define MARKDOWN_API __declspec(dllexport)
+    #elif defined(MARKDOWN_DLL)
+        #define MARKDOWN_API __declspec(dllimport)
+    #else
+        #define MARKDOWN_API
+    #endif
+#elif defined(__GNUC__)
+    #define MARKDOWN_API __attribute__((visibility("default")))
+#else
+    #define MARKDOWN_API
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef enum
+{
+    MD_OK,
+    MD_OUT_OF_MEMORY,        // The allocator failed, or max_memory_bytes ran out.
+    MD_TOO_MANY_TOKENS,
+    MD_TOO_DEEP,
+    MD_OUTPUT_TOO_LARGE,     // max_output_bytes ran out, the output stops short.
+    MD_INVALID_UTF8,         // Only with reject_invalid_utf8, nothing was written.
+    MD_BUFFER_TOO_SMALL,     // md_convert_to_buffer, the needed size is in 'out_length'.
+    MD_INVALID_ARGUMENT,
+} MD_Status;
+
+typedef enum
+{
+    MD_FORMAT_HTML,
+    MD_FORMAT_TEXT,          // Text and code content only, for search indexing.
+    MD_FORMAT_JSON,          // The document tree.
+} MD_Format;
+
+// Fill in with md_default_options, new members may be added at the end.
+typedef struct
+{
+    MD_Format format;
+    int reject_invalid_utf8; // Otherwise invalid UTF-8 is replaced with U+FFFD.
+    int heading_anchors;     // HTML only, on by default.
+    int table_of_contents;   // HTML only.
+    int data_sourcepos;      // HTML only.
+
+    // Budgets for untrusted input, 0 means no limit, see Parse_Options.
+    size_t max_memory_bytes;
+    size_t max_tokens;
+    unsigned max_depth;
+    size_t max_output_bytes;
+
+    int unsafe_links;        // Keep javascript:, vbscript:, file: and data: link urls, only for trusted input.
+} MD_Options;
+
+// Where a converter's region gets its pages from. Pages are at least 64 kB,
+// apart from single allocations bigger than that. 'allocate' returns NULL
+// when it's out of memory, or memory aligned at least as well as malloc's.
+typedef struct
+{
+    void* (*allocate)(void* user, size_t size);
+    void (*release)(void* user, void* memory, size_t size);
+    void* user;
+} MD_Allocator;
+
+typedef struct MD_Converter MD_Converter;
+
+// Called with pieces of the output as they are produced, in order.
+typedef void (*MD_Write)(void* user, const char* data, size_t length);
+
+
+MARKDOWN_API void md_default_options(MD_Options* options);
+MARKDOWN_API const char* md_get_status_message(MD_Status status);
+
+// 'options' and 'allocator' may be NULL, for the defaults and for pages from
+// the OS. Both are copied. Returns NULL if it can't allocate the converter.
+MARKDOWN_API MD_Converter* md_create_converter(const MD_Options* options, const MD_Allocator* allocator);
+MARKDOWN_API void md_destroy_converter(MD_Converter* converter);
+
+// 'input' is not modified and doesn't have to be null terminated.
+MARKDOWN_API MD_Status md_convert(MD_Converter* converter, const char* input, size_t length, MD_Write write, void* user);
+
+// Writes at most 'capacity' bytes, not null terminated. 'out_length' gets the
+// length of the whole output, even if it didn't fit.
+MARKDOWN_API MD_Status md_convert_to_buffer(MD_Converter* converter, const char* input, size_t length,
+                                            char* buffer, size_t capacity, size_t* out_length);
+
+#ifdef __cplusplus
+}
+#endif
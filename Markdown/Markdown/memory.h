@@ -7,7 +7,10 @@
 typedef LK_Region Region;
 
 extern LK_Region temporary_memory;
-constexpr LK_Region* temp = &temporary_memory;
+
+// Every thread starts out allocating from temporary_memory. Threads that run
+// alongside others point this at a region of their own, see pipeline.cpp.
+extern thread_local LK_Region* temp;
 
 #endif
 
@@ -19,6 +22,7 @@ constexpr LK_Region* temp = &temporary_memory;
 #define LK_REGION_IMPLEMENTATION
 #include "lk_region.h"
 LK_Region temporary_memory = {};
+thread_local LK_Region* temp = &temporary_memory;
 
 #endif
 #endif
\ No newline at end of file
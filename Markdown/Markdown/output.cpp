@@ -0,0 +1,68 @@
+#pragma once
+
+#include <stdlib.h>
+
+#include "typedef.h"
+#include "macros.h"
+#include "string.h"
+#include "utf8.h"
+#include "output.h"
+
+
+
+static void utf8_sink_write(Output_Sink* sink, String utf8)
+{
+    UTF8_Sink* utf8_sink = (UTF8_Sink*) sink;
+    append(&utf8_sink->builder, utf8);
+}
+
+void init_utf8_sink(UTF8_Sink* sink)
+{
+    ZeroStruct(sink);
+    sink->sink.write = utf8_sink_write;
+}
+
+
+static void utf16_sink_write(Output_Sink* sink, String utf8)
+{
+    UTF16_Sink* utf16_sink = (UTF16_Sink*) sink;
+
+    // A UTF-8 string never has more UTF-16 code units than it has bytes,
+    // so reserving its length up front lets us transcode in a single pass.
+    umm new_length = utf16_sink->string.length + utf8.length;
+    if (new_length >= utf16_sink->capacity)
+    {
+        umm new_capacity = utf16_sink->capacity;
+        if (!new_capacity) new_capacity = 64;
+
+        // growth factor of 1.5
+        do new_capacity = new_capacity + (new_capacity >> 1);
+        while (new_length >= new_capacity);
+
+        u16* new_data = (u16*) malloc(new_capacity * sizeof(u16));
+        if (utf16_sink->string.data)
+        {
+            copy(new_data, utf16_sink->string.data, utf16_sink->string.length * sizeof(u16));
+            free(utf16_sink->string.data);
+        }
+
+        utf16_sink->string.data = new_data;
+        utf16_sink->capacity = new_capacity;
+    }
+
+    u16* target = utf16_sink->string.data + utf16_sink->string.length;
+    utf16_sink->string.length += transcode_utf8_to_utf16(target, utf8);
+    utf16_sink->string.data[utf16_sink->string.length] = 0;
+}
+
+void init_utf16_sink(UTF16_Sink* sink)
+{
+    ZeroStruct(sink);
+    sink->sink.write = utf16_sink_write;
+}
+
+void free_utf16_sink(UTF16_Sink* sink)
+{
+    free(sink->string.data);
+    ZeroStruct(sink);
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "typedef.h"
+#include "string.h"
+
+
+
+//
+// Output sinks.
+// The emitter writes every piece of output through a sink, so the same
+// emitter can produce UTF-8, UTF-16 or anything else in a single pass.
+// Concrete sinks embed Output_Sink as their first member.
+//
+
+
+struct Output_Sink
+{
+    void (*write)(Output_Sink* sink, String utf8);
+
+    // Counted in bytes of UTF-8 written to the sink, whatever it turns them into.
+    umm bytes_written;
+    umm byte_limit;    // 0 for no limit.
+    bool full;         // A write would have gone past byte_limit, nothing is written after that.
+};
+
+inline void write_output(Output_Sink* sink, String utf8)
+{
+    if (sink->byte_limit && (sink->full || utf8.length > sink->byte_limit - sink->bytes_written))
+    {
+        sink->full = true;
+        return;
+    }
+
+    sink->bytes_written += utf8.length;
+    sink->write(sink, utf8);
+}
+
+
+struct UTF8_Sink
+{
+    Output_Sink sink;
+    String_Builder builder;
+};
+
+void init_utf8_sink(UTF8_Sink* sink);
+
+
+// Transcodes as it is written to, there is no intermediate UTF-8 copy.
+struct UTF16_Sink
+{
+    Output_Sink sink;
+    String16 string;  // Heap allocated and null terminated.
+    umm capacity;
+};
+
+void init_utf16_sink(UTF16_Sink* sink);
+void free_utf16_sink(UTF16_Sink* sink);
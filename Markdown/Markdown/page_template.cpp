@@ -0,0 +1,186 @@
+#pragma once
+
+#include <cstring>
+
+#include "typedef.h"
+#include "macros.h"
+#include "memory.h"
+#include "string.h"
+#include "output.h"
+#include "parser.h"
+#include "formats.h"
+#include "page_template.h"
+
+
+
+//
+// Compiling.
+//
+
+
+static bool is_slot_name_char(u8 c)
+{
+    return (u8)((c | 0x20) - 'a') < 26 || (u8)(c - '0') < 10 || c == '_' || c == '-' || c == '.';
+}
+
+// 'cursor' starts with "{{". Returns the length of the slot, or 0 if it isn't one.
+static umm match_slot(String cursor, String* name)
+{
+    umm i = 2;
+    while (i < cursor.length && cursor.data[i] == ' ')
+        i++;
+
+    umm name_start = i;
+    while (i < cursor.length && is_slot_name_char(cursor.data[i]))
+        i++;
+    *name = substring(cursor, name_start, i - name_start);
+
+    while (i < cursor.length && cursor.data[i] == ' ')
+        i++;
+
+    if (!*name || i + 2 > cursor.length || cursor.data[i] != '}' || cursor.data[i + 1] != '}')
+        return 0;
+    return i + 2;
+}
+
+static bool consume_template_segment(String* cursor, Template_Segment* segment)
+{
+    if (!*cursor)
+        return false;
+
+    String name;
+    umm slot_length = prefix_equals(*cursor, "{{"_s) ? match_slot(*cursor, &name) : 0;
+    if (slot_length)
+    {
+        if      (name == "body"_s)  *segment = { TEMPLATE_BODY, {} };
+        else if (name == "title"_s) *segment = { TEMPLATE_TITLE, {} };
+        else if (name == "toc"_s)   *segment = { TEMPLATE_TOC, {} };
+        else                        *segment = { TEMPLATE_FIELD, name };
+        consume(cursor, slot_length);
+        return true;
+    }
+
+    // Text up to the next {{, starting from 1 so a {{ that isn't a slot ends up in here.
+    umm length = 1;
+    while (length < cursor->length)
+    {
+        const u8* brace = (const u8*) memchr(cursor->data + length, '{', cursor->length - length);
+        if (!brace)
+        {
+            length = cursor->length;
+            break;
+        }
+
+        length = brace - cursor->data;
+        if (length + 1 < cursor->length && brace[1] == '{')
+            break;
+        length++;
+    }
+
+    *segment = { TEMPLATE_TEXT, substring(*cursor, 0, length) };
+    consume(cursor, length);
+    return true;
+}
+
+bool compile_page_template(Page_Template* page, String source)
+{
+    ZeroStruct(page);
+
+    umm segment_count = 0;
+    umm body_count = 0;
+    Template_Segment segment;
+    for (String cursor = source; consume_template_segment(&cursor, &segment);)
+    {
+        segment_count++;
+        if (segment.slot == TEMPLATE_BODY)
+            body_count++;
+    }
+    if (body_count != 1)
+        return false;
+
+    page->segments = LK_RegionArray(temp, Template_Segment, segment_count);
+    if (!page->segments)
+        return false;
+
+    for (String cursor = source; consume_template_segment(&cursor, &segment);)
+    {
+        if (segment.slot == TEMPLATE_BODY)
+            page->body_segment = page->segment_count;
+        page->segments[page->segment_count++] = segment;
+    }
+    return true;
+}
+
+
+
+//
+// Writing.
+//
+
+
+static String get_page_title(Parse_Result* result)
+{
+    String title = find_front_matter_field(result->front_matter, result->front_matter_format, "title"_s);
+    if (title)
+        return title;
+
+    for (auto* node = result->outline.head; node != NULL; node = node->next)
+        if (node->value.level == 1)
+            return node->value.text;
+    return {};
+}
+
+static void write_template_segments(Template_Token_Sink* sink, umm first, umm end)
+{
+    Output_Sink* output = sink->sink.output;
+    Parse_Result* result = sink->result;
+
+    for (umm i = first; i < end; i++)
+    {
+        Template_Segment* segment = &sink->page->segments[i];
+        switch (segment->slot)
+        {
+        case TEMPLATE_TEXT:  write_output(output, segment->text); break;
+        case TEMPLATE_TITLE: write_escaped_text(output, get_page_title(result)); break;
+        case TEMPLATE_TOC:   emit_table_of_contents(result->outline, output); break;
+        case TEMPLATE_FIELD:
+        {
+            write_escaped_text(output, find_front_matter_field(result->front_matter, result->front_matter_format, segment->text));
+        } break;
+        default: break;
+        }
+    }
+}
+
+
+static void template_sink_begin(Token_Sink* sink, Parse_Result* result)
+{
+    Template_Token_Sink* page = (Template_Token_Sink*) sink;
+    page->result = result;
+    write_template_segments(page, 0, page->page->body_segment);
+    page->html.sink.begin(&page->html.sink, result);
+}
+
+static void template_sink_token(Token_Sink* sink, Labeled_String token)
+{
+    Template_Token_Sink* page = (Template_Token_Sink*) sink;
+    page->html.sink.token(&page->html.sink, token);
+}
+
+static void template_sink_end(Token_Sink* sink)
+{
+    Template_Token_Sink* page = (Template_Token_Sink*) sink;
+    page->html.sink.end(&page->html.sink);
+    write_template_segments(page, page->page->body_segment + 1, page->page->segment_count);
+}
+
+void init_template_token_sink(Template_Token_Sink* sink, Page_Template* page, Output_Sink* output, Parse_Options* options)
+{
+    ZeroStruct(sink);
+    init_html_token_sink(&sink->html, output, options);
+    sink->sink.begin = template_sink_begin;
+    sink->sink.token = template_sink_token;
+    sink->sink.end   = template_sink_end;
+    sink->sink.output = output;
+    sink->page = page;
+}
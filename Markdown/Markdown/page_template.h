@@ -0,0 +1,67 @@
+#pragma once
+
+#include "typedef.h"
+#include "string.h"
+#include "output.h"
+#include "parser.h"
+#include "formats.h"
+
+
+
+//
+// Page templates.
+// A site layout with slots in it, compiled once and used for every document.
+// A page is written straight into the output sink: the static text of the
+// template, the slots as they come up, and the body as the parser produces
+// it, so the body is never copied into a page string.
+//
+// Slots are written {{name}}, with spaces around the name allowed:
+//     {{body}}     the document as HTML, exactly one per template
+//     {{title}}    the front matter's title, or else the text of the first top level heading
+//     {{toc}}      the table of contents, like --toc writes it
+//     {{name}}     any other name is looked up in the front matter, see find_front_matter_field
+// Titles and front matter values are escaped, a missing one is left empty.
+// A {{ that doesn't start a slot is just text.
+//
+
+
+enum Template_Slot
+{
+    TEMPLATE_TEXT,
+    TEMPLATE_BODY,
+    TEMPLATE_TITLE,
+    TEMPLATE_TOC,
+    TEMPLATE_FIELD,
+};
+
+struct Template_Segment
+{
+    Template_Slot slot;
+    String text;              // The static text, or the field name for TEMPLATE_FIELD.
+};
+
+struct Page_Template
+{
+    Template_Segment* segments;
+    umm segment_count;
+    umm body_segment;
+};
+
+// Segments are allocated in the temp region and point into 'source', which has to outlive the template.
+// Returns false if the template doesn't have exactly one {{body}}.
+// A compiled template is only ever read, any number of threads can use it at once.
+bool compile_page_template(Page_Template* page, String source);
+
+
+// Writes the page around the HTML that HTML_Token_Sink would write.
+// Everything before the body is written in begin(), when the headings and
+// the front matter are known, and everything after it in end().
+struct Template_Token_Sink
+{
+    Token_Sink sink;
+    HTML_Token_Sink html;
+    Page_Template* page;
+    Parse_Result* result;     // From begin(), for the slots after the body.
+};
+
+void init_template_token_sink(Template_Token_Sink* sink, Page_Template* page, Output_Sink* output, Parse_Options* options = NULL);
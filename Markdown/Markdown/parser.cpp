@@ -2,19 +2,30 @@
 #include <stdio.h>
 
 #include "typedef.h"
+#include "macros.h"
 #include "memory.h"
 
 #include "string.h"
 #include "list.h"
+#include "hash_table.h"
 
+#include "output.h"
+#include "html_entities.h"
 #include "parser.h"
+#include "formats.h"
+#include "profile.h"
 
 #define DebugAssert(test) assert(test)
 
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define PARSER_SSE2 1
+#include <emmintrin.h>
+#endif
+
 u32 count_leading_whitespace(String string)
 {
 	u32 counter = 0;
-	for (int i = 0; i < string.length; i++)
+	for (umm i = 0; i < string.length; i++)
 	{
 		if (is_whitespace(string[i]))
 			counter++;
@@ -24,29 +35,38 @@ u32 count_leading_whitespace(String string)
 	return counter;
 }
 
-enum String_Label
-	{
-		ST_UNKNOWN,
-		ST_HTML_TAG,
-		ST_META_TAG,
-		ST_TEXT
-	};
-
-struct Labeled_String
-{
-	String_Label type;
-	String value;
-};
-
 void print_string_list(SLList<Labeled_String> &list)
 {
 	for (auto *node = list.head; node != NULL; node = node->next)
 		printf("%.*s\n", StringArgs(node->value.value));
 }
 
+enum Container_Type
+{
+	CONTAINER_PARAGRAPH,
+	CONTAINER_HEADER,
+	CONTAINER_LIST,			// <ul>
+	CONTAINER_LIST_ITEM,	// <li>, nested lists go inside of it
+	CONTAINER_CODE_BLOCK,
+	CONTAINER_TABLE,		// rows are added to it until a line that isn't one
+};
+
+// a block whose closing tag hasn't been added yet
+// the open ones form a stack, innermost on top, see push_container
+struct Container
+{
+	Container *parent;
+	Container_Type type;
+	Labeled_String close_tag;
+	u32 depth;		// 1 for top level containers
+	u32 list_level;	// lists this is inside of, counting itself, 0 outside of lists
+
+	Source_Block *block; // only with source_positions
+};
+
 struct Parse_Context
 {
-	
+	Parse_Options options;
 
 	SLList<Labeled_String> section_list; // consists of <p>, <h>, <ul>, <il>, <li> tags and "other text"
 	SLList<String> 			output_list; // used to construct output string
@@ -58,115 +78,594 @@ struct Parse_Context
 	String temp_string; //temporary substring of input
 
 
-	bool p_tag_open = false;
-	bool blockquote_tag_open = false;	
-	bool header_tag_open[6] = {};
-	bool any_list_tag_open = false;
+	Container *containers = NULL; // innermost open container
+	Container *free_containers = NULL; // popped ones, reused before allocating new ones
+
+	SLList<Heading> outline; // every header, in document order
+	String_Map<u32> slugs; // slug -> next numeric suffix to try for it
+	Link_Map links;
+	String front_matter = {};
+	Front_Matter_Format front_matter_format = FRONT_MATTER_NONE;
+
+	// the open table, see try_add_table
+	u32 table_columns = 0;
+	u8 *table_alignments = NULL;	// Table_Alignment of every column
+	String *table_cells = NULL;		// room for one row, reused for every row
+	bool table_body_open = false;
+
+	Parse_Status status = PARSE_OK;
+	uintptr_t failed_allocations = 0; // of the temp region, when parsing started
 
-	u32 indent_level = 0;
+	// only kept up to date with source_positions
+	SLList<Source_Block> blocks;
+	u32 line_number = 0; // of the line being parsed
+	u8 *line_start = NULL;
+	u8 *block_end = NULL; // end of the last line added to a block
+	u32 block_end_line = 0;
+	u8 *block_end_line_start = NULL;
 };
 
 
-static const Labeled_String tag_begin_p 			= {ST_HTML_TAG, "<p>"_s};
-static const Labeled_String tag_end_p 				= {ST_HTML_TAG, "</p>"_s};
-static const Labeled_String tag_begin_ul 			= {ST_HTML_TAG, "<ul>"_s};
-static const Labeled_String tag_end_ul 				= {ST_HTML_TAG, "</ul>"_s};
-static const Labeled_String tag_begin_li 			= {ST_HTML_TAG, "<li>"_s};
-static const Labeled_String tag_end_li 				= {ST_HTML_TAG, "</li>"_s};
+static const Labeled_String tag_begin_p 			= {ST_BLOCK_OPEN, BLOCK_PARAGRAPH};
+static const Labeled_String tag_end_p 				= {ST_BLOCK_CLOSE, BLOCK_PARAGRAPH};
+static const Labeled_String tag_begin_ul 			= {ST_BLOCK_OPEN, BLOCK_LIST};
+static const Labeled_String tag_end_ul 				= {ST_BLOCK_CLOSE, BLOCK_LIST};
+static const Labeled_String tag_begin_li 			= {ST_BLOCK_OPEN, BLOCK_LIST_ITEM};
+static const Labeled_String tag_end_li 				= {ST_BLOCK_CLOSE, BLOCK_LIST_ITEM};
+static const Labeled_String tag_begin_code 			= {ST_BLOCK_OPEN, BLOCK_CODE};
+static const Labeled_String tag_end_code 			= {ST_BLOCK_CLOSE, BLOCK_CODE};
+static const Labeled_String tag_begin_table 		= {ST_BLOCK_OPEN, BLOCK_TABLE};
+static const Labeled_String tag_end_table 			= {ST_BLOCK_CLOSE, BLOCK_TABLE};
+static const Labeled_String tag_begin_thead 		= {ST_BLOCK_OPEN, BLOCK_TABLE_HEAD};
+static const Labeled_String tag_end_thead 			= {ST_BLOCK_CLOSE, BLOCK_TABLE_HEAD};
+static const Labeled_String tag_begin_tbody 		= {ST_BLOCK_OPEN, BLOCK_TABLE_BODY};
+static const Labeled_String tag_end_tbody 			= {ST_BLOCK_CLOSE, BLOCK_TABLE_BODY};
+static const Labeled_String tag_begin_tr 			= {ST_BLOCK_OPEN, BLOCK_TABLE_ROW};
+static const Labeled_String tag_end_tr 				= {ST_BLOCK_CLOSE, BLOCK_TABLE_ROW};
 
-static const Labeled_String tag_open_h[6] =
+//
+// source positions
+//
+// every container remembers where it begins, and ends with the last line added to it
+// nothing is counted unless source positions were asked for
+//
+
+// 'line' is the last line added to the block that's open now, it's on the current line
+static void set_block_end(Parse_Context *ctx, String line)
 {
-													{ ST_HTML_TAG, "<h1>"_s },
-													{ ST_HTML_TAG, "<h2>"_s },
-													{ ST_HTML_TAG, "<h3>"_s },
-													{ ST_HTML_TAG, "<h4>"_s },
-													{ ST_HTML_TAG, "<h5>"_s },
-													{ ST_HTML_TAG, "<h6>"_s }
-};
+	ctx->block_end = line.data + line.length;
+	ctx->block_end_line = ctx->line_number;
+	ctx->block_end_line_start = ctx->line_start;
+}
 
-static const Labeled_String tag_close_h[6] =
+static Source_Position get_source_position(Parse_Context *ctx, u8 *at, u32 line, u8 *line_start)
 {
-													{ ST_HTML_TAG, "</h1>"_s },
-													{ ST_HTML_TAG, "</h2>"_s },
-													{ ST_HTML_TAG, "</h3>"_s },
-													{ ST_HTML_TAG, "</h4>"_s },
-													{ ST_HTML_TAG, "</h5>"_s },
-													{ ST_HTML_TAG, "</h6>"_s }
-};
+	Source_Position position;
+	position.offset = at - ctx->input.data;
+	position.line = line;
+	position.column = (u32)(at - line_start) + 1;
+	return position;
+}
 
-// closes all open <p>, <blockquote>, <h_>, and only the top level <ul>, <il> tags
-void close_all_open_top_level_tags(Parse_Context *ctx)
+// the parse loop counts every line it consumes, anything that consumes
+// more than one line at a time has to count them here
+static void count_lines(Parse_Context *ctx, String text)
 {
-	if (ctx->p_tag_open)
-	{
-		ctx->p_tag_open = false;
-		ctx->section_list.append(tag_end_p);
-	}
+	if (!ctx->options.source_positions)
+		return;
 
-	for (int i = 0; i < 6; i++)
+	// code blocks are the only thing counted here, and they can be long,
+	// without any '\r' a line always ends at the next '\n'
+	if (!memchr(text.data, '\r', text.length))
 	{
-		if (ctx->header_tag_open[i])
+		while (text)
 		{
-			ctx->header_tag_open[i] = false;
-			ctx->section_list.append(tag_close_h[i]);
+			const u8 *newline = (const u8*) memchr(text.data, '\n', text.length);
+			umm line_length = newline ? newline - text.data : text.length;
+			String line = substring(text, 0, line_length);
+			consume(&text, newline ? line_length + 1 : line_length);
+
+			ctx->line_number++;
+			ctx->line_start = line.data;
+			if (line)
+				set_block_end(ctx, line);
 		}
+		return;
+	}
+
+	while (text)
+	{
+		String line = consume_line_preserve_whitespace(&text);
+		ctx->line_number++;
+		ctx->line_start = line.data;
+		if (line)
+			set_block_end(ctx, line);
 	}
+}
+
+static u8 *write_decimal(u8 *to, u32 value)
+{
+	u8 digits[10];
+	umm count = 0;
+	do
+	{
+		digits[count++] = '0' + value % 10;
+		value /= 10;
+	} while (value);
+
+	while (count)
+		*to++ = digits[--count];
+	return to;
+}
+
+//
+// containers
+//
+// every open block is a frame on a stack and knows the tag that closes it,
+// so closing any number of them, of any kind, is popping frames until the
+// stack is down to the wanted depth
+//
+
+// 'begin' is the first byte of the container in the input
+static Container *push_container(Parse_Context *ctx, Container_Type type, Labeled_String open_tag, Labeled_String close_tag, u8 *begin)
+{
+	Container *container = ctx->free_containers;
+	if (container)
+		ctx->free_containers = container->parent;
+	else
+		container = LK_RegionValue(temp, Container);
+
+	if (!container)
+		return NULL; // out of memory, the parse stops after this line
+
+	Container *parent = ctx->containers;
+	container->parent = parent;
+	container->type = type;
+	container->close_tag = close_tag;
+	container->depth = parent ? parent->depth + 1 : 1;
+	container->list_level = (parent ? parent->list_level : 0) + (type == CONTAINER_LIST ? 1 : 0);
+	container->block = NULL;
+	ctx->containers = container;
+
+	umm tag_count = ctx->section_list.count;
+	ctx->section_list.append(open_tag);
+	if (!ctx->options.source_positions || ctx->section_list.count == tag_count)
+		return container;
+
+	umm block_count = ctx->blocks.count;
+	ctx->blocks.append({ get_source_position(ctx, begin, ctx->line_number, ctx->line_start) });
+	if (ctx->blocks.count != block_count)
+		container->block = &ctx->blocks.tail->value;
+	return container;
+}
+
+// the container ends with the last line that was added to it, see Parse_Context::block_end
+static void pop_container(Parse_Context *ctx)
+{
+	Container *container = ctx->containers;
+	DebugAssert(container);
+	ctx->containers = container->parent;
+	container->parent = ctx->free_containers;
+	ctx->free_containers = container;
+
+	// a table body is only opened by the first row after the header, see try_add_table_row
+	if (container->type == CONTAINER_TABLE && ctx->table_body_open)
+		ctx->section_list.append(tag_end_tbody);
+	ctx->section_list.append(container->close_tag);
+	if (!container->block)
+		return;
+
+	u8 *end = ctx->block_end;
+	if (end > ctx->block_end_line_start)
+		end--;
+	container->block->end = get_source_position(ctx, end, ctx->block_end_line, ctx->block_end_line_start);
+}
+
+// closes the innermost containers until 'depth' are left open, 0 closes every one
+static void pop_containers(Parse_Context *ctx, u32 depth)
+{
+	while (ctx->containers && ctx->containers->depth > depth)
+		pop_container(ctx);
+}
 
-	if (ctx->any_list_tag_open)
+//
+// headers
+//
+
+// github style: lowercase, spaces become '-', other ascii punctuation is dropped
+// non-ascii bytes are kept as they are, so the slug stays valid UTF-8
+// character references are decoded first, like the header text is on output,
+// so "A &lt;b&gt; &amp; C" is "a-b--c"
+static String make_slug(String text)
+{
+	// a reference takes at least half as many bytes as it decodes to
+	String slug;
+	slug.data = LK_RegionArray(temp, u8, text.length * 2);
+	slug.length = 0;
+	if (!slug.data)
+		return "section"_s; // out of memory, the parse is stopped after this line
+
+	u8 utf8[CHARACTER_REFERENCE_MAX_UTF8];
+	String piece;
+	bool decoded;
+	while (consume_text_piece(&text, utf8, &piece, &decoded))
 	{
-		while (ctx->indent_level > 0)
+		for (umm i = 0; i < piece.length; i++)
 		{
-			ctx->indent_level--;
-			ctx->section_list.append(tag_end_li);
-			ctx->section_list.append(tag_end_ul);
+			u8 c = piece[i];
+			if (c >= 'A' && c <= 'Z')
+				c += 'a' - 'A';
+
+			if ((c >= 'a' && c <= 'z') || is_decimal_digit(c) || c == '-' || c == '_' || c >= 0x80)
+				slug.data[slug.length++] = c;
+			else if (c == ' ' || c == '\t')
+				slug.data[slug.length++] = '-';
 		}
+	}
+
+	if (!slug)
+		slug = "section"_s;
+	return slug;
+}
+
+static String u32_to_string(u32 value)
+{
+	u8 digits[10];
+	String result = { (umm)(write_decimal(digits, value) - digits), digits };
+	return clone_string(result);
+}
+
+// foo, foo-1, foo-2...
+// every slug remembers which suffix to try next, so n equal headers cost O(n) total
+static String make_unique_slug(Parse_Context *ctx, String text)
+{
+	String slug = make_slug(text);
 
-		ctx->any_list_tag_open = false;
-		ctx->indent_level = 0;
+	// insert returns the existing entry if there is one, so a slug seen for the
+	// first time costs a single probe sequence
+	umm slug_count = ctx->slugs.count;
+	u32 *next_suffix = ctx->slugs.insert(slug, 1);
+	if (!next_suffix || ctx->slugs.count != slug_count)
+		return slug;
+
+	// a header may literally be called "foo-1", so candidates have to be checked too
+	while (true)
+	{
+		String candidate = concatenate(slug, "-"_s, u32_to_string((*next_suffix)++));
+
+		slug_count = ctx->slugs.count;
+		if (!ctx->slugs.insert(candidate, 1) || ctx->slugs.count != slug_count)
+			return candidate;
 	}
 }
 
-// call whenever a new paragraph or header or blockquote may begin
-// this usually gets fed the line after two newlines
-void new_section_begin(Parse_Context *ctx, String first_line_of_section)
+// text of an atx header without the opening and the optional closing #'s
+static String get_header_text(String trimmed_line)
 {
-	if (!first_line_of_section) return;
+	String text = trimmed_line;
+	while (text && text[0] == '#')
+		consume(&text, 1);
+	text = trim(text);
 
-	String trimmed_line = trim(first_line_of_section);
+	umm closing_start = text.length;
+	while (closing_start > 0 && text[closing_start - 1] == '#')
+		closing_start--;
+	if (closing_start == 0 || is_whitespace(text[closing_start - 1]))
+		text.length = closing_start;
 
-	/////////
-	// first try to find a header
-	////////
+	return trim(text);
+}
 
-	i8 header_level = 0;	// can be h1 to h6
-	while (header_level < trimmed_line.length)
+// 1 to 6, or 0 if the line isn't a header, more than 6 #'s still make an h6
+static u32 get_header_level(String trimmed_line)
+{
+	u32 header_level = 0;
+	while (header_level < trimmed_line.length && header_level < 7)
 	{
 		if (trimmed_line[header_level] == '#')
-			header_level++; // this can make header_level into 7
+			header_level++; // this can make header_level into 7, but no further
 		else
 			break;
 	}
-	header_level = header_level > 6 ? 6 : header_level; // if header_level == 7, make it 6
-	if (header_level > 0)
+	return header_level > 6 ? 6 : header_level; // if header_level == 7, make it 6
+}
+
+// atx headers are always a single line, so the header is closed right
+// after it's added, and the next line starts a new section
+bool try_add_header(Parse_Context *ctx, String line)
+{
+	String trimmed_line = trim(line);
+
+	u32 header_level = get_header_level(trimmed_line);	// can be h1 to h6
+	if (header_level == 0)
+		return false;
+
+	Heading heading;
+	heading.level = header_level;
+	heading.text = get_header_text(trimmed_line);
+	heading.slug = {};
+
+	if (ctx->options.heading_anchors || ctx->options.table_of_contents)
+		heading.slug = make_unique_slug(ctx, heading.text);
+	ctx->outline.append(heading);
+
+	Labeled_String open_tag = { ST_BLOCK_OPEN, BLOCK_HEADING, (u8) header_level, heading.slug };
+	Labeled_String close_tag = { ST_BLOCK_CLOSE, BLOCK_HEADING, (u8) header_level };
+	push_container(ctx, CONTAINER_HEADER, open_tag, close_tag, trimmed_line.data);
+	ctx->section_list.append({ ST_TEXT, BLOCK_NONE, 0, heading.text });
+	set_block_end(ctx, trimmed_line);
+	pop_containers(ctx, 0);
+	return true;
+}
+
+
+//
+// front matter
+//
+
+// "---", "+++" or "..." with nothing but whitespace after it
+static bool is_front_matter_fence(String line, u8 fence_char)
+{
+	line = trim(line);
+	return line.length == 3 && line[0] == fence_char && line[1] == fence_char && line[2] == fence_char;
+}
+
+// 'block' gets the whole block, both fences and the line ending after the closing one
+static String match_front_matter(String input, Front_Matter_Format *format, String *block)
+{
+	*format = FRONT_MATTER_NONE;
+	*block = {};
+
+	String cursor = input;
+	if (prefix_equals(cursor, "\xEF\xBB\xBF"_s))
+		consume(&cursor, 3);
+
+	String first_line = consume_line_preserve_whitespace(&cursor);
+	u8 fence_char;
+	if (is_front_matter_fence(first_line, '-'))
+		fence_char = '-';
+	else if (is_front_matter_fence(first_line, '+'))
+		fence_char = '+';
+	else
+		return {};
+
+	// line start to line start with memchr, like find_closing_code_fence
+	u8 *content_start = cursor.data;
+	while (cursor)
+	{
+		u8 *line_start = cursor.data;
+		String line = consume_line_preserve_whitespace(&cursor);
+
+		if (is_front_matter_fence(line, fence_char) || (fence_char == '-' && is_front_matter_fence(line, '.')))
+		{
+			*format = (fence_char == '-') ? FRONT_MATTER_YAML : FRONT_MATTER_TOML;
+			*block = { (umm)(cursor.data - input.data), input.data };
+			return { (umm)(line_start - content_start), content_start };
+		}
+	}
+	return {};
+}
+
+String find_front_matter(String input, Front_Matter_Format *format)
+{
+	Front_Matter_Format local_format;
+	if (!format)
+		format = &local_format;
+
+	String block;
+	return match_front_matter(input, format, &block);
+}
+
+String find_front_matter_field(String front_matter, Front_Matter_Format format, String key)
+{
+	if (!key)
+		return {};
+
+	u8 separator = (format == FRONT_MATTER_TOML) ? '=' : ':';
+	String cursor = front_matter;
+	while (cursor)
 	{
-		header_level--; //string tag arrays are 0..5 indexed, offset by -1
-		ctx->header_tag_open[header_level] = true;
-		ctx->section_list.append(tag_open_h[header_level]);
+		String line = consume_line_preserve_whitespace(&cursor);
+
+		// everything after the first [table] header belongs to that table
+		if (format == FRONT_MATTER_TOML && line && line[0] == '[')
+			break;
+		if (!prefix_equals(line, key))
+			continue;
+
+		String rest = trim(substring(line, key.length, line.length - key.length));
+		if (!rest || rest[0] != separator)
+			continue;
+
+		String value = trim(substring(rest, 1, rest.length - 1));
+		if (value.length >= 2 && (value[0] == '"' || value[0] == '\'') && value[value.length - 1] == value[0])
+			value = substring(value, 1, value.length - 2);
+		return value;
+	}
+	return {};
+}
+
+// front matter is only ever at the start, the rest of the input is what's left after it
+static void try_add_front_matter(Parse_Context *ctx, String *input_cursor)
+{
+	String block;
+	String front_matter = match_front_matter(*input_cursor, &ctx->front_matter_format, &block);
+	if (ctx->front_matter_format == FRONT_MATTER_NONE)
 		return;
+
+	ctx->front_matter = front_matter;
+	ctx->section_list.append({ ST_META_TAG, BLOCK_NONE, 0, front_matter });
+	consume(input_cursor, block.length);
+	count_lines(ctx, block);
+}
+
+
+//
+// link definitions
+//
+// [label]: url "title" lines are taken out of the document and go into a
+// map, links are matched against it when the html is written, so a link
+// can come before its definition without a second pass over anything
+//
+
+String fold_link_label(String label, u8 *folded)
+{
+	label = trim(label);
+
+	umm length = 0;
+	bool in_whitespace = false;
+	for (umm i = 0; i < label.length; i++)
+	{
+		u8 c = label.data[i];
+		if (is_whitespace(c))
+		{
+			if (!in_whitespace)
+				folded[length++] = ' ';
+			in_whitespace = true;
+			continue;
+		}
+
+		// 'A'..'Z' get the 0x20 bit, nothing else changes
+		folded[length++] = c | ((u8)(c - 'A') < 26 ? 0x20 : 0);
+		in_whitespace = false;
+	}
+	return { length, folded };
+}
+
+// the url is <anything but brackets> or a run without whitespace,
+// the title is in "", '' or (), and nothing else may follow
+static bool parse_link_destination(String rest, Link_Definition *definition)
+{
+	rest = trim(rest);
+	if (!rest)
+		return false;
+
+	if (rest[0] == '<')
+	{
+		consume(&rest, 1);
+		umm url_end = find_first_occurance_of_any(rest, "<>"_s);
+		if (url_end == NOT_FOUND || rest[url_end] != '>')
+			return false;
+		definition->url = substring(rest, 0, url_end);
+		consume(&rest, url_end + 1);
+	}
+	else
+	{
+		umm url_end = find_first_occurance_of_any(rest, " \t"_s);
+		if (url_end == NOT_FOUND)
+			url_end = rest.length;
+		definition->url = substring(rest, 0, url_end);
+		consume(&rest, url_end);
+	}
+
+	String title = trim(rest);
+	if (!title)
+		return true;
+	if (title.length == rest.length)
+		return false; // the title has to be separated from the url
+
+	u8 open = title[0];
+	u8 close = (open == '(') ? ')' : open;
+	if (open != '"' && open != '\'' && open != '(')
+		return false;
+	if (title.length < 2 || title[title.length - 1] != close)
+		return false;
+
+	definition->title = substring(title, 1, title.length - 2);
+	return find_first_occurance(definition->title, close) == NOT_FOUND;
+}
+
+// a definition is a line that is nothing but one, 'label' is a slice of it
+static bool parse_link_definition(String line, String *label, Link_Definition *definition)
+{
+	umm indent = 0;
+	while (indent < line.length && indent < 4 && line[indent] == ' ')
+		indent++;
+	if (indent > 3 || indent == line.length || line[indent] != '[')
+		return false;
+
+	String rest = substring(line, indent + 1, line.length - indent - 1);
+	umm label_end = find_first_occurance_of_any(rest, "[]"_s);
+	if (label_end == NOT_FOUND || rest[label_end] != ']' || label_end > LINK_LABEL_MAX)
+		return false;
+	if (label_end + 1 >= rest.length || rest[label_end + 1] != ':')
+		return false;
+
+	*label = substring(rest, 0, label_end);
+	if (!trim(*label))
+		return false;
+
+	*definition = {};
+	return parse_link_destination(substring(rest, label_end + 2, rest.length - label_end - 2), definition);
+}
+
+// the first definition of a label wins, see Link_Map
+static void add_link_definition(Link_Map *links, String label, Link_Definition definition)
+{
+	u8 *folded = LK_RegionArray(temp, u8, label.length);
+	if (!folded)
+		return; // out of memory, the parse stops after this line
+	links->insert(fold_link_label(label, folded), definition);
+}
+
+// the schemes cmark's safe mode drops, data: is fine for a few image types
+// browsers skip leading spaces and control characters, and tabs and newlines anywhere
+static bool is_unsafe_link_url(String url)
+{
+	u8 scheme[16];
+	umm length = 0;
+	for (umm i = 0; i < url.length && length < sizeof(scheme); i++)
+	{
+		u8 c = url[i];
+		if ((c <= ' ' && !length) || c == '\t' || c == '\n' || c == '\r')
+			continue;
+		scheme[length++] = c | ((u8)(c - 'A') < 26 ? 0x20 : 0);
 	}
 
+	String start = { length, scheme };
+	if (prefix_equals(start, "javascript:"_s) || prefix_equals(start, "vbscript:"_s) || prefix_equals(start, "file:"_s))
+		return true;
+	if (!prefix_equals(start, "data:"_s))
+		return false;
+	return !prefix_equals(start, "data:image/png"_s) && !prefix_equals(start, "data:image/gif"_s) &&
+	       !prefix_equals(start, "data:image/jpeg"_s) && !prefix_equals(start, "data:image/webp"_s);
+}
+
+// 'line' starts a section
+static bool try_add_link_definition(Parse_Context *ctx, String line)
+{
+	String label;
+	Link_Definition definition;
+	if (!parse_link_definition(line, &label, &definition))
+		return false;
+
+	// the link stays, with an empty href, like cmark writes it
+	if (!ctx->options.unsafe_links && is_unsafe_link_url(definition.url))
+		definition.url = {};
+
+	add_link_definition(&ctx->links, label, definition);
+	return true;
+}
+
+
+// call whenever a new paragraph or blockquote may begin
+// this usually gets fed the line after two newlines
+void new_section_begin(Parse_Context *ctx, String first_line_of_section)
+{
+	if (!first_line_of_section) return;
+
+	String trimmed_line = trim(first_line_of_section);
 
 	////////
-	// no header openers found
 	// look for list beginning (TODO ordered lists)
 	////////
 
 	if (prefix_equals(trimmed_line, "- "_s) ||
 		prefix_equals(trimmed_line, "* "_s))
 	{
-		// everything else (indent level, opening top <ul> etc.)
+		// everything else (indent level, <li> tags etc.)
 		// is done in try_add_list_element
-		ctx->any_list_tag_open = true;
+		push_container(ctx, CONTAINER_LIST, tag_begin_ul, tag_end_ul, trimmed_line.data);
 		return;
 	}
 
@@ -176,8 +675,7 @@ void new_section_begin(Parse_Context *ctx, String first_line_of_section)
 	// section must be a paragraph
 	////////
 
-	ctx->p_tag_open = true;
-	ctx->section_list.append(tag_begin_p);
+	push_container(ctx, CONTAINER_PARAGRAPH, tag_begin_p, tag_end_p, trimmed_line.data);
 }
 
 bool try_add_list_element(Parse_Context *ctx, String line)
@@ -230,7 +728,8 @@ bool try_add_list_element(Parse_Context *ctx, String line)
 	 */
 
 
-	if (!ctx->any_list_tag_open)
+	Container *top = ctx->containers;
+	if (!top || !top->list_level)
 		return false;
 
 
@@ -243,11 +742,11 @@ bool try_add_list_element(Parse_Context *ctx, String line)
 		prefix_equals(trimmed_line, "- "_s))
 	{
 		String line_without_list_beginning = trim(substring(trimmed_line, 2, trimmed_line.length - 2));
-		text = {ST_TEXT, line_without_list_beginning};
+		text = {ST_TEXT, BLOCK_NONE, 0, line_without_list_beginning};
 	}
 	else // line is continuation of last list element (see CLARIFICATION 1)
 	{
-		text = {ST_TEXT, trimmed_line};
+		text = {ST_TEXT, BLOCK_NONE, 0, trimmed_line};
 		ctx->section_list.append(text);
 		return true;
 	}
@@ -256,88 +755,1723 @@ bool try_add_list_element(Parse_Context *ctx, String line)
 	// take care of nested levelness
 	const u32 line_indent_level = count_leading_whitespace(line) / 4 + 1;
 
-	if (line_indent_level > ctx->indent_level)
+	if (top->type == CONTAINER_LIST)
 	{
-		// see CLARIFICATION 3
-		ctx->section_list.append(tag_begin_ul);
-		ctx->section_list.append(tag_begin_li);
-		ctx->section_list.append(text);
-
-		ctx->indent_level++;
+		// first element, the <ul> was opened by new_section_begin
+		// its indent doesn't matter, the list is at level 1
 	}
-	else if (line_indent_level < ctx->indent_level)
+	else if (line_indent_level > top->list_level)
 	{
-		// close 'indent_difference' <ul> and <il> tags, + leading <li> tag
-		ctx->section_list.append(tag_end_li);
-
-		const u32 indent_difference = ctx->indent_level - line_indent_level;
-		for (int i = 0; i < indent_difference; i++)
+		if (ctx->options.max_depth && top->list_level == ctx->options.max_depth)
 		{
-			ctx->section_list.append(tag_end_ul);
-			ctx->section_list.append(tag_end_li);
+			ctx->status = PARSE_TOO_DEEP;
+			return true;
 		}
-		ctx->section_list.append(tag_begin_li);
-		ctx->section_list.append(text);
 
-		ctx->indent_level = line_indent_level;
+		// see CLARIFICATION 3
+		push_container(ctx, CONTAINER_LIST, tag_begin_ul, tag_end_ul, trimmed_line.data);
 	}
-	else // line_indent_level == ctx->indent level
+	else
 	{
-		// end last open <li>, open new one, add text
-		// dont end <li> tag because of possible nested lists following
-		// indent level is unchanged
-		ctx->section_list.append(tag_end_li);
-		ctx->section_list.append(tag_begin_li);
-		ctx->section_list.append(text);
+		// close the last <li> at this indent level, along with every list nested in it
+		// the <ul> it's in stays open
+		// <li> tags aren't closed before that because of possible nested lists following
+		Container *list = top;
+		while (list && (list->type != CONTAINER_LIST || list->list_level > line_indent_level))
+			list = list->parent;
+		if (list)
+			pop_containers(ctx, list->depth);
 	}
 
+	push_container(ctx, CONTAINER_LIST_ITEM, tag_begin_li, tag_end_li, trimmed_line.data);
+	ctx->section_list.append(text);
+
 	return true;
 }
 
 
 
-String parse(String input)
+//
+// code blocks
+//
+// code block contents are never inline-processed, so the whole body is kept
+// as a single slice of the input and escaped in one go on output
+//
+
+// returns the number of columns of indent, counting a tab as 4 columns
+static u32 count_indent_columns(String line)
 {
-	Parse_Context ctx;
+	u32 columns = 0;
+	for (umm i = 0; i < line.length; i++)
+	{
+		if (line[i] == ' ')
+			columns++;
+		else if (line[i] == '\t')
+			columns += 4 - (columns % 4);
+		else
+			break;
+	}
+	return columns;
+}
 
-	String input_cursor = input;
+static bool is_blank_line(String line)
+{
+	for (umm i = 0; i < line.length; i++)
+		if (!is_whitespace(line[i]))
+			return false;
+	return true;
+}
+
+struct Code_Fence
+{
+	u8 fence_char;		// '`' or '~'
+	umm fence_length;	// at least 3
+	String info;		// info string after the opening fence, trimmed
+	u8 indent;			// spaces before the opening fence, 0..3
+};
 
+// fences are 3 or more backticks or tildes, indented by at most 3 spaces
+static bool is_opening_code_fence(String line, Code_Fence *fence)
+{
+	umm indent = 0;
+	while (indent < line.length && indent < 4 && line[indent] == ' ')
+		indent++;
+	if (indent > 3 || indent == line.length)
+		return false;
+
+	u8 c = line[indent];
+	if (c != '`' && c != '~')
+		return false;
 
-	// strip top newline lines
-	while (input_cursor == ""_s)
-		consume_line_preserve_whitespace(&input_cursor);
+	umm run_end = indent;
+	while (run_end < line.length && line[run_end] == c)
+		run_end++;
+	if (run_end - indent < 3)
+		return false;
 
-	// open correct section based on first line
-	String line = peek_line_preserve_whitespace(input_cursor);
-	new_section_begin(&ctx, line);
+	String info = trim(substring(line, run_end, line.length - run_end));
+	if (c == '`' && find_first_occurance(info, '`') != NOT_FOUND)
+		return false; // backtick fences can't have backticks in the info string
 
-	while (input_cursor)
+	fence->fence_char = c;
+	fence->fence_length = run_end - indent;
+	fence->info = info;
+	fence->indent = (u8) indent;
+	return true;
+}
+
+// 'line' runs until the end of text, only the beginning is looked at
+static bool is_closing_code_fence(String line, Code_Fence *fence)
+{
+	umm indent = 0;
+	while (indent < line.length && indent < 4 && line[indent] == ' ')
+		indent++;
+	if (indent > 3)
+		return false;
+
+	umm run_end = indent;
+	while (run_end < line.length && line[run_end] == fence->fence_char)
+		run_end++;
+	if (run_end - indent < fence->fence_length)
+		return false;
+
+	// only whitespace may follow the closing fence
+	for (umm i = run_end; i < line.length && line[i] != '\n' && line[i] != '\r'; i++)
+		if (!is_whitespace(line[i]))
+			return false;
+
+	return true;
+}
+
+// returns the offset of the line containing the closing fence, or NOT_FOUND
+// jumps from line start to line start with memchr, so only the first few
+// bytes of every line inside the block are ever looked at
+// lines end like they do everywhere else, at "\n", "\r" or either pair
+static umm find_closing_code_fence(String text, Code_Fence *fence)
+{
+	String rest = text;
+	while (rest)
 	{
-		// open new section if line == "\n"
-		if (line == ""_s)
-		{
-			// consume multiple newline lines if they exist
-			// after running the loop sets 'line' to first line of new section
-			while (line == ""_s)
-				line = consume_line_preserve_whitespace(&input_cursor);
+		// cheap reject, a closing fence line starts with a space or the fence char
+		u8 first = rest[0];
+		if ((first == fence->fence_char || first == ' ') && is_closing_code_fence(rest, fence))
+			return rest.data - text.data;
 
-			close_all_open_top_level_tags(&ctx);
-			new_section_begin(&ctx, line);
-		}
-		else
-		{
-			line = consume_line_preserve_whitespace(&input_cursor);
-		}
+		consume_line_preserve_whitespace(&rest);
+	}
+	return NOT_FOUND;
+}
 
+// 'input_cursor' is right after the opening fence, the rest of the block is
+// consumed, and 'block' gets all of it, closing fence included
+static String consume_fenced_code(Code_Fence *fence, String *input_cursor, String *block)
+{
+	String body = *input_cursor;
+	*block = *input_cursor;
+
+	umm closing_line = find_closing_code_fence(*input_cursor, fence);
+	if (closing_line == NOT_FOUND)
+	{
+		// unclosed fences run until the end of the document
+		consume(input_cursor, input_cursor->length);
+	}
+	else
+	{
+		body.length = closing_line;
+		consume(input_cursor, closing_line);
+		consume_line_preserve_whitespace(input_cursor);
+		block->length = input_cursor->data - block->data;
+	}
+	return body;
+}
 
-		bool list_el_added = try_add_list_element(&ctx, line);
+// the block is 'line' and every following line that is blank or indented by 4+ columns
+// trailing blank lines are not part of the block, 'rest_of_block' gets what was consumed
+static String consume_indented_code(String line, String *input_cursor, String *rest_of_block)
+{
+	u8 *body_end = input_cursor->data;
+	String cursor = *input_cursor;
+	while (cursor)
+	{
+		String next_line = consume_line_preserve_whitespace(&cursor);
+		bool blank = is_blank_line(next_line);
+		if (!blank && count_indent_columns(next_line) < 4)
+			break;
 
-		if (!list_el_added)
-			ctx.section_list.append({ ST_TEXT, line });
+		if (!blank)
+			body_end = cursor.data;
+	}
+
+	String body;
+	body.data = line.data;
+	body.length = body_end - line.data;
+	*rest_of_block = { (umm)(body_end - input_cursor->data), input_cursor->data };
+	consume(input_cursor, rest_of_block->length);
+	return body;
+}
+
+// indented code can't interrupt a paragraph or a list, so it is only
+// looked for at the beginning of a section
+static bool is_indented_code_start(String line)
+{
+	return count_indent_columns(line) >= 4 && !is_blank_line(line);
+}
+
+// 'line' has already been consumed from 'input_cursor'
+// if it opens a code block, the rest of the block is consumed as well
+bool try_add_code_block(Parse_Context *ctx, String line, String *input_cursor)
+{
+	Code_Fence fence;
+	if (is_opening_code_fence(line, &fence))
+	{
+		String block;
+		String body = consume_fenced_code(&fence, input_cursor, &block);
+
+		Labeled_String open_tag = tag_begin_code;
+		open_tag.value = fence.info;
+		umm language_end = find_first_occurance_of_any(open_tag.value, " \t"_s);
+		if (language_end != NOT_FOUND)
+			open_tag.value.length = language_end;
+
+		push_container(ctx, CONTAINER_CODE_BLOCK, open_tag, tag_end_code, line.data);
+		ctx->section_list.append({ ST_CODE, BLOCK_NONE, fence.indent, body });
+		set_block_end(ctx, line);
+		count_lines(ctx, block);
+		pop_containers(ctx, 0);
+		return true;
 	}
-	close_all_open_top_level_tags(&ctx);
 
+	if (ctx->containers || !is_indented_code_start(line))
+		return false;
+
+	String rest_of_block;
+	String body = consume_indented_code(line, input_cursor, &rest_of_block);
+
+	push_container(ctx, CONTAINER_CODE_BLOCK, tag_begin_code, tag_end_code, line.data);
+	ctx->section_list.append({ ST_CODE_INDENTED, BLOCK_NONE, 0, body });
+	set_block_end(ctx, line);
+	count_lines(ctx, rest_of_block);
+	pop_containers(ctx, 0);
+	return true;
+}
 
-	print_string_list(ctx.section_list);
-	return ""_s;
-}
\ No newline at end of file
+
+//
+// tables
+//
+// github style: a header row, a delimiter row with a cell for every column,
+// then rows until a blank line or a line without a '|'
+// cells are slices of the input, every row adds the same number of tokens
+// whatever it looks like, extra cells are dropped and missing ones are empty
+//
+
+// every '|' that isn't escaped ends a cell, a leading one and a trailing one are optional
+// writes the first 'max_cells' cells, trimmed, returns how many the row has
+static u32 split_table_row(String line, String *cells, u32 max_cells)
+{
+	line = trim(line);
+	if (line && line[0] == '|')
+		consume(&line, 1);
+
+	u32 count = 0;
+	umm cell_start = 0;
+	umm escaped = 0; // the byte after a backslash is never a separator
+
+	// only '|' and '\' matter, 16 bytes without either are skipped with one compare
+	umm i = 0;
+#if PARSER_SSE2
+	__m128i pipe = _mm_set1_epi8('|');
+	__m128i backslash = _mm_set1_epi8('\\');
+	for (; i + 16 <= line.length; i += 16)
+	{
+		__m128i block = _mm_loadu_si128((const __m128i*)(line.data + i));
+		int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, pipe), _mm_cmpeq_epi8(block, backslash)));
+		for (umm bit = 0; mask; bit++, mask >>= 1)
+		{
+			if (!(mask & 1))
+				continue;
+
+			umm at = i + bit;
+			if (at < escaped)
+				continue;
+			if (line.data[at] == '\\')
+			{
+				escaped = at + 2;
+				continue;
+			}
+
+			if (count < max_cells)
+				cells[count] = trim(substring(line, cell_start, at - cell_start));
+			count++;
+			cell_start = at + 1;
+		}
+	}
+#endif
+	for (; i < line.length; i++)
+	{
+		u8 c = line.data[i];
+		if ((c != '|' && c != '\\') || i < escaped)
+			continue;
+		if (c == '\\')
+		{
+			escaped = i + 2;
+			continue;
+		}
+
+		if (count < max_cells)
+			cells[count] = trim(substring(line, cell_start, i - cell_start));
+		count++;
+		cell_start = i + 1;
+	}
+
+	// 'line' is trimmed, so the row ended with a '|' unless something follows the last one
+	if (cell_start < line.length)
+	{
+		if (count < max_cells)
+			cells[count] = trim(substring(line, cell_start, line.length - cell_start));
+		count++;
+	}
+	return count;
+}
+
+// :--, :-: and --: align the column, --- leaves it alone
+static bool parse_table_alignment(String cell, u8 *alignment)
+{
+	bool left = cell && cell[0] == ':';
+	bool right = cell.length > left && cell[cell.length - 1] == ':';
+	umm dashes_start = left ? 1 : 0;
+	umm dashes_end = cell.length - (right ? 1 : 0);
+	if (dashes_start >= dashes_end)
+		return false;
+
+	for (umm i = dashes_start; i < dashes_end; i++)
+		if (cell[i] != '-')
+			return false;
+
+	if (left && right)
+		*alignment = TABLE_ALIGN_CENTER;
+	else if (left)
+		*alignment = TABLE_ALIGN_LEFT;
+	else if (right)
+		*alignment = TABLE_ALIGN_RIGHT;
+	else
+		*alignment = TABLE_ALIGN_NONE;
+	return true;
+}
+
+// returns how many cells the delimiter row has, 0 if it isn't one, and writes
+// the alignment of the first 'max_cells' of them, nothing in it can be escaped
+static u32 split_table_delimiter_row(String row, u8 *alignments, u32 max_cells)
+{
+	row = trim(row);
+	if (row && row[0] == '|')
+		consume(&row, 1);
+
+	u32 count = 0;
+	while (row)
+	{
+		umm cell_end = find_first_occurance(row, '|');
+		if (cell_end == NOT_FOUND)
+			cell_end = row.length;
+
+		u8 alignment;
+		if (!parse_table_alignment(trim(substring(row, 0, cell_end)), &alignment))
+			return 0;
+		if (count < max_cells)
+			alignments[count] = alignment;
+		count++;
+		consume(&row, cell_end < row.length ? cell_end + 1 : cell_end);
+	}
+	return count;
+}
+
+// a row with a cell for every column, 'cells' already holds the row
+// BLOCK_TABLE_HEADER_CELL or BLOCK_TABLE_CELL, aligned like their column
+static void add_table_row(Parse_Context *ctx, u32 cell_count, Block_Kind cell)
+{
+	ctx->section_list.append(tag_begin_tr);
+	for (u32 i = 0; i < ctx->table_columns; i++)
+	{
+		u8 alignment = ctx->table_alignments[i];
+		ctx->section_list.append({ ST_BLOCK_OPEN, cell, alignment });
+		if (i < cell_count && ctx->table_cells[i])
+			ctx->section_list.append({ ST_TABLE_CELL, BLOCK_NONE, 0, ctx->table_cells[i] });
+		ctx->section_list.append({ ST_BLOCK_CLOSE, cell, alignment });
+	}
+	ctx->section_list.append(tag_end_tr);
+}
+
+// 'line' starts a section, and is a header row if the line after it is a
+// delimiter row with as many cells, the delimiter row is consumed as well
+bool try_add_table(Parse_Context *ctx, String line, String *input_cursor)
+{
+	if (!memchr(line.data, '|', line.length))
+		return false;
+
+	String delimiter_row = peek_line_preserve_whitespace(*input_cursor);
+	if (!delimiter_row || !memchr(delimiter_row.data, '-', delimiter_row.length))
+		return false;
+
+	u32 columns = split_table_row(line, NULL, 0);
+	if (!columns || split_table_delimiter_row(delimiter_row, NULL, 0) != columns)
+		return false;
+
+	u8 *alignments = LK_RegionArray(temp, u8, columns);
+	String *cells = LK_RegionArray(temp, String, columns);
+	if (!alignments || !cells)
+		return false; // out of memory, the parse stops after this line
+	split_table_delimiter_row(delimiter_row, alignments, columns);
+
+	ctx->table_columns = columns;
+	ctx->table_alignments = alignments;
+	ctx->table_cells = cells;
+	ctx->table_body_open = false;
+
+	push_container(ctx, CONTAINER_TABLE, tag_begin_table, tag_end_table, trim(line).data);
+	ctx->section_list.append(tag_begin_thead);
+	add_table_row(ctx, split_table_row(line, cells, columns), BLOCK_TABLE_HEADER_CELL);
+	ctx->section_list.append(tag_end_thead);
+
+	consume_line_preserve_whitespace(input_cursor);
+	ctx->line_number++;
+	ctx->line_start = delimiter_row.data;
+	set_block_end(ctx, delimiter_row);
+	return true;
+}
+
+// false if 'line' isn't a row, which ends the table
+bool try_add_table_row(Parse_Context *ctx, String line)
+{
+	if (!memchr(line.data, '|', line.length))
+		return false;
+
+	// <tbody> only if there is a row for it, pop_container closes it
+	if (!ctx->table_body_open)
+	{
+		ctx->section_list.append(tag_begin_tbody);
+		ctx->table_body_open = true;
+	}
+
+	add_table_row(ctx, split_table_row(line, ctx->table_cells, ctx->table_columns), BLOCK_TABLE_CELL);
+	set_block_end(ctx, line);
+	return true;
+}
+
+
+
+//
+// output
+//
+
+// characters that have to be escaped inside html text all come before '?',
+// so the table only covers the first 64 code units
+static const u8 html_escape_table[64] =
+{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,	// '"' '&'
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0,	// '<' '>'
+};
+
+static const String html_escapes[] =
+{
+	""_s, "&amp;"_s, "&lt;"_s, "&gt;"_s, "&quot;"_s,
+};
+
+// copies the string in runs between characters that need escaping
+static void write_escaped_html(Output_Sink *sink, String text)
+{
+	umm run_start = 0;
+	for (umm i = 0; i < text.length; i++)
+	{
+		u8 c = text.data[i];
+		if (c >= 64 || !html_escape_table[c])
+			continue;
+		u8 escape = html_escape_table[c];
+
+		write_output(sink, substring(text, run_start, i - run_start));
+		write_output(sink, html_escapes[escape]);
+		run_start = i + 1;
+	}
+	write_output(sink, substring(text, run_start, text.length - run_start));
+}
+
+// text is written as it is, apart from character references; what those
+// decode to is escaped, so &lt;b&gt; stays text instead of becoming a tag
+static void write_text(Output_Sink *sink, String text)
+{
+	u8 utf8[CHARACTER_REFERENCE_MAX_UTF8];
+	String piece;
+	bool decoded;
+	while (consume_text_piece(&text, utf8, &piece, &decoded))
+	{
+		if (decoded)
+			write_escaped_html(sink, piece);
+		else
+			write_output(sink, piece);
+	}
+}
+
+void write_escaped_text(Output_Sink *sink, String text)
+{
+	u8 utf8[CHARACTER_REFERENCE_MAX_UTF8];
+	String piece;
+	bool decoded;
+	while (consume_text_piece(&text, utf8, &piece, &decoded))
+		write_escaped_html(sink, piece);
+}
+
+//
+// autolinks
+//
+// github style extended autolinks: www.example.com, http://, https:// and
+// ftp:// urls, and emails, found in the text itself
+// only ':', '@' and 'w' can be part of one, so text is scanned for those
+// and everything else about a link is checked only where one turns up
+//
+
+struct Autolink
+{
+	umm start;
+	umm end;
+	String href_prefix;	// what the href has before the text, "http://" for www. links
+};
+
+// letters, digits, '-' and '_'
+static const u8 autolink_domain_chars[256 / 8] =
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x03,	// '-' '0'..'9'
+	0xFE, 0xFF, 0xFF, 0x87, 0xFE, 0xFF, 0xFF, 0x07,	// 'A'..'Z' '_' 'a'..'z'
+};
+
+static inline bool is_domain_char(u8 c)
+{
+	return (autolink_domain_chars[c >> 3] >> (c & 7)) & 1;
+}
+
+static inline bool is_email_local_char(u8 c)
+{
+	return is_domain_char(c) || c == '.' || c == '+';
+}
+
+// www. links and urls have to start a word, or follow one of *_~(
+static inline bool is_autolink_boundary(String text, umm at)
+{
+	if (at == 0)
+		return true;
+	u8 c = text[at - 1];
+	return is_whitespace(c) || c == '*' || c == '_' || c == '~' || c == '(';
+}
+
+// segments of domain chars between periods, with no '_' in the last two
+// returns the length, 0 if there isn't a domain, a period at the end isn't part of it
+static umm match_domain(String text, umm start, bool need_period)
+{
+	umm periods = 0;
+	bool underscore_in_last = false;
+	bool underscore_in_second_last = false;
+
+	umm i = start;
+	for (; i < text.length; i++)
+	{
+		u8 c = text[i];
+		if (c == '.')
+		{
+			if (i == start || i + 1 == text.length || !is_domain_char(text[i + 1]))
+				break;
+			periods++;
+			underscore_in_second_last = underscore_in_last;
+			underscore_in_last = false;
+		}
+		else if (is_domain_char(c))
+		{
+			underscore_in_last |= (c == '_');
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	if (i == start || (need_period && !periods) || underscore_in_last || underscore_in_second_last)
+		return 0;
+	return i - start;
+}
+
+// the link goes until whitespace or '<', minus punctuation at the end, a ')'
+// that isn't matched by a '(' in the link, and something that looks like an entity
+static umm find_autolink_end(String text, umm start)
+{
+	umm end = start;
+	u32 open_parens = 0;
+	u32 close_parens = 0;
+	while (end < text.length && !is_whitespace(text[end]) && text[end] != '<')
+	{
+		open_parens += (text[end] == '(');
+		close_parens += (text[end] == ')');
+		end++;
+	}
+
+	while (end > start)
+	{
+		u8 c = text[end - 1];
+		if (c == '?' || c == '!' || c == '.' || c == ',' || c == ':' || c == '*' || c == '_' || c == '~')
+		{
+			end--;
+		}
+		else if (c == ')' && close_parens > open_parens)
+		{
+			close_parens--;
+			end--;
+		}
+		else if (c == ';')
+		{
+			umm name_start = end - 1;
+			while (name_start > start && is_domain_char(text[name_start - 1]) && text[name_start - 1] != '-' && text[name_start - 1] != '_')
+				name_start--;
+			if (name_start == end - 1 || name_start == start || text[name_start - 1] != '&')
+				break;
+			end = name_start - 1;
+		}
+		else
+		{
+			break;
+		}
+	}
+	return end;
+}
+
+// 'at' is the ':' of "://"
+static bool match_url_autolink(String text, umm run_start, umm at, Autolink *link, umm *resume)
+{
+	static const String schemes[] = { "http"_s, "https"_s, "ftp"_s };
+
+	if (at + 2 >= text.length || text[at + 1] != '/' || text[at + 2] != '/')
+		return false;
+
+	for (umm i = 0; i < ArrayCount(schemes); i++)
+	{
+		String scheme = schemes[i];
+		if (at < run_start + scheme.length || !compare(text.data + at - scheme.length, scheme.data, scheme.length))
+			continue;
+		umm start = at - scheme.length;
+		if (!is_autolink_boundary(text, start))
+			return false;
+
+		umm domain_length = match_domain(text, at + 3, false);
+		if (!domain_length)
+		{
+			*resume = at + 3;
+			return false;
+		}
+
+		link->start = start;
+		link->end = find_autolink_end(text, at + 3 + domain_length);
+		link->href_prefix = {};
+		return true;
+	}
+	return false;
+}
+
+// 'at' is the first 'w' of "www."
+static bool match_www_autolink(String text, umm run_start, umm at, Autolink *link, umm *resume)
+{
+	if (at + 4 > text.length || !compare(text.data + at, "www.", 4) || !is_autolink_boundary(text, at))
+		return false;
+
+	umm domain_length = match_domain(text, at, true);
+	if (!domain_length)
+	{
+		// a www. after this one would end where this one does, and fail the same way
+		umm domain_end = at + 4;
+		while (domain_end < text.length && (is_domain_char(text[domain_end]) || text[domain_end] == '.'))
+			domain_end++;
+		*resume = domain_end;
+		return false;
+	}
+
+	link->start = at;
+	link->end = find_autolink_end(text, at + domain_length);
+	link->href_prefix = "http://"_s;
+	return true;
+}
+
+// 'at' is the '@', the part before it can't have been written already
+static bool match_email_autolink(String text, umm run_start, umm at, Autolink *link, umm *resume)
+{
+	umm start = at;
+	while (start > run_start && is_email_local_char(text[start - 1]))
+		start--;
+	if (start == at)
+		return false;
+
+	umm domain_length = match_domain(text, at + 1, true);
+	if (!domain_length)
+		return false;
+
+	umm end = at + 1 + domain_length;
+	if (text[end - 1] == '-' || text[end - 1] == '_')
+	{
+		*resume = end;
+		return false;
+	}
+
+	link->start = start;
+	link->end = end;
+	link->href_prefix = "mailto:"_s;
+	return true;
+}
+
+// the next "://", '@' or "www." at or after 'from', the url matcher wants the
+// slashes and the www. matcher the period anyway, and looking for them here
+// keeps every 'w' and every ':' in plain text from stopping the scan
+static umm find_autolink_trigger(String text, umm from)
+{
+	umm i = from;
+#if PARSER_SSE2
+	__m128i colon = _mm_set1_epi8(':');
+	__m128i slash = _mm_set1_epi8('/');
+	__m128i at_sign = _mm_set1_epi8('@');
+	__m128i w = _mm_set1_epi8('w');
+	__m128i period = _mm_set1_epi8('.');
+	for (; i + 16 + 3 <= text.length; i += 16)
+	{
+		__m128i block0 = _mm_loadu_si128((const __m128i*)(text.data + i));
+		__m128i block1 = _mm_loadu_si128((const __m128i*)(text.data + i + 1));
+		__m128i block2 = _mm_loadu_si128((const __m128i*)(text.data + i + 2));
+		__m128i block3 = _mm_loadu_si128((const __m128i*)(text.data + i + 3));
+
+		__m128i url = _mm_and_si128(_mm_cmpeq_epi8(block0, colon), _mm_and_si128(_mm_cmpeq_epi8(block1, slash), _mm_cmpeq_epi8(block2, slash)));
+		__m128i www = _mm_and_si128(_mm_and_si128(_mm_cmpeq_epi8(block0, w), _mm_cmpeq_epi8(block1, w)), _mm_and_si128(_mm_cmpeq_epi8(block2, w), _mm_cmpeq_epi8(block3, period)));
+		__m128i matches = _mm_or_si128(_mm_or_si128(url, www), _mm_cmpeq_epi8(block0, at_sign));
+		int mask = _mm_movemask_epi8(matches);
+		if (mask)
+		{
+			umm bit = 0;
+			while (!(mask & (1 << bit)))
+				bit++;
+			return i + bit;
+		}
+	}
+#endif
+	for (; i < text.length; i++)
+	{
+		u8 c = text[i];
+		if (c == '@')
+			return i;
+		if (c == ':' && i + 2 < text.length && text[i + 1] == '/' && text[i + 2] == '/')
+			return i;
+		if (c == 'w' && i + 3 < text.length && text[i + 1] == 'w' && text[i + 2] == 'w' && text[i + 3] == '.')
+			return i;
+	}
+	return NOT_FOUND;
+}
+
+// the first autolink that starts at or after 'from'
+static bool find_autolink(String text, umm from, Autolink *link)
+{
+	umm i = from;
+	while ((i = find_autolink_trigger(text, i)) != NOT_FOUND)
+	{
+		umm resume = i + 1;
+		bool found = false;
+		switch (text[i])
+		{
+		case ':': found = match_url_autolink(text, from, i, link, &resume); break;
+		case '@': found = match_email_autolink(text, from, i, link, &resume); break;
+		case 'w': found = match_www_autolink(text, from, i, link, &resume); break;
+		}
+		if (found)
+			return true;
+		i = resume;
+	}
+	return false;
+}
+
+// text between reference links, autolinks go to visitor->link like they do
+static void visit_text_with_autolinks(String text, Inline_Visitor *visitor)
+{
+	umm run_start = 0;
+	Autolink autolink;
+	while (find_autolink(text, run_start, &autolink))
+	{
+		if (autolink.start > run_start)
+			visitor->text(visitor, substring(text, run_start, autolink.start - run_start));
+
+		String link_text = substring(text, autolink.start, autolink.end - autolink.start);
+		Inline_Link link = { link_text, autolink.href_prefix, link_text, {} };
+		visitor->link(visitor, &link);
+
+		run_start = autolink.end;
+	}
+	if (run_start < text.length)
+		visitor->text(visitor, substring(text, run_start, text.length - run_start));
+}
+
+// a label, or link text, is whatever is between '[' and the next ']', without
+// another '[' in between, so looking for one stops at the next bracket either
+// way, and no byte is looked at more than twice however many brackets there are
+static umm find_label_end(String text)
+{
+	if (text.length > LINK_LABEL_MAX + 1)
+		text.length = LINK_LABEL_MAX + 1;
+	umm end = find_first_occurance_of_any(text, "[]"_s);
+	if (end == NOT_FOUND || text[end] != ']')
+		return NOT_FOUND;
+	return end;
+}
+
+// 'text' starts at a '[', returns how much of it the link takes up, or 0
+// [text][label] and [label][] use the second label, [label] the first
+static umm match_reference_link(Link_Map *links, String text, String *link_text, Link_Definition **definition)
+{
+	umm text_end = find_label_end(substring(text, 1, text.length - 1));
+	if (text_end == NOT_FOUND)
+		return 0;
+
+	*link_text = substring(text, 1, text_end);
+	String label = *link_text;
+	umm length = text_end + 2;
+
+	if (length < text.length && text[length] == '[')
+	{
+		umm label_end = find_label_end(substring(text, length + 1, text.length - length - 1));
+		if (label_end != NOT_FOUND)
+		{
+			String second_label = substring(text, length + 1, label_end);
+			if (trim(second_label))
+				label = second_label;
+			length += label_end + 2;
+		}
+	}
+
+	if (!trim(label))
+		return 0;
+
+	u8 folded[LINK_LABEL_MAX];
+	*definition = links->find(fold_link_label(label, folded));
+	return *definition ? length : 0;
+}
+
+void visit_inline_text(Link_Map *links, String text, Inline_Visitor *visitor)
+{
+	umm run_start = 0;
+	umm i = 0;
+	while (links && links->count && i < text.length)
+	{
+		const u8 *open = (const u8*) memchr(text.data + i, '[', text.length - i);
+		if (!open)
+			break;
+		i = open - text.data;
+
+		String link_text;
+		Link_Definition *definition;
+		umm length = match_reference_link(links, substring(text, i, text.length - i), &link_text, &definition);
+		if (!length)
+		{
+			i++;
+			continue;
+		}
+
+		visit_text_with_autolinks(substring(text, run_start, i - run_start), visitor);
+		Inline_Link link = { link_text, {}, definition->url, definition->title };
+		visitor->link(visitor, &link);
+
+		i += length;
+		run_start = i;
+	}
+	visit_text_with_autolinks(substring(text, run_start, text.length - run_start), visitor);
+}
+
+// one line of a code token, with its line ending
+// lines of ST_CODE_INDENTED tokens lose up to 4 columns of indent, lines of
+// fenced code up to as many spaces as the fence was indented by
+String consume_code_line(String *code, Labeled_String token)
+{
+	String rest = *code;
+	consume_line_preserve_whitespace(&rest);
+
+	String line = substring(*code, 0, rest.data - code->data);
+	*code = rest;
+
+	if (token.type == ST_CODE_INDENTED)
+	{
+		u32 columns = 0;
+		while (line && columns < 4)
+		{
+			if (line[0] == ' ')
+				columns++;
+			else if (line[0] == '\t')
+				columns = 4;
+			else
+				break;
+			consume(&line, 1);
+		}
+	}
+	else
+	{
+		for (u32 spaces = 0; line && spaces < token.detail && line[0] == ' '; spaces++)
+			consume(&line, 1);
+	}
+
+	return line;
+}
+
+static void write_escaped_html_unindented(Output_Sink *sink, Labeled_String token)
+{
+	for (String code = token.value; code; )
+		write_escaped_html(sink, consume_code_line(&code, token));
+}
+
+String consume_table_cell_run(String *cell)
+{
+	umm run_length = cell->length;
+	umm skip = 0;
+	for (umm i = 0; i + 1 < cell->length; i++)
+	{
+		const u8 *backslash = (const u8*) memchr(cell->data + i, '\\', cell->length - i - 1);
+		if (!backslash)
+			break;
+		i = backslash - cell->data;
+		if (cell->data[i + 1] == '|')
+		{
+			run_length = i;
+			skip = 1;
+			break;
+		}
+	}
+
+	String run = substring(*cell, 0, run_length);
+	consume(cell, run_length + skip);
+	return run;
+}
+
+struct HTML_Inline_Visitor
+{
+	Inline_Visitor visitor;
+	Output_Sink *sink;
+};
+
+static void html_visit_text(Inline_Visitor *visitor, String text)
+{
+	write_text(((HTML_Inline_Visitor*) visitor)->sink, text);
+}
+
+// the link text is written like the rest of the text
+static void html_visit_link(Inline_Visitor *visitor, Inline_Link *link)
+{
+	Output_Sink *sink = ((HTML_Inline_Visitor*) visitor)->sink;
+	write_output(sink, "<a href=\""_s);
+	write_output(sink, link->href_prefix);
+	write_escaped_text(sink, link->url);
+	if (link->title)
+	{
+		write_output(sink, "\" title=\""_s);
+		write_escaped_text(sink, link->title);
+	}
+	write_output(sink, "\">"_s);
+	write_text(sink, link->text);
+	write_output(sink, "</a>"_s);
+}
+
+static void write_inline_text(HTML_Emitter *emitter, Output_Sink *sink, String text)
+{
+	HTML_Inline_Visitor visitor = { { html_visit_text, html_visit_link }, sink };
+	visit_inline_text(emitter->links, text, &visitor.visitor);
+}
+
+static bool is_code_label(String_Label type)
+{
+	return type == ST_CODE || type == ST_CODE_INDENTED;
+}
+
+// there is one of these per block, so no printf
+static void write_source_position(Output_Sink *sink, Source_Block *block)
+{
+	String prefix = " data-sourcepos=\""_s;
+	u8 attribute[64];
+	u8 *write = attribute;
+
+	copy(write, prefix.data, prefix.length);
+	write += prefix.length;
+	write = write_decimal(write, block->begin.line);
+	*write++ = ':';
+	write = write_decimal(write, block->begin.column);
+	*write++ = '-';
+	write = write_decimal(write, block->end.line);
+	*write++ = ':';
+	write = write_decimal(write, block->end.column);
+	*write++ = '"';
+
+	write_output(sink, { (umm)(write - attribute), attribute });
+}
+
+// the kinds that are containers in the parser, and have a Source_Block
+static bool has_source_block(Block_Kind kind)
+{
+	return kind == BLOCK_PARAGRAPH || kind == BLOCK_HEADING || kind == BLOCK_LIST ||
+		kind == BLOCK_LIST_ITEM || kind == BLOCK_CODE || kind == BLOCK_TABLE;
+}
+
+static const String block_tag_names[] =
+{
+	""_s, "p"_s, "h"_s, "ul"_s, "li"_s, "pre"_s, "table"_s, "thead"_s, "tbody"_s, "tr"_s, "th"_s, "td"_s,
+};
+
+static const String align_attributes[] =
+{
+	""_s, " align=\"left\""_s, " align=\"center\""_s, " align=\"right\""_s,
+};
+
+// data-sourcepos goes on the first tag, "<pre><code>" gets it on <pre>
+static void write_block_open(HTML_Emitter *emitter, Labeled_String token, Output_Sink *sink)
+{
+	u8 level = '0' + token.detail;
+	write_output(sink, "<"_s);
+	write_output(sink, block_tag_names[token.block]);
+
+	switch (token.block)
+	{
+	case BLOCK_HEADING:
+		write_output(sink, { 1, &level });
+		if (token.value)
+		{
+			write_output(sink, " id=\""_s);
+			write_output(sink, token.value);
+			write_output(sink, "\""_s);
+		}
+		break;
+	case BLOCK_TABLE_HEADER_CELL:
+	case BLOCK_TABLE_CELL:
+		if (token.detail <= TABLE_ALIGN_RIGHT)
+			write_output(sink, align_attributes[token.detail]);
+		break;
+	default: break;
+	}
+
+	if (emitter->next_block && has_source_block(token.block))
+	{
+		write_source_position(sink, &emitter->next_block->value);
+		emitter->next_block = emitter->next_block->next;
+	}
+
+	if (token.block == BLOCK_CODE)
+	{
+		// a language that would need escaping is left out
+		write_output(sink, "><code"_s);
+		if (token.value && find_first_occurance_of_any(token.value, "\"'<>&"_s) == NOT_FOUND)
+		{
+			write_output(sink, " class=\"language-"_s);
+			write_output(sink, token.value);
+			write_output(sink, "\""_s);
+		}
+	}
+	write_output(sink, ">"_s);
+}
+
+static void write_block_close(Labeled_String token, Output_Sink *sink)
+{
+	u8 level = '0' + token.detail;
+	if (token.block == BLOCK_CODE)
+		write_output(sink, "</code>"_s);
+	write_output(sink, "</"_s);
+	write_output(sink, block_tag_names[token.block]);
+	if (token.block == BLOCK_HEADING)
+		write_output(sink, { 1, &level });
+	write_output(sink, ">"_s);
+}
+
+// tokens are separated by newlines, except around code
+// where every byte of whitespace is significant, front matter isn't written at all
+void emit_html_token(HTML_Emitter *emitter, Labeled_String token, Output_Sink *sink)
+{
+	if (token.type == ST_META_TAG)
+		return;
+
+	if (emitter->token_count && !is_code_label(emitter->previous_type) && !is_code_label(token.type))
+		write_output(sink, "\n"_s);
+
+	// tags aren't written from the input, and have no source
+	String input = emitter->input;
+	bool is_tag = token.type == ST_BLOCK_OPEN || token.type == ST_BLOCK_CLOSE;
+	if (emitter->source_map && !is_tag && token.value && token.value.data >= input.data && token.value.data + token.value.length <= input.data + input.length)
+		emitter->source_map->append({ sink->bytes_written, (umm)(token.value.data - input.data), token.value.length });
+
+	switch (token.type)
+	{
+	case ST_BLOCK_OPEN:		write_block_open(emitter, token, sink); break;
+	case ST_BLOCK_CLOSE:	write_block_close(token, sink); break;
+	case ST_CODE:
+		if (token.detail)
+			write_escaped_html_unindented(sink, token);
+		else
+			write_escaped_html(sink, token.value);
+		break;
+	case ST_CODE_INDENTED:	write_escaped_html_unindented(sink, token); break;
+	case ST_TEXT:			write_inline_text(emitter, sink, token.value); break;
+	case ST_TABLE_CELL:
+		for (String cell = token.value; cell; )
+			write_inline_text(emitter, sink, consume_table_cell_run(&cell));
+		break;
+	default: break;
+	}
+
+	emitter->previous_type = token.type;
+	emitter->token_count++;
+}
+
+void finish_html(HTML_Emitter *emitter, Output_Sink *sink)
+{
+	write_output(sink, "\n"_s);
+}
+
+void emit_html(SLList<Labeled_String> &list, Output_Sink *sink)
+{
+	HTML_Emitter emitter = {};
+	for (auto *node = list.head; node != NULL; node = node->next)
+		emit_html_token(&emitter, node->value, sink);
+	finish_html(&emitter, sink);
+}
+
+
+
+// nested <ul> of links to every header, nesting follows the header levels
+void emit_table_of_contents(SLList<Heading> &outline, Output_Sink *sink)
+{
+	if (!outline.head)
+		return;
+
+	u32 level_stack[6];
+	u32 depth = 0;
+
+	write_output(sink, "<nav class=\"toc\">"_s);
+	for (auto *node = outline.head; node != NULL; node = node->next)
+	{
+		Heading heading = node->value;
+
+		if (depth == 0 || heading.level > level_stack[depth - 1])
+		{
+			// deeper headers get a nested list inside the still open <li>
+			write_output(sink, "\n<ul>"_s);
+			level_stack[depth++] = heading.level;
+		}
+		else
+		{
+			write_output(sink, "</li>"_s);
+			while (depth > 1 && heading.level <= level_stack[depth - 2])
+			{
+				write_output(sink, "\n</ul></li>"_s);
+				depth--;
+			}
+
+			// a heading between two levels joins the deeper list, # A / ### C / ## B nests B under A
+			if (heading.level < level_stack[depth - 1])
+				level_stack[depth - 1] = heading.level;
+		}
+
+		write_output(sink, "\n<li><a href=\"#"_s);
+		write_output(sink, heading.slug);
+		write_output(sink, "\">"_s);
+		write_output(sink, heading.text);
+		write_output(sink, "</a>"_s);
+	}
+
+	write_output(sink, "</li>"_s);
+	while (depth > 1)
+	{
+		write_output(sink, "\n</ul></li>"_s);
+		depth--;
+	}
+	write_output(sink, "\n</ul>\n</nav>\n"_s);
+}
+
+
+
+// checked once per line, so a line can go over the token budget by what it adds
+// the memory budget is never exceeded, the region refuses the allocation instead
+static bool within_budget(Parse_Context *ctx)
+{
+	if (ctx->status != PARSE_OK)
+		return false;
+
+	if (temp->failed_allocations != ctx->failed_allocations)
+		ctx->status = PARSE_OUT_OF_MEMORY;
+	else if (ctx->options.max_tokens && ctx->section_list.count > ctx->options.max_tokens)
+		ctx->status = PARSE_TOO_MANY_TOKENS;
+
+	return ctx->status == PARSE_OK;
+}
+
+static void parse_tokens(Parse_Context *ctx, String input)
+{
+
+	String input_cursor = input;
+	bool section_open = false;
+
+	if (ctx->options.front_matter)
+		try_add_front_matter(ctx, &input_cursor);
+
+	while (input_cursor && within_budget(ctx))
+	{
+		String line;
+		{
+			ProfileScope(PROFILE_LINE_SCAN);
+			line = consume_line_preserve_whitespace(&input_cursor);
+		}
+		ctx->line_number++;
+		ctx->line_start = line.data;
+
+		// a blank line ends the current section
+		if (line == ""_s)
+		{
+			pop_containers(ctx, 0);
+			section_open = false;
+			continue;
+		}
+
+		// fenced code can interrupt any section, indented code only starts a new one
+		bool fence_interrupts = section_open && (line[0] == '`' || line[0] == '~' || line[0] == ' ');
+		if (fence_interrupts)
+		{
+			Code_Fence fence;
+			if (is_opening_code_fence(line, &fence))
+			{
+				pop_containers(ctx, 0);
+				section_open = false;
+			}
+		}
+
+		ProfileScope(PROFILE_CLASSIFY); // code blocks are consumed whole in here
+
+		// a line that isn't a row ends the table, and begins a section of its own
+		if (section_open && ctx->containers && ctx->containers->type == CONTAINER_TABLE)
+		{
+			if (try_add_table_row(ctx, line))
+				continue;
+			pop_containers(ctx, 0);
+			section_open = false;
+		}
+
+		if (!section_open)
+		{
+			if (try_add_code_block(ctx, line, &input_cursor))
+				continue;
+			if (try_add_header(ctx, line))
+				continue;
+			if (line[0] == '[' || line[0] == ' ')
+			{
+				if (try_add_link_definition(ctx, line))
+					continue;
+			}
+			if (try_add_table(ctx, line, &input_cursor))
+			{
+				section_open = true;
+				continue;
+			}
+
+			// open correct section based on first line
+			new_section_begin(ctx, line);
+			section_open = true;
+		}
+
+		bool list_el_added = try_add_list_element(ctx, line);
+
+		if (!list_el_added)
+			ctx->section_list.append({ ST_TEXT, BLOCK_NONE, 0, line });
+		set_block_end(ctx, line);
+	}
+
+	if (ctx->status == PARSE_OK)
+		pop_containers(ctx, 0);
+}
+
+//
+// scanning
+//
+// scan_document classifies blocks the way parse_tokens does, but only counts
+// what it finds, no tokens are made and nothing is written
+//
+
+static inline u32 count_bits(u32 value)
+{
+	value = value - ((value >> 1) & 0x55555555);
+	value = (value & 0x33333333) + ((value >> 2) & 0x33333333);
+	return (((value + (value >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
+}
+
+// a word is a run of letters, digits and bytes of non-ascii characters
+static umm count_words(String text)
+{
+	umm words = 0;
+	u32 in_word = 0; // whether the byte before is part of a word
+	umm i = 0;
+#if PARSER_SSE2
+	// unsigned range checks done as signed compares, by moving the range to the bottom
+	const __m128i letter_offset = _mm_set1_epi8((char)('a' - 128));
+	const __m128i letter_limit = _mm_set1_epi8((char)(26 - 128));
+	const __m128i digit_offset = _mm_set1_epi8((char)('0' - 128));
+	const __m128i digit_limit = _mm_set1_epi8((char)(10 - 128));
+	const __m128i lowercase = _mm_set1_epi8(0x20);
+	const __m128i zero = _mm_setzero_si128();
+	for (; i + 16 <= text.length; i += 16)
+	{
+		__m128i block = _mm_loadu_si128((const __m128i*)(text.data + i));
+		__m128i letter = _mm_cmplt_epi8(_mm_sub_epi8(_mm_or_si128(block, lowercase), letter_offset), letter_limit);
+		__m128i digit = _mm_cmplt_epi8(_mm_sub_epi8(block, digit_offset), digit_limit);
+		__m128i non_ascii = _mm_cmplt_epi8(block, zero);
+		u32 mask = (u32) _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(letter, digit), non_ascii));
+
+		u32 starts = mask & ~((mask << 1) | in_word);
+		words += count_bits(starts);
+		in_word = (mask >> 15) & 1;
+	}
+#endif
+	for (; i < text.length; i++)
+	{
+		u8 c = text.data[i];
+		u32 word = c >= 0x80 || (u8)((c | 0x20) - 'a') < 26 || (u8)(c - '0') < 10;
+		words += word & ~in_word;
+		in_word = word;
+	}
+	return words;
+}
+
+static umm count_autolinks(String text)
+{
+	umm count = 0;
+	Autolink link;
+	for (umm from = 0; find_autolink(text, from, &link); from = link.end)
+		count++;
+	return count;
+}
+
+// the links visit_inline_text finds, and the autolinks between them
+static umm count_links(Link_Map *links, String text)
+{
+	umm count = 0;
+	umm run_start = 0;
+	umm i = 0;
+	while (links->count && i < text.length)
+	{
+		const u8 *open = (const u8*) memchr(text.data + i, '[', text.length - i);
+		if (!open)
+			break;
+		i = open - text.data;
+
+		String link_text;
+		Link_Definition *definition;
+		umm length = match_reference_link(links, substring(text, i, text.length - i), &link_text, &definition);
+		if (!length)
+		{
+			i++;
+			continue;
+		}
+
+		count += 1 + count_autolinks(substring(text, run_start, i - run_start));
+		i += length;
+		run_start = i;
+	}
+	return count + count_autolinks(substring(text, run_start, text.length - run_start));
+}
+
+struct Scan_Context
+{
+	Document_Stats *stats;
+	Link_Map links;
+	SLList<String> bracket_lines; // text that may have reference links, counted once every definition is known
+};
+
+static void scan_text(Scan_Context *scan, String text)
+{
+	scan->stats->words += count_words(text);
+	if (memchr(text.data, '[', text.length))
+		scan->bracket_lines.append(text);
+	else
+		scan->stats->links += count_autolinks(text);
+}
+
+// the lines of a paragraph or a list after the first only matter when they end
+// it, which takes an empty line or a code fence, so the end is found by looking
+// at the byte after each line ending instead of classifying the lines
+static umm find_paragraph_end(String text, umm from)
+{
+#if PARSER_SSE2
+	const __m128i newline = _mm_set1_epi8('\n');
+	const __m128i carriage_return = _mm_set1_epi8('\r');
+	const __m128i backtick = _mm_set1_epi8('`');
+	const __m128i tilde = _mm_set1_epi8('~');
+	const __m128i space = _mm_set1_epi8(' ');
+#endif
+	umm i = from;
+	while (true)
+	{
+		umm ending = NOT_FOUND;
+#if PARSER_SSE2
+		for (; i + 16 + 1 <= text.length; i += 16)
+		{
+			__m128i block = _mm_loadu_si128((const __m128i*)(text.data + i));
+			__m128i next = _mm_loadu_si128((const __m128i*)(text.data + i + 1));
+			__m128i line_ending = _mm_or_si128(_mm_cmpeq_epi8(block, newline), _mm_cmpeq_epi8(block, carriage_return));
+			__m128i next_ending = _mm_or_si128(_mm_cmpeq_epi8(next, newline), _mm_cmpeq_epi8(next, carriage_return));
+			__m128i next_fence = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(next, backtick), _mm_cmpeq_epi8(next, tilde)), _mm_cmpeq_epi8(next, space));
+			int mask = _mm_movemask_epi8(_mm_and_si128(line_ending, _mm_or_si128(next_ending, next_fence)));
+			if (mask)
+			{
+				umm bit = 0;
+				while (!(mask & (1 << bit)))
+					bit++;
+				ending = i + bit;
+				break;
+			}
+		}
+#endif
+		if (ending == NOT_FOUND)
+		{
+			for (; i < text.length; i++)
+			{
+				if (text[i] != '\n' && text[i] != '\r')
+					continue;
+				if (i + 1 == text.length)
+					return i;
+				u8 c = text[i + 1];
+				if (c == '\n' || c == '\r' || c == '`' || c == '~' || c == ' ')
+				{
+					ending = i;
+					break;
+				}
+			}
+			if (ending == NOT_FOUND)
+				return text.length;
+		}
+
+		// the second byte of a "\r\n" or "\n\r" ending is not an empty line
+		umm next_line = ending + 1;
+		if (next_line < text.length && text[ending] != text[next_line] && (text[next_line] == '\n' || text[next_line] == '\r'))
+			next_line++;
+		if (next_line == text.length)
+			return ending;
+		u8 c = text[next_line];
+		if (c == '\n' || c == '\r')
+			return ending;
+
+		// most lines that start with a space are indented text, not fences
+		umm fence_start = next_line;
+		while (fence_start < text.length && fence_start - next_line < 3 && text[fence_start] == ' ')
+			fence_start++;
+		Code_Fence fence;
+		if (fence_start < text.length && (text[fence_start] == '`' || text[fence_start] == '~') &&
+			is_opening_code_fence(peek_line_preserve_whitespace(substring(text, next_line, text.length - next_line)), &fence))
+			return ending;
+		i = next_line;
+	}
+}
+
+// the words and autolinks of a whole paragraph or list at once, only lines
+// with a '[' are kept apart, reference links are matched a line at a time
+static void scan_text_block(Scan_Context *scan, String block)
+{
+	scan->stats->words += count_words(block);
+	if (!memchr(block.data, '[', block.length))
+	{
+		scan->stats->links += count_autolinks(block);
+		return;
+	}
+
+	while (block)
+	{
+		String line = consume_line_preserve_whitespace(&block);
+		if (memchr(line.data, '[', line.length))
+			scan->bracket_lines.append(line);
+		else
+			scan->stats->links += count_autolinks(line);
+	}
+}
+
+static inline bool is_list_item_line(String trimmed_line)
+{
+	return prefix_equals(trimmed_line, "- "_s) || prefix_equals(trimmed_line, "* "_s);
+}
+
+// list levels go up by at most one at a time, see try_add_list_element
+static void scan_list_depth(String list, Document_Stats *stats)
+{
+	u32 list_depth = 0;
+	while (list)
+	{
+		String line = consume_line_preserve_whitespace(&list);
+		if (!is_list_item_line(trim(line)))
+			continue;
+
+		u32 line_indent_level = count_leading_whitespace(line) / 4 + 1;
+		if (list_depth == 0)
+			list_depth = 1;
+		else if (line_indent_level > list_depth)
+			list_depth++;
+		else
+			list_depth = line_indent_level;
+
+		if (list_depth > stats->max_list_depth)
+			stats->max_list_depth = list_depth;
+	}
+}
+
+void scan_document(String input, Document_Stats *stats, Parse_Options *options)
+{
+	*stats = Document_Stats();
+	stats->bytes = input.length;
+
+	Scan_Context scan;
+	scan.stats = stats;
+
+	String input_cursor = input;
+	if (!options || options->front_matter)
+	{
+		Front_Matter_Format format;
+		String block;
+		match_front_matter(input_cursor, &format, &block);
+		consume(&input_cursor, block.length);
+	}
+
+	bool in_table = false;
+	while (input_cursor)
+	{
+		String line = consume_line_preserve_whitespace(&input_cursor);
+		if (line == ""_s)
+		{
+			in_table = false;
+			continue;
+		}
+
+		// the same order of checks as parse_tokens
+		Code_Fence fence;
+		if (in_table && (line[0] == '`' || line[0] == '~' || line[0] == ' ') && is_opening_code_fence(line, &fence))
+			in_table = false;
+
+		if (in_table)
+		{
+			if (memchr(line.data, '|', line.length))
+			{
+				scan_text(&scan, line);
+				continue;
+			}
+			in_table = false;
+		}
+
+		if (is_opening_code_fence(line, &fence))
+		{
+			String block;
+			stats->code_bytes += consume_fenced_code(&fence, &input_cursor, &block).length;
+			continue;
+		}
+		if (is_indented_code_start(line))
+		{
+			String rest_of_block;
+			stats->code_bytes += consume_indented_code(line, &input_cursor, &rest_of_block).length;
+			continue;
+		}
+
+		String trimmed_line = trim(line);
+		u32 header_level = get_header_level(trimmed_line);
+		if (header_level)
+		{
+			Heading heading = { header_level, get_header_text(trimmed_line), {} };
+			stats->outline.append(heading);
+			scan_text(&scan, heading.text);
+			continue;
+		}
+
+		String label;
+		Link_Definition definition;
+		if ((line[0] == '[' || line[0] == ' ') && parse_link_definition(line, &label, &definition))
+		{
+			add_link_definition(&scan.links, label, definition);
+			continue;
+		}
+
+		String delimiter_row = peek_line_preserve_whitespace(input_cursor);
+		if (memchr(line.data, '|', line.length) && delimiter_row && memchr(delimiter_row.data, '-', delimiter_row.length))
+		{
+			u32 columns = split_table_row(line, NULL, 0);
+			if (columns && split_table_delimiter_row(delimiter_row, NULL, 0) == columns)
+			{
+				consume_line_preserve_whitespace(&input_cursor);
+				scan_text(&scan, line);
+				in_table = true;
+				continue;
+			}
+		}
+
+		// a paragraph or a list, from the start of this line
+		umm start = line.data - input.data;
+		umm end = find_paragraph_end(input, start);
+		String block = substring(input, start, end - start);
+		if (is_list_item_line(trimmed_line))
+			scan_list_depth(block, stats);
+		scan_text_block(&scan, block);
+
+		input_cursor = substring(input, end, input.length - end);
+		if (input_cursor)
+			consume_line_preserve_whitespace(&input_cursor);
+	}
+
+	for (auto *node = scan.bracket_lines.head; node != NULL; node = node->next)
+		stats->links += count_links(&scan.links, node->value);
+}
+
+
+static bool any_output_full(Token_Sink **sinks, umm sink_count)
+{
+	for (umm i = 0; i < sink_count; i++)
+		if (sinks[i]->output && sinks[i]->output->full)
+			return true;
+	return false;
+}
+
+const char *get_parse_status_message(Parse_Status status)
+{
+	switch (status)
+	{
+	case PARSE_OK:					return "ok";
+	case PARSE_OUT_OF_MEMORY:		return "the document needs more memory than allowed";
+	case PARSE_TOO_MANY_TOKENS:		return "the document has more tokens than allowed";
+	case PARSE_TOO_DEEP:			return "the document is nested deeper than allowed";
+	case PARSE_OUTPUT_TOO_LARGE:	return "the output is larger than allowed";
+	}
+	return "unknown parse status";
+}
+
+// every sink sees every token in the same traversal of the token list
+Parse_Status parse(String input, Token_Sink **sinks, umm sink_count, Parse_Options *options, Parse_Result *result)
+{
+	Parse_Context ctx;
+	if (options)
+		ctx.options = *options;
+	if (ctx.options.data_sourcepos)
+		ctx.options.source_positions = true;
+
+	ctx.input = input;
+
+	// the limit is relative to what the region already holds, and only
+	// applies while parsing, the caller may keep using the region after
+	uintptr_t previous_byte_limit = temp->byte_limit;
+	if (ctx.options.max_memory_bytes)
+	{
+		uintptr_t byte_limit = temp->bytes_reserved + ctx.options.max_memory_bytes;
+		if (!previous_byte_limit || byte_limit < previous_byte_limit)
+			temp->byte_limit = byte_limit;
+	}
+	ctx.failed_allocations = temp->failed_allocations;
+
+	parse_tokens(&ctx, input);
+	within_budget(&ctx);
+
+	temp->byte_limit = previous_byte_limit;
+	if (ctx.status != PARSE_OK)
+		return ctx.status;
+
+	Parse_Result local_result;
+	if (!result)
+		result = &local_result;
+	result->input = input;
+	result->tokens = ctx.section_list;
+	result->outline = ctx.outline;
+	result->blocks = ctx.blocks;
+	result->source_map = {};
+	result->links = ctx.links;
+	result->front_matter = ctx.front_matter;
+	result->front_matter_format = ctx.front_matter_format;
+
+	if (ctx.options.max_output_bytes)
+	{
+		for (umm i = 0; i < sink_count; i++)
+			if (sinks[i]->output)
+				sinks[i]->output->byte_limit = sinks[i]->output->bytes_written + ctx.options.max_output_bytes;
+	}
+
+	ProfileScope(PROFILE_OUTPUT);
+	for (umm i = 0; i < sink_count; i++)
+		sinks[i]->begin(sinks[i], result);
+
+	for (auto *node = ctx.section_list.head; node != NULL; node = node->next)
+	{
+		if (any_output_full(sinks, sink_count))
+			return PARSE_OUTPUT_TOO_LARGE;
+
+		for (umm i = 0; i < sink_count; i++)
+			sinks[i]->token(sinks[i], node->value);
+	}
+
+	for (umm i = 0; i < sink_count; i++)
+		sinks[i]->end(sinks[i]);
+
+	if (any_output_full(sinks, sink_count))
+		return PARSE_OUTPUT_TOO_LARGE;
+	return PARSE_OK;
+}
+
+Parse_Status parse(String input, Output_Sink *sink, Parse_Options *options, Parse_Result *result)
+{
+	HTML_Token_Sink html;
+	init_html_token_sink(&html, sink, options);
+
+	Token_Sink *sinks[] = { &html.sink };
+	return parse(input, sinks, 1, options, result);
+}
+
+String parse(String input, Parse_Options *options)
+{
+	UTF8_Sink sink;
+	init_utf8_sink(&sink);
+	if (parse(input, &sink.sink, options) != PARSE_OK)
+		free_string_builder(&sink.builder);
+	return sink.builder.string;
+}
+
+String16 parse_to_utf16(String input, Parse_Options *options)
+{
+	UTF16_Sink sink;
+	init_utf16_sink(&sink);
+	if (parse(input, &sink.sink, options) != PARSE_OK)
+		free_utf16_sink(&sink);
+	return sink.string;
+}
@@ -1,5 +1,258 @@
 #pragma once
 
 #include "string.h"
+#include "list.h"
+#include "hash_table.h"
+#include "output.h"
 
-String parse(String input);
\ No newline at end of file
+enum String_Label : u8
+	{
+		ST_UNKNOWN,
+		ST_BLOCK_OPEN,		// a block begins, see Block_Kind
+		ST_BLOCK_CLOSE,		// and ends, with the same kind and detail
+		ST_META_TAG,		// front matter, not written as html
+		ST_TEXT,
+		ST_CODE,			// escaped on output, never inline-processed, detail is the indent of the opening fence,
+							// up to that many spaces are stripped from each line on output
+		ST_CODE_INDENTED,	// same as ST_CODE, but up to 4 columns of indent are stripped from each line on output
+		ST_TABLE_CELL		// same as ST_TEXT, but \| stands for |, see consume_table_cell_run
+	};
+
+// what an ST_BLOCK_OPEN or ST_BLOCK_CLOSE token opens or closes
+// every output format writes its own markup for these, nothing reads html back
+enum Block_Kind : u8
+	{
+		BLOCK_NONE,
+		BLOCK_PARAGRAPH,
+		BLOCK_HEADING,			// detail is the level, 1..6, value is the slug, empty without anchors
+		BLOCK_LIST,
+		BLOCK_LIST_ITEM,
+		BLOCK_CODE,				// value is the language, the first word of the info string, if there is one
+		BLOCK_TABLE,
+		BLOCK_TABLE_HEAD,
+		BLOCK_TABLE_BODY,		// only if the table has a row after the header
+		BLOCK_TABLE_ROW,
+		BLOCK_TABLE_HEADER_CELL,	// detail is the column's Table_Alignment
+		BLOCK_TABLE_CELL,			// same
+	};
+
+enum Table_Alignment : u8
+	{
+		TABLE_ALIGN_NONE,
+		TABLE_ALIGN_LEFT,
+		TABLE_ALIGN_CENTER,
+		TABLE_ALIGN_RIGHT,
+	};
+
+// value is either a slice of the input or a string owned by the parser (slugs)
+// block is only set on ST_BLOCK_OPEN and ST_BLOCK_CLOSE, detail on those and ST_CODE
+struct Labeled_String
+{
+	String_Label type;
+	Block_Kind block;
+	u8 detail;
+	String value;
+};
+
+struct Parse_Options
+{
+	bool heading_anchors = true;	// <h2 id="slug">, slugs are unique within the document
+	bool table_of_contents = false;	// emit the header outline as a nested list before the body
+	bool source_positions = false;	// fill Parse_Result::blocks
+	bool data_sourcepos = false;	// <p data-sourcepos="3:1-4:17">, implies source_positions
+	bool source_map = false;		// fill Parse_Result::source_map while writing html
+	bool front_matter = true;		// a leading front matter block becomes an ST_META_TAG token, see find_front_matter
+	bool unsafe_links = false;		// keep javascript:, vbscript:, file: and data: link urls, only for trusted input
+
+	// budgets for untrusted input, 0 means no limit
+	// parse() stops as soon as one runs out and returns why, see Parse_Status
+	umm max_memory_bytes = 0;		// the temp region may only grow by this much while parsing
+	umm max_tokens = 0;
+	u32 max_depth = 0;				// list nesting
+	umm max_output_bytes = 0;		// per output sink
+};
+
+enum Parse_Status
+{
+	PARSE_OK,
+	PARSE_OUT_OF_MEMORY,
+	PARSE_TOO_MANY_TOKENS,
+	PARSE_TOO_DEEP,
+	PARSE_OUTPUT_TOO_LARGE,
+};
+
+const char *get_parse_status_message(Parse_Status status);
+
+struct Heading
+{
+	u32 level;		// 1..6
+	String text;	// slice of the input
+	String slug;	// empty if neither anchors nor the table of contents were requested
+};
+
+// line and column are 1 based, columns count bytes
+struct Source_Position
+{
+	umm offset;
+	u32 line;
+	u32 column;
+};
+
+// a paragraph, header, list, list item, code block or table
+// there is one for every ST_BLOCK_OPEN token of those kinds, in the same order
+struct Source_Block
+{
+	Source_Position begin;
+	Source_Position end;	// the last byte of the block
+};
+
+// html output offset -> input offset, for every token that is a slice of the input
+// offsets are in bytes of UTF-8, even if the output is transcoded
+struct Source_Mapping
+{
+	umm output_offset;
+	umm input_offset;
+	umm length;				// of the slice in the input, escaping can make the output longer
+};
+
+// [label]: url "title", on a line of its own where a section could begin
+// they can come after the links that use them, so [text][label], [label][] and [label]
+// are only resolved when the html is written, see emit_html_token
+struct Link_Definition
+{
+	String url;		// slice of the input
+	String title;	// slice of the input, without the quotes, empty if there's none
+};
+
+// keyed by fold_link_label, the first definition of a label wins
+typedef String_Map<Link_Definition> Link_Map;
+
+// brackets with more than this in between are never a label
+constexpr umm LINK_LABEL_MAX = 999;
+
+// trims, collapses runs of whitespace to a single space and lowercases ascii
+// 'folded' needs room for label.length bytes, the result is never longer
+String fold_link_label(String label, u8 *folded);
+
+enum Front_Matter_Format
+{
+	FRONT_MATTER_NONE,
+	FRONT_MATTER_YAML,	// between --- and --- or ...
+	FRONT_MATTER_TOML,	// between +++ and +++
+};
+
+// the front matter is everything between a fence on the first line of the
+// input and the first closing fence, it has to be closed to count
+// only looks as far as the closing fence, so it's cheap to call on its own
+// returns a slice of the input, or an empty string and FRONT_MATTER_NONE
+String find_front_matter(String input, Front_Matter_Format *format = NULL);
+
+// the value of a top level "key: value" (yaml) or "key = value" (toml) line in
+// what find_front_matter returned, without the quotes if it's quoted
+// nested keys, lists and values over more than one line aren't looked at
+// returns an empty string if the key isn't there
+String find_front_matter_field(String front_matter, Front_Matter_Format format, String key);
+
+struct Parse_Result
+{
+	String input;
+	SLList<Labeled_String> tokens;	// the whole document, ready for output
+	SLList<Heading> outline;		// every header, in document order
+	SLList<Source_Block> blocks;	// in the order they begin, with source_positions
+	SLList<Source_Mapping> source_map;	// with source_map, filled by the html sink
+	Link_Map links;					// every link definition, they don't produce tokens
+	String front_matter;			// also the first token, as ST_META_TAG, html leaves it out
+	Front_Matter_Format front_matter_format;
+};
+
+// what scan_document finds out about a document
+struct Document_Stats
+{
+	umm bytes = 0;
+	umm words = 0;				// runs of letters, digits and non-ascii bytes, outside of code
+	umm links = 0;				// reference links that resolve, and autolinks
+	umm code_bytes = 0;			// in the bodies of code blocks
+	u32 max_list_depth = 0;
+	SLList<Heading> outline;	// every header, slugs are left empty
+};
+
+// the block classification of parse() without tokens or output, for when only
+// the stats are wanted, allocates nothing but the outline, the link
+// definitions, and a list node for every line with a '['
+// input must be valid UTF-8, only options->front_matter is looked at
+void scan_document(String input, Document_Stats *stats, Parse_Options *options = NULL);
+
+// consumes the parsed document one token at a time, see formats.h
+// headers are all known by the time begin() is called, so a table of contents
+// can go before the body without a second pass over the input or the output
+struct Token_Sink
+{
+	void (*begin)(Token_Sink *sink, Parse_Result *result);
+	void (*token)(Token_Sink *sink, Labeled_String token);
+	void (*end)(Token_Sink *sink);
+
+	Output_Sink *output; // where the sink writes to, max_output_bytes is applied to it
+};
+
+// input must be valid UTF-8, see sanitize_utf8
+// options and result can be NULL
+// when a budget runs out, the sinks see nothing if it happened while parsing,
+// or the output stops short without end() being called if it happened while writing
+Parse_Status parse(String input, Token_Sink **sinks, umm sink_count, Parse_Options *options = NULL, Parse_Result *result = NULL);
+Parse_Status parse(String input, Output_Sink *sink, Parse_Options *options = NULL, Parse_Result *result = NULL); // html only
+
+// returned strings are heap allocated and null terminated, or empty if a budget ran out
+String parse(String input, Parse_Options *options = NULL);
+String16 parse_to_utf16(String input, Parse_Options *options = NULL);
+
+
+// html output, one token at a time
+// emit_html and emit_table_of_contents produce exactly what parse() writes
+struct HTML_Emitter
+{
+	String_Label previous_type;
+	umm token_count;
+
+	String input;
+	SLList<Source_Mapping> *source_map;	// NULL if not wanted
+	Link_Map *links;					// NULL or empty if there's nothing to resolve
+	SLList<Source_Block>::SLList_Node *next_block;	// for data-sourcepos, NULL if not wanted
+};
+
+void emit_html_token(HTML_Emitter *emitter, Labeled_String token, Output_Sink *sink);
+void finish_html(HTML_Emitter *emitter, Output_Sink *sink);
+
+void emit_html(SLList<Labeled_String> &list, Output_Sink *sink);
+void emit_table_of_contents(SLList<Heading> &outline, Output_Sink *sink);
+
+// a reference link or an autolink found in text, see visit_inline_text
+struct Inline_Link
+{
+	String text;		// slice of the input, character references aren't decoded
+	String href_prefix;	// goes before the url, "http://" or "mailto:" for autolinks that need one
+	String url;			// from the Link_Definition, or the text itself for autolinks
+	String title;		// empty if there's none, autolinks never have one
+};
+
+// what visit_inline_text splits text into, so every format resolves links the same way
+struct Inline_Visitor
+{
+	void (*text)(Inline_Visitor *visitor, String text);
+	void (*link)(Inline_Visitor *visitor, Inline_Link *link);
+};
+
+// 'text' is an ST_TEXT token, or a run of an ST_TABLE_CELL one
+// [text][label], [label][] and [label] that 'links' has a definition for go
+// to visitor->link, and so do the autolinks in the runs between them, what's
+// left goes to visitor->text, empty runs are skipped
+void visit_inline_text(Link_Map *links, String text, Inline_Visitor *visitor);
+
+// for attributes and anything else where all of the text is escaped, character references decoded first
+void write_escaped_text(Output_Sink *sink, String text);
+
+// one line of a code token, with its line ending, for formats that need the code itself
+// 'code' starts out as the token's value, the indent the token says to strip is left out
+String consume_code_line(String *code, Labeled_String token);
+
+// a table cell in runs of text to write one after the other, without the backslashes of escaped pipes
+String consume_table_cell_run(String *cell);
\ No newline at end of file
@@ -0,0 +1,1008 @@
+#pragma once
+
+#include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "typedef.h"
+#include "macros.h"
+#include "memory.h"
+#include "string.h"
+#include "utf8.h"
+#include "output.h"
+#include "parser.h"
+#include "file_io.h"
+#include "formats.h"
+#include "page_template.h"
+#include "search_index.h"
+#include "pipeline.h"
+#include "profile.h"
+
+#ifdef __linux__
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#endif
+
+
+
+//
+// Lock-free queue.
+// Bounded, and any number of threads can push and pop. Every cell has a
+// sequence number that says whether it can be written or read on this lap
+// around the ring, so pushing and popping only ever race on one position.
+//
+
+
+struct Queue_Cell
+{
+    std::atomic<umm> sequence;
+    void* value;
+};
+
+struct Work_Queue
+{
+    Queue_Cell* cells;
+    umm mask;
+    alignas(64) std::atomic<umm> push_position;
+    alignas(64) std::atomic<umm> pop_position;
+};
+
+static void init_work_queue(Work_Queue* queue, umm min_capacity)
+{
+    umm capacity = 2;
+    while (capacity < min_capacity)
+        capacity *= 2;
+
+    queue->cells = (Queue_Cell*) calloc(capacity, sizeof(Queue_Cell));
+    queue->mask = capacity - 1;
+    for (umm i = 0; i < capacity; i++)
+        queue->cells[i].sequence.store(i, std::memory_order_relaxed);
+    queue->push_position.store(0, std::memory_order_relaxed);
+    queue->pop_position.store(0, std::memory_order_relaxed);
+}
+
+static void free_work_queue(Work_Queue* queue)
+{
+    free(queue->cells);
+    queue->cells = NULL;
+}
+
+// Returns false if the queue is full.
+static bool push(Work_Queue* queue, void* value)
+{
+    umm position = queue->push_position.load(std::memory_order_relaxed);
+    while (true)
+    {
+        Queue_Cell* cell = &queue->cells[position & queue->mask];
+        umm sequence = cell->sequence.load(std::memory_order_acquire);
+        imm difference = (imm) sequence - (imm) position;
+
+        if (difference == 0)
+        {
+            if (queue->push_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                cell->value = value;
+                cell->sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (difference < 0)
+        {
+            return false;
+        }
+        else
+        {
+            position = queue->push_position.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+// Returns NULL if the queue is empty.
+static void* pop(Work_Queue* queue)
+{
+    umm position = queue->pop_position.load(std::memory_order_relaxed);
+    while (true)
+    {
+        Queue_Cell* cell = &queue->cells[position & queue->mask];
+        umm sequence = cell->sequence.load(std::memory_order_acquire);
+        imm difference = (imm) sequence - (imm)(position + 1);
+
+        if (difference == 0)
+        {
+            if (queue->pop_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                void* value = cell->value;
+                cell->sequence.store(position + queue->mask + 1, std::memory_order_release);
+                return value;
+            }
+        }
+        else if (difference < 0)
+        {
+            return NULL;
+        }
+        else
+        {
+            position = queue->pop_position.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+
+
+//
+// Waiting.
+// The queues never block, so a thread with nothing to pop waits on a
+// semaphore that's posted once for every push. Posting takes the lock, but
+// only ever for as long as it takes to bump the count.
+//
+
+
+struct Semaphore
+{
+    std::mutex mutex;
+    std::condition_variable condition;
+    umm count;
+};
+
+static void post(Semaphore* semaphore, umm count = 1)
+{
+    {
+        std::lock_guard<std::mutex> lock(semaphore->mutex);
+        semaphore->count += count;
+    }
+    if (count == 1)
+        semaphore->condition.notify_one();
+    else
+        semaphore->condition.notify_all();
+}
+
+static void wait(Semaphore* semaphore)
+{
+    std::unique_lock<std::mutex> lock(semaphore->mutex);
+    semaphore->condition.wait(lock, [semaphore] { return semaphore->count != 0; });
+    semaphore->count--;
+}
+
+// A post means a push has finished, but with more than one thread pushing, the
+// cell at the front can still be one whose push hasn't. That's a matter of a
+// few instructions on the other thread, so this just yields until it lands.
+static void* pop_posted(Work_Queue* queue)
+{
+    void* value;
+    while (!(value = pop(queue)))
+        std::this_thread::yield();
+    return value;
+}
+
+
+
+//
+// Documents and workers.
+//
+
+
+// One slot per document in flight. The input is allocated in the slot's own
+// region, so whichever thread reads it, it's freed in one go once written.
+struct Pipeline_Document
+{
+    Pipeline_Job* job;
+    LK_Region input_memory;
+    String input;
+    umm read_offset;
+    String_Builder output;   // Heap allocated by the UTF-8 sink.
+    umm write_offset;
+    int file;
+    bool ok;
+    u64 submitted;           // user_data of its operation in the ring, 0 if there's none.
+};
+
+struct Pipeline
+{
+    Pipeline_Options options;
+    Pipeline_Job* jobs;
+    umm job_count;
+
+    Pipeline_Document* documents;
+    Work_Queue free_documents;     // Only used without io_uring.
+    Work_Queue read_documents;     // To the workers.
+    Work_Queue parsed_documents;   // From the workers back to the I/O thread.
+    Semaphore documents_free;      // Posted for every push to free_documents.
+    Semaphore documents_read;      // Posted for every push to read_documents, and once per worker at the end.
+    std::atomic<umm> next_job;
+    std::atomic<bool> reading_done; // read_documents gets nothing new once this is set.
+    std::atomic<umm> converted;
+    std::atomic<umm> bytes_read;
+    std::atomic<umm> bytes_written;
+    Search_Index_Shard* shards;    // One per worker, with options.index_path.
+
+    bool workers_write;            // Workers write their own output, without io_uring.
+    int wake_event;                // eventfd the workers signal after pushing to parsed_documents.
+    u64 wake_count;                // Read into by the ring, until it's closed.
+};
+
+
+static void finish_document(Pipeline* pipeline, Pipeline_Document* document)
+{
+    document->job->converted = document->ok;
+    if (document->ok)
+    {
+        pipeline->converted.fetch_add(1, std::memory_order_relaxed);
+        pipeline->bytes_written.fetch_add(document->output.string.length, std::memory_order_relaxed);
+    }
+
+    free_string_builder(&document->output);
+    lk_region_free(&document->input_memory);
+    document->input = {};
+    document->job = NULL;
+}
+
+// Runs on a worker, 'temp' is the worker's own region.
+// 'shard' is the worker's own too, or NULL when there's no index.
+static void convert_document(Pipeline* pipeline, Pipeline_Document* document, Search_Index_Shard* shard)
+{
+    String input = document->input;
+    if (document->ok)
+        document->ok = sanitize_utf8(&input, pipeline->options.utf8_policy) == UTF8_OK;
+
+    if (document->ok)
+    {
+        UTF8_Sink sink;
+        init_utf8_sink(&sink);
+        Parse_Options parse_options = pipeline->options.parse_options;
+
+        // The index is fed from the same traversal as the HTML.
+        HTML_Token_Sink html_format;
+        Template_Token_Sink template_format;
+        Index_Token_Sink index_format;
+        Token_Sink* formats[2];
+        umm format_count = 0;
+
+        if (pipeline->options.page_template)
+        {
+            init_template_token_sink(&template_format, pipeline->options.page_template, &sink.sink, &parse_options);
+            formats[format_count++] = &template_format.sink;
+        }
+        else
+        {
+            init_html_token_sink(&html_format, &sink.sink, &parse_options);
+            formats[format_count++] = &html_format.sink;
+        }
+
+        if (shard)
+        {
+            init_index_token_sink(&index_format, shard, (u32)(document->job - pipeline->jobs));
+            formats[format_count++] = &index_format.sink;
+        }
+
+        document->ok = parse(input, formats, format_count, &parse_options) == PARSE_OK;
+        document->output = sink.builder;
+    }
+}
+
+static void run_worker(Pipeline* pipeline, u32 worker)
+{
+    LK_Region worker_memory = {};
+    temp = &worker_memory;
+
+    while (true)
+    {
+        // The posts at the end come after every push, so an empty queue then means we're done.
+        wait(&pipeline->documents_read);
+        Pipeline_Document* document = (Pipeline_Document*) pop(&pipeline->read_documents);
+        if (!document)
+        {
+            if (pipeline->reading_done.load(std::memory_order_acquire))
+                break;
+            document = (Pipeline_Document*) pop_posted(&pipeline->read_documents);
+        }
+
+        LK_Region_Cursor cursor;
+        lk_region_cursor(temp, &cursor);
+
+        // Without io_uring the worker writes, and that's part of the document's time.
+        profile_begin_document();
+        convert_document(pipeline, document, pipeline->shards ? &pipeline->shards[worker] : NULL);
+
+        if (pipeline->workers_write)
+        {
+            if (document->ok)
+                document->ok = write_entire_file(document->job->output_path, document->output.string);
+            profile_end_document(document->job->input_path);
+            finish_document(pipeline, document);
+            push(&pipeline->free_documents, document);
+            post(&pipeline->documents_free);
+        }
+        else
+        {
+            profile_end_document(document->job->input_path);
+            push(&pipeline->parsed_documents, document);
+#ifdef __linux__
+            u64 one = 1;
+            (void) !write(pipeline->wake_event, &one, sizeof(one));
+#endif
+        }
+
+        lk_region_rewind(temp, &cursor);
+    }
+
+    profile_flush_thread();
+    lk_region_free(&worker_memory);
+}
+
+
+
+//
+// Blocking reads.
+// Every reader takes a free slot and the next job, and reads the whole file.
+// There are more readers than cores, so reads overlap each other and the parsing.
+//
+
+
+static void run_reader(Pipeline* pipeline)
+{
+    while (true)
+    {
+        umm job = pipeline->next_job.fetch_add(1, std::memory_order_relaxed);
+        if (job >= pipeline->job_count)
+            break;
+
+        wait(&pipeline->documents_free);
+        Pipeline_Document* document = (Pipeline_Document*) pop_posted(&pipeline->free_documents);
+
+        document->job = &pipeline->jobs[job];
+        temp = &document->input_memory;
+        document->ok = read_entire_file(&document->input, document->job->input_path);
+        if (document->ok)
+            pipeline->bytes_read.fetch_add(document->input.length, std::memory_order_relaxed);
+
+        push(&pipeline->read_documents, document);
+        post(&pipeline->documents_read);
+    }
+
+    profile_flush_thread();
+}
+
+static void run_blocking_io(Pipeline* pipeline, u32 reader_count)
+{
+    for (u32 i = 0; i < pipeline->options.max_in_flight; i++)
+        push(&pipeline->free_documents, &pipeline->documents[i]);
+    post(&pipeline->documents_free, pipeline->options.max_in_flight);
+
+    std::thread* readers = new std::thread[reader_count];
+    for (u32 i = 0; i < reader_count; i++)
+        readers[i] = std::thread(run_reader, pipeline);
+    for (u32 i = 0; i < reader_count; i++)
+        readers[i].join();
+    delete[] readers;
+}
+
+
+
+//
+// io_uring.
+// Used through the raw system calls, so there's nothing to link against.
+// Opens, reads and writes of every document in flight are submitted together,
+// and the I/O thread only ever blocks waiting for completions. Workers wake
+// it through an eventfd that always has a read pending in the ring.
+//
+
+
+#ifdef __linux__
+
+struct IO_Ring
+{
+    int fd;
+    u32 entries;
+    u32 pending;             // Submission entries filled, but not submitted yet.
+    u32 in_flight;           // Submission entries filled, whose completions haven't been taken yet.
+
+    void* submission_ring;
+    umm submission_ring_size;
+    u32* submission_head;
+    u32* submission_tail;
+    u32* submission_mask;
+    u32* submission_array;
+    io_uring_sqe* submissions;
+
+    void* completion_ring;
+    umm completion_ring_size;
+    u32* completion_head;
+    u32* completion_tail;
+    u32* completion_mask;
+    io_uring_cqe* completions;
+};
+
+static void close_io_ring(IO_Ring* ring)
+{
+    if (ring->submissions)
+        munmap(ring->submissions, ring->entries * sizeof(io_uring_sqe));
+    if (ring->completion_ring && ring->completion_ring != ring->submission_ring)
+        munmap(ring->completion_ring, ring->completion_ring_size);
+    if (ring->submission_ring)
+        munmap(ring->submission_ring, ring->submission_ring_size);
+    close(ring->fd);
+    ZeroStruct(ring);
+}
+
+static bool supports_opcodes(int ring_fd, const u8* opcodes, umm opcode_count)
+{
+    umm probe_size = sizeof(io_uring_probe) + 256 * sizeof(io_uring_probe_op);
+    io_uring_probe* probe = (io_uring_probe*) calloc(1, probe_size);
+    Defer(free(probe));
+
+    if (syscall(__NR_io_uring_register, ring_fd, IORING_REGISTER_PROBE, probe, 256) < 0)
+        return false;
+
+    for (umm i = 0; i < opcode_count; i++)
+    {
+        u8 opcode = opcodes[i];
+        if (opcode > probe->last_op || !(probe->ops[opcode].flags & IO_URING_OP_SUPPORTED))
+            return false;
+    }
+    return true;
+}
+
+// Fails on kernels without io_uring, or the operations used here, and where
+// it's turned off, like in many containers.
+static bool init_io_ring(IO_Ring* ring, u32 entries)
+{
+    ZeroStruct(ring);
+
+    io_uring_params params = {};
+    int fd = (int) syscall(__NR_io_uring_setup, entries, &params);
+    if (fd < 0)
+        return false;
+    ring->fd = fd;
+    ring->entries = params.sq_entries;
+
+    static const u8 opcodes[] = { IORING_OP_OPENAT, IORING_OP_READ, IORING_OP_WRITE };
+    if (!supports_opcodes(fd, opcodes, ArrayCount(opcodes)))
+    {
+        close_io_ring(ring);
+        return false;
+    }
+
+    ring->submission_ring_size = params.sq_off.array + params.sq_entries * sizeof(u32);
+    ring->completion_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool single_mapping = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mapping && ring->completion_ring_size > ring->submission_ring_size)
+        ring->submission_ring_size = ring->completion_ring_size;
+
+    void* submission_ring = mmap(NULL, ring->submission_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (submission_ring == MAP_FAILED)
+    {
+        close_io_ring(ring);
+        return false;
+    }
+    ring->submission_ring = submission_ring;
+
+    void* completion_ring = submission_ring;
+    if (!single_mapping)
+    {
+        completion_ring = mmap(NULL, ring->completion_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if (completion_ring == MAP_FAILED)
+        {
+            close_io_ring(ring);
+            return false;
+        }
+    }
+    ring->completion_ring = completion_ring;
+
+    void* submissions = mmap(NULL, params.sq_entries * sizeof(io_uring_sqe), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (submissions == MAP_FAILED)
+    {
+        close_io_ring(ring);
+        return false;
+    }
+    ring->submissions = (io_uring_sqe*) submissions;
+
+    u8* sq = (u8*) submission_ring;
+    ring->submission_head  = (u32*)(sq + params.sq_off.head);
+    ring->submission_tail  = (u32*)(sq + params.sq_off.tail);
+    ring->submission_mask  = (u32*)(sq + params.sq_off.ring_mask);
+    ring->submission_array = (u32*)(sq + params.sq_off.array);
+
+    u8* cq = (u8*) completion_ring;
+    ring->completion_head = (u32*)(cq + params.cq_off.head);
+    ring->completion_tail = (u32*)(cq + params.cq_off.tail);
+    ring->completion_mask = (u32*)(cq + params.cq_off.ring_mask);
+    ring->completions     = (io_uring_cqe*)(cq + params.cq_off.cqes);
+    return true;
+}
+
+// The pipeline never has more operations outstanding than the ring has entries.
+static io_uring_sqe* get_submission(IO_Ring* ring)
+{
+    u32 tail = *ring->submission_tail + ring->pending;
+    u32 head = __atomic_load_n(ring->submission_head, __ATOMIC_ACQUIRE);
+    DebugAssert(tail - head < ring->entries);
+
+    u32 index = tail & *ring->submission_mask;
+    ring->submission_array[index] = index;
+    ring->pending++;
+    ring->in_flight++;
+
+    io_uring_sqe* submission = &ring->submissions[index];
+    ZeroStruct(submission);
+    return submission;
+}
+
+static bool has_submission_space(IO_Ring* ring)
+{
+    u32 tail = *ring->submission_tail + ring->pending;
+    return tail - __atomic_load_n(ring->submission_head, __ATOMIC_ACQUIRE) < ring->entries;
+}
+
+// Submits everything filled so far and waits for 'wait_for' completions.
+// Returns false if that failed for any reason other than a signal, or the
+// kernel asking to take some completions first.
+static bool submit_and_wait(IO_Ring* ring, u32 wait_for = 1)
+{
+    u32 tail = *ring->submission_tail + ring->pending;
+    __atomic_store_n(ring->submission_tail, tail, __ATOMIC_RELEASE);
+    ring->pending = 0;
+
+    // Entries an earlier call didn't get to submit are still in the ring, they go with these.
+    u32 to_submit = tail - __atomic_load_n(ring->submission_head, __ATOMIC_ACQUIRE);
+    long result = syscall(__NR_io_uring_enter, ring->fd, to_submit, wait_for, wait_for ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+    return result >= 0 || errno == EINTR || errno == EAGAIN || errno == EBUSY;
+}
+
+static bool get_completion(IO_Ring* ring, io_uring_cqe* completion)
+{
+    u32 head = *ring->completion_head;
+    if (head == __atomic_load_n(ring->completion_tail, __ATOMIC_ACQUIRE))
+        return false;
+
+    *completion = ring->completions[head & *ring->completion_mask];
+    __atomic_store_n(ring->completion_head, head + 1, __ATOMIC_RELEASE);
+    ring->in_flight--;
+    return true;
+}
+
+
+// What a completion was for, in the low bits of its user_data.
+// Documents are at least 8 byte aligned.
+enum IO_Operation
+{
+    IO_WAKE,
+    IO_OPEN_INPUT,
+    IO_READ,
+    IO_OPEN_OUTPUT,
+    IO_WRITE,
+    IO_CANCEL,
+};
+
+// A single read or write moves at most 1 GB, the rest is resubmitted.
+static umm get_chunk_length(umm length)
+{
+    umm max_length = (umm) 1 << 30;
+    return length < max_length ? length : max_length;
+}
+
+static void submit(IO_Ring* ring, Pipeline_Document* document, IO_Operation operation)
+{
+    io_uring_sqe* submission = get_submission(ring);
+    submission->user_data = (u64)(uintptr_t) document | operation;
+    document->submitted = submission->user_data;
+
+    switch (operation)
+    {
+    case IO_OPEN_INPUT:
+    case IO_OPEN_OUTPUT:
+    {
+        bool input = operation == IO_OPEN_INPUT;
+        String path = input ? document->job->input_path : document->job->output_path;
+        submission->opcode = IORING_OP_OPENAT;
+        submission->fd = AT_FDCWD;
+        LK_Region* previous_temp = temp;
+        temp = &document->input_memory;
+        submission->addr = (u64)(uintptr_t) make_c_style_string(path);
+        temp = previous_temp;
+        submission->len = input ? 0 : 0644;
+        submission->open_flags = input ? (O_RDONLY | O_CLOEXEC) : (O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC);
+    } break;
+
+    case IO_READ:
+    {
+        submission->opcode = IORING_OP_READ;
+        submission->fd = document->file;
+        submission->addr = (u64)(uintptr_t)(document->input.data + document->read_offset);
+        submission->len = (u32) get_chunk_length(document->input.length - document->read_offset);
+        submission->off = document->read_offset;
+    } break;
+
+    case IO_WRITE:
+    {
+        String output = document->output.string;
+        submission->opcode = IORING_OP_WRITE;
+        submission->fd = document->file;
+        submission->addr = (u64)(uintptr_t)(output.data + document->write_offset);
+        submission->len = (u32) get_chunk_length(output.length - document->write_offset);
+        submission->off = document->write_offset;
+    } break;
+
+    default: break;
+    }
+}
+
+static void submit_wake(IO_Ring* ring, Pipeline* pipeline)
+{
+    io_uring_sqe* submission = get_submission(ring);
+    submission->opcode = IORING_OP_READ;
+    submission->fd = pipeline->wake_event;
+    submission->addr = (u64)(uintptr_t) &pipeline->wake_count;
+    submission->len = sizeof(pipeline->wake_count);
+    submission->user_data = IO_WAKE;
+}
+
+static void close_document_file(Pipeline_Document* document)
+{
+    if (document->file >= 0)
+        close(document->file);
+    document->file = -1;
+}
+
+// Returns true if the document is done reading, and can go to the workers.
+static bool handle_read_completion(IO_Ring* ring, Pipeline* pipeline, Pipeline_Document* document, IO_Operation operation, i32 result)
+{
+    if (result < 0)
+    {
+        document->ok = false;
+        close_document_file(document);
+        return true;
+    }
+
+    if (operation == IO_OPEN_INPUT)
+    {
+        document->file = result;
+
+        struct stat status;
+        if (fstat(document->file, &status) != 0)
+        {
+            document->ok = false;
+            close_document_file(document);
+            return true;
+        }
+
+        document->input.length = (umm) status.st_size;
+        document->input.data = LK_RegionArray(&document->input_memory, u8, document->input.length);
+        document->read_offset = 0;
+        if (!document->input.data && document->input.length)
+        {
+            document->ok = false;
+            close_document_file(document);
+            return true;
+        }
+    }
+    else
+    {
+        // A file that got shorter since it was opened just ends early.
+        if (result == 0)
+            document->input.length = document->read_offset;
+        document->read_offset += result;
+        pipeline->bytes_read.fetch_add(result, std::memory_order_relaxed);
+    }
+
+    if (document->read_offset < document->input.length)
+    {
+        submit(ring, document, IO_READ);
+        return false;
+    }
+
+    close_document_file(document);
+    return true;
+}
+
+// Returns true if the document is written, or writing it failed.
+static bool handle_write_completion(IO_Ring* ring, Pipeline_Document* document, IO_Operation operation, i32 result)
+{
+    if (result < 0)
+    {
+        document->ok = false;
+        close_document_file(document);
+        return true;
+    }
+
+    if (operation == IO_OPEN_OUTPUT)
+    {
+        document->file = result;
+        document->write_offset = 0;
+    }
+    else
+    {
+        document->write_offset += result;
+    }
+
+    if (document->write_offset < document->output.string.length)
+    {
+        submit(ring, document, IO_WRITE);
+        return false;
+    }
+
+    close_document_file(document);
+    return true;
+}
+
+// After a failure, the document the completion is for is finished as failed.
+static void abandon_completion(Pipeline* pipeline, IO_Operation operation, Pipeline_Document* document, i32 result)
+{
+    if (operation == IO_WAKE || operation == IO_CANCEL)
+        return;
+
+    if ((operation == IO_OPEN_INPUT || operation == IO_OPEN_OUTPUT) && result >= 0)
+        close(result);
+    close_document_file(document);
+
+    document->submitted = 0;
+    document->ok = false;
+    finish_document(pipeline, document);
+}
+
+// Cancels every operation in the ring and waits for all of them to complete,
+// so the kernel doesn't read from or write into memory that's been freed.
+// Returns false if the ring stopped working before that.
+static bool cancel_io_operations(Pipeline* pipeline, IO_Ring* ring)
+{
+    u32 max_in_flight = pipeline->options.max_in_flight;
+
+    // The documents, and then the wake read.
+    u32 next_target = 0;
+    while (true)
+    {
+        io_uring_cqe completion;
+        while (get_completion(ring, &completion))
+        {
+            IO_Operation operation = (IO_Operation)(completion.user_data & 7);
+            Pipeline_Document* document = (Pipeline_Document*)(uintptr_t)(completion.user_data & ~(u64) 7);
+            abandon_completion(pipeline, operation, document, completion.res);
+        }
+
+        while (next_target <= max_in_flight && has_submission_space(ring))
+        {
+            u64 target = next_target < max_in_flight ? pipeline->documents[next_target].submitted : IO_WAKE;
+            if (next_target == max_in_flight || target)
+            {
+                io_uring_sqe* submission = get_submission(ring);
+                submission->opcode = IORING_OP_ASYNC_CANCEL;
+                submission->addr = target;
+                submission->user_data = IO_CANCEL;
+            }
+            next_target++;
+        }
+
+        if (next_target > max_in_flight && !ring->in_flight)
+            return true;
+        if (!submit_and_wait(ring))
+            return false;
+    }
+}
+
+// Returns once every job is done, or once waiting for completions failed and
+// everything in the ring has been cancelled. Returns false if even that
+// failed, and the kernel may still be using the documents.
+static bool run_io_uring(Pipeline* pipeline, IO_Ring* ring)
+{
+    u32 max_in_flight = pipeline->options.max_in_flight;
+
+    Pipeline_Document** free_documents = (Pipeline_Document**) malloc(max_in_flight * sizeof(Pipeline_Document*));
+    Defer(free(free_documents));
+    u32 free_count = 0;
+    for (u32 i = 0; i < max_in_flight; i++)
+        free_documents[free_count++] = &pipeline->documents[i];
+
+    submit_wake(ring, pipeline);
+
+    umm next_job = 0;
+    while (true)
+    {
+        while (next_job < pipeline->job_count && free_count)
+        {
+            Pipeline_Document* document = free_documents[--free_count];
+            document->job = &pipeline->jobs[next_job++];
+            document->ok = true;
+            document->file = -1;
+            submit(ring, document, IO_OPEN_INPUT);
+        }
+
+        while (Pipeline_Document* document = (Pipeline_Document*) pop(&pipeline->parsed_documents))
+        {
+            if (document->ok)
+            {
+                submit(ring, document, IO_OPEN_OUTPUT);
+            }
+            else
+            {
+                finish_document(pipeline, document);
+                free_documents[free_count++] = document;
+            }
+        }
+
+        // Only the wake read is left in the ring then, and it has to go before wake_count does.
+        if (next_job == pipeline->job_count && free_count == max_in_flight)
+            return cancel_io_operations(pipeline, ring);
+
+        // Documents still in flight are counted as failed.
+        if (!submit_and_wait(ring))
+            return cancel_io_operations(pipeline, ring);
+
+        io_uring_cqe completion;
+        while (get_completion(ring, &completion))
+        {
+            IO_Operation operation = (IO_Operation)(completion.user_data & 7);
+            Pipeline_Document* document = (Pipeline_Document*)(uintptr_t)(completion.user_data & ~(u64) 7);
+            if (operation != IO_WAKE)
+                document->submitted = 0;
+
+            switch (operation)
+            {
+            case IO_WAKE:
+            {
+                submit_wake(ring, pipeline);
+            } break;
+
+            case IO_OPEN_INPUT:
+            case IO_READ:
+            {
+                if (handle_read_completion(ring, pipeline, document, operation, completion.res))
+                {
+                    push(&pipeline->read_documents, document);
+                    post(&pipeline->documents_read);
+                }
+            } break;
+
+            case IO_OPEN_OUTPUT:
+            case IO_WRITE:
+            {
+                if (handle_write_completion(ring, document, operation, completion.res))
+                {
+                    finish_document(pipeline, document);
+                    free_documents[free_count++] = document;
+                }
+            } break;
+
+            case IO_CANCEL: break;
+            }
+        }
+    }
+}
+
+#endif
+
+
+
+//
+// Running it.
+//
+
+
+bool run_pipeline(Pipeline_Job* jobs, umm job_count, Pipeline_Options* options, Pipeline_Stats* stats)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    // If io_uring fails so badly that its operations can't be cancelled, the kernel
+    // may still read and write the documents, and wake_count. They're left allocated.
+    bool ring_busy = false;
+
+    Pipeline* pipeline = new Pipeline();
+    Defer(if (!ring_busy) delete pipeline);
+    pipeline->options = *options;
+    pipeline->jobs = jobs;
+    pipeline->job_count = job_count;
+
+    if (!pipeline->options.worker_count)
+    {
+        u32 core_count = std::thread::hardware_concurrency();
+        pipeline->options.worker_count = core_count ? core_count : 1;
+    }
+    if (!pipeline->options.max_in_flight)
+        pipeline->options.max_in_flight = pipeline->options.worker_count * 4;
+
+    u32 max_in_flight = pipeline->options.max_in_flight;
+    pipeline->documents = (Pipeline_Document*) calloc(max_in_flight, sizeof(Pipeline_Document));
+    Defer(if (!ring_busy) free(pipeline->documents));
+    init_work_queue(&pipeline->free_documents, max_in_flight);
+    init_work_queue(&pipeline->read_documents, max_in_flight);
+    init_work_queue(&pipeline->parsed_documents, max_in_flight);
+    Defer(free_work_queue(&pipeline->free_documents));
+    Defer(free_work_queue(&pipeline->read_documents));
+    Defer(free_work_queue(&pipeline->parsed_documents));
+
+    // Blocking readers spend most of their time waiting, so there are more of them.
+    u32 reader_count = pipeline->options.worker_count * 2;
+    bool used_io_uring = false;
+
+#ifdef __linux__
+    // Every document has at most one operation outstanding, plus the wake read.
+    IO_Ring ring;
+    if (pipeline->options.allow_io_uring && init_io_ring(&ring, max_in_flight + 1))
+    {
+        pipeline->wake_event = eventfd(0, EFD_CLOEXEC);
+        if (pipeline->wake_event >= 0)
+            used_io_uring = true;
+        else
+            close_io_ring(&ring);
+    }
+#endif
+
+    pipeline->workers_write = !used_io_uring;
+
+    if (pipeline->options.index_path)
+    {
+        pipeline->shards = new Search_Index_Shard[pipeline->options.worker_count];
+        for (u32 i = 0; i < pipeline->options.worker_count; i++)
+            init_search_index_shard(&pipeline->shards[i]);
+    }
+
+    std::thread* workers = new std::thread[pipeline->options.worker_count];
+    for (u32 i = 0; i < pipeline->options.worker_count; i++)
+        workers[i] = std::thread(run_worker, pipeline, i);
+
+#ifdef __linux__
+    if (used_io_uring)
+    {
+        ring_busy = !run_io_uring(pipeline, &ring);
+        close_io_ring(&ring);
+    }
+#endif
+
+    if (!used_io_uring)
+        run_blocking_io(pipeline, reader_count);
+
+    // Every worker gets one more post, to find the queue empty on.
+    pipeline->reading_done.store(true, std::memory_order_release);
+    post(&pipeline->documents_read, pipeline->options.worker_count);
+
+    for (u32 i = 0; i < pipeline->options.worker_count; i++)
+        workers[i].join();
+    delete[] workers;
+
+    // What the workers handed back after the I/O thread stopped early.
+    while (Pipeline_Document* document = (Pipeline_Document*) pop(&pipeline->parsed_documents))
+        finish_document(pipeline, document);
+
+#ifdef __linux__
+    if (used_io_uring)
+        close(pipeline->wake_event);
+#endif
+
+    bool index_written = false;
+    if (pipeline->shards)
+    {
+        // Failed jobs are in the index too, without any terms, so document numbers stay job numbers.
+        LK_Region_Cursor cursor;
+        lk_region_cursor(temp, &cursor);
+
+        String* document_paths = LK_RegionArray(temp, String, job_count);
+        if (document_paths || !job_count)
+        {
+            for (umm i = 0; i < job_count; i++)
+                document_paths[i] = jobs[i].input_path;
+            index_written = write_search_index(pipeline->options.index_path, pipeline->shards, pipeline->options.worker_count, document_paths, (u32) job_count);
+        }
+
+        lk_region_rewind(temp, &cursor);
+        for (u32 i = 0; i < pipeline->options.worker_count; i++)
+            free_search_index_shard(&pipeline->shards[i]);
+        delete[] pipeline->shards;
+    }
+
+    ZeroStruct(stats);
+    stats->converted = pipeline->converted.load();
+    stats->failed = job_count - stats->converted;
+    stats->bytes_read = pipeline->bytes_read.load();
+    stats->bytes_written = pipeline->bytes_written.load();
+    stats->used_io_uring = used_io_uring;
+    stats->index_written = index_written;
+    stats->seconds = std::chrono::duration<f64>(std::chrono::steady_clock::now() - start).count();
+    return stats->failed == 0;
+}
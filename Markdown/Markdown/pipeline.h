@@ -0,0 +1,53 @@
+#pragma once
+
+#include "typedef.h"
+#include "string.h"
+#include "utf8.h"
+#include "parser.h"
+#include "page_template.h"
+
+
+
+//
+// Bulk conversion.
+// Many documents are read, parsed and written at the same time: one thread
+// does the reads and writes, worker threads do the parsing, and a bounded
+// number of documents is in flight between them.
+// With an index path every worker also indexes what it parses, into its own
+// shard, and the shards are merged into one file once the workers are done.
+// On Linux the I/O goes through io_uring. Without it, or where the kernel
+// doesn't allow it, a pool of threads does blocking reads instead.
+//
+
+
+struct Pipeline_Job
+{
+    String input_path;
+    String output_path;
+    bool converted;          // Set by run_pipeline.
+};
+
+struct Pipeline_Options
+{
+    u32 worker_count;        // Parsing threads, 0 for one per core.
+    u32 max_in_flight;       // Documents read but not written yet, 0 for 4 per worker.
+    bool allow_io_uring;
+    UTF8_Policy utf8_policy;
+    Parse_Options parse_options;
+    String index_path;       // Also writes a search index of every job here, see search_index.h.
+    Page_Template* page_template;  // Every document is written into it, NULL for the bare HTML.
+};
+
+struct Pipeline_Stats
+{
+    umm converted;
+    umm failed;
+    umm bytes_read;
+    umm bytes_written;
+    f64 seconds;
+    bool used_io_uring;
+    bool index_written;      // False without index_path, or if writing it failed.
+};
+
+// Returns false if any job failed, see Pipeline_Job::converted.
+bool run_pipeline(Pipeline_Job* jobs, umm job_count, Pipeline_Options* options, Pipeline_Stats* stats);
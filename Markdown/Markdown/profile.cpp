@@ -0,0 +1,188 @@
+#pragma once
+
+#include "profile.h"
+
+#if MARKDOWN_PROFILE
+
+#include <stdio.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+#include "typedef.h"
+#include "string.h"
+
+
+static constexpr umm PROFILE_HISTOGRAM_BUCKETS = 32;  // Powers of two of microseconds.
+static constexpr umm PROFILE_SLOWEST_COUNT = 10;
+
+static const char* profile_phase_names[PROFILE_PHASE_COUNT] =
+{
+    "read",
+    "line scanning",
+    "block classification",
+    "output",
+    "write",
+};
+
+bool profile_enabled = false;
+
+// Scopes add to their own thread's totals, which are added to the shared ones
+// once per document, so threads don't fight over cache lines for every line.
+static thread_local u64 thread_phase_ticks[PROFILE_PHASE_COUNT];
+static thread_local u64 thread_phase_calls[PROFILE_PHASE_COUNT];
+static thread_local u64 thread_document_start;
+
+static std::atomic<u64> phase_ticks[PROFILE_PHASE_COUNT];
+static std::atomic<u64> phase_calls[PROFILE_PHASE_COUNT];
+static std::atomic<u64> document_count;
+static std::atomic<u64> document_ticks;
+static std::atomic<u64> latency_histogram[PROFILE_HISTOGRAM_BUCKETS];
+
+struct Slow_Document
+{
+    String name;
+    u64 ticks;
+};
+
+static std::mutex slowest_mutex;
+static Slow_Document slowest[PROFILE_SLOWEST_COUNT];
+
+// The report goes to stderr, stdout may be the HTML.
+// Ticks are converted to time by comparing against the steady clock over the whole run.
+static u64 start_ticks;
+static std::chrono::steady_clock::time_point start_time;
+
+
+static f64 get_seconds_per_tick()
+{
+    f64 seconds = std::chrono::duration<f64>(std::chrono::steady_clock::now() - start_time).count();
+    u64 ticks = read_profile_clock() - start_ticks;
+    return ticks ? seconds / (f64) ticks : 0;
+}
+
+
+bool start_profiling()
+{
+    start_ticks = read_profile_clock();
+    start_time = std::chrono::steady_clock::now();
+    profile_enabled = true;
+    return true;
+}
+
+void add_profile_ticks(Profile_Phase phase, u64 ticks)
+{
+    thread_phase_ticks[phase] += ticks;
+    thread_phase_calls[phase]++;
+}
+
+void profile_flush_thread()
+{
+    for (umm i = 0; i < PROFILE_PHASE_COUNT; i++)
+    {
+        if (!thread_phase_calls[i])
+            continue;
+        phase_ticks[i].fetch_add(thread_phase_ticks[i], std::memory_order_relaxed);
+        phase_calls[i].fetch_add(thread_phase_calls[i], std::memory_order_relaxed);
+        thread_phase_ticks[i] = 0;
+        thread_phase_calls[i] = 0;
+    }
+}
+
+void profile_begin_document()
+{
+    if (profile_enabled)
+        thread_document_start = read_profile_clock();
+}
+
+void profile_end_document(String name)
+{
+    if (!profile_enabled)
+        return;
+
+    u64 ticks = read_profile_clock() - thread_document_start;
+    profile_flush_thread();
+    document_count.fetch_add(1, std::memory_order_relaxed);
+    document_ticks.fetch_add(ticks, std::memory_order_relaxed);
+
+    // The tick rate is estimated so far into the run, that's plenty for a power of two.
+    f64 microseconds = (f64) ticks * get_seconds_per_tick() * 1e6;
+    umm bucket = 0;
+    while (bucket + 1 < PROFILE_HISTOGRAM_BUCKETS && microseconds >= (f64)((u64) 1 << (bucket + 1)))
+        bucket++;
+    latency_histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(slowest_mutex);
+    umm slot = PROFILE_SLOWEST_COUNT;
+    while (slot > 0 && slowest[slot - 1].ticks < ticks)
+        slot--;
+    if (slot == PROFILE_SLOWEST_COUNT)
+        return;
+
+    for (umm i = PROFILE_SLOWEST_COUNT - 1; i > slot; i--)
+        slowest[i] = slowest[i - 1];
+    slowest[slot] = { name, ticks };
+}
+
+
+static f64 to_milliseconds(u64 ticks, f64 seconds_per_tick)
+{
+    return (f64) ticks * seconds_per_tick * 1e3;
+}
+
+void print_profile_report()
+{
+    if (!profile_enabled)
+        return;
+    profile_flush_thread();
+
+    f64 seconds_per_tick = get_seconds_per_tick();
+    u64 documents = document_count.load();
+
+    u64 total_phase_ticks = 0;
+    for (umm i = 0; i < PROFILE_PHASE_COUNT; i++)
+        total_phase_ticks += phase_ticks[i].load();
+
+    fprintf(stderr, "\nProfile, %llu documents, %.3f ms spent on them\n",
+        (unsigned long long) documents, to_milliseconds(document_ticks.load(), seconds_per_tick));
+    fprintf(stderr, "  %-24s %12s %8s %12s\n", "phase", "ms", "share", "calls");
+    for (umm i = 0; i < PROFILE_PHASE_COUNT; i++)
+    {
+        u64 ticks = phase_ticks[i].load();
+        f64 share = total_phase_ticks ? 100.0 * (f64) ticks / (f64) total_phase_ticks : 0;
+        fprintf(stderr, "  %-24s %12.3f %7.1f%% %12llu\n", profile_phase_names[i],
+            to_milliseconds(ticks, seconds_per_tick), share, (unsigned long long) phase_calls[i].load());
+    }
+
+    if (!documents)
+        return;
+
+    fprintf(stderr, "\n  document latency\n");
+    u64 largest_bucket = 0;
+    for (umm i = 0; i < PROFILE_HISTOGRAM_BUCKETS; i++)
+        if (latency_histogram[i].load() > largest_bucket)
+            largest_bucket = latency_histogram[i].load();
+
+    for (umm i = 0; i < PROFILE_HISTOGRAM_BUCKETS; i++)
+    {
+        u64 count = latency_histogram[i].load();
+        if (!count)
+            continue;
+
+        char bar[41] = {};
+        umm bar_length = (umm)((count * 40 + largest_bucket - 1) / largest_bucket);
+        for (umm j = 0; j < bar_length; j++)
+            bar[j] = '#';
+        fprintf(stderr, "  %10llu us .. %10llu us %8llu %s\n", (unsigned long long)(i ? (u64) 1 << i : 0),
+            (unsigned long long)((u64) 1 << (i + 1)), (unsigned long long) count, bar);
+    }
+
+    if (documents < 2)
+        return;
+
+    fprintf(stderr, "\n  slowest documents\n");
+    for (umm i = 0; i < PROFILE_SLOWEST_COUNT && slowest[i].ticks; i++)
+        fprintf(stderr, "  %12.3f ms  %.*s\n", to_milliseconds(slowest[i].ticks, seconds_per_tick), StringArgs(slowest[i].name));
+}
+
+#endif
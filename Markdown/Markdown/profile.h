@@ -0,0 +1,83 @@
+#pragma once
+
+#include "typedef.h"
+#include "macros.h"
+#include "string.h"
+
+
+
+//
+// Profiling.
+// Scoped timers around the phases of a conversion, and the latency of every
+// document. All of it is compiled out unless MARKDOWN_PROFILE is defined to 1,
+// and even then nothing is measured until --profile calls start_profiling.
+//
+
+
+#ifndef MARKDOWN_PROFILE
+#define MARKDOWN_PROFILE 0
+#endif
+
+enum Profile_Phase
+{
+    PROFILE_READ,            // read_entire_file
+    PROFILE_LINE_SCAN,       // consume_line_preserve_whitespace in the parse loop.
+    PROFILE_CLASSIFY,        // new_section_begin, try_add_list_element and the other block checks.
+    PROFILE_OUTPUT,          // Tokens going through the sinks.
+    PROFILE_WRITE,           // write_entire_file
+    PROFILE_PHASE_COUNT,
+};
+
+
+#if MARKDOWN_PROFILE
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+extern bool profile_enabled;
+
+// Cycles where there's a time stamp counter, nanoseconds otherwise.
+inline u64 read_profile_clock()
+{
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return (u64) std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+void add_profile_ticks(Profile_Phase phase, u64 ticks);
+
+struct Profile_Scope
+{
+    Profile_Phase phase;
+    u64 start;
+
+    Profile_Scope(Profile_Phase phase): phase(phase), start(profile_enabled ? read_profile_clock() : 0) {}
+    ~Profile_Scope() { if (profile_enabled) add_profile_ticks(phase, read_profile_clock() - start); }
+};
+
+#define ProfileScope(phase) Profile_Scope Concatenate(_profile_, __COUNTER__)(phase)
+
+bool start_profiling();
+void profile_begin_document();
+void profile_end_document(String name);  // 'name' has to outlive the report.
+void profile_flush_thread();             // Before a thread that was measured exits.
+void print_profile_report();            // To stderr.
+
+#else
+
+#define ProfileScope(phase)
+
+inline bool start_profiling() { return false; }
+inline void profile_begin_document() {}
+inline void profile_end_document(String name) {}
+inline void profile_flush_thread() {}
+inline void print_profile_report() {}
+
+#endif
@@ -0,0 +1,570 @@
+#pragma once
+
+#include <stdlib.h>
+#include <cstring>
+
+#include "typedef.h"
+#include "macros.h"
+#include "memory.h"
+#include "string.h"
+#include "list.h"
+#include "hash_table.h"
+#include "html_entities.h"
+#include "file_io.h"
+#include "parser.h"
+#include "search_index.h"
+
+
+static constexpr umm SEARCH_HEADER_SIZE   = 32;
+static constexpr umm SEARCH_DOCUMENT_SIZE = 12;
+static constexpr umm SEARCH_TERM_SIZE     = 16;
+static constexpr umm SEARCH_POSTING_SIZE  = 8;
+
+
+
+//
+// Shards.
+//
+
+
+void init_search_index_shard(Search_Index_Shard* shard)
+{
+    *shard = Search_Index_Shard();
+}
+
+void free_search_index_shard(Search_Index_Shard* shard)
+{
+    lk_region_free(&shard->memory);
+    *shard = Search_Index_Shard();
+}
+
+
+
+//
+// Tokenizing.
+// The common case is one table lookup and a store per byte. Terms are hashed
+// once they're complete, 8 bytes at a time, both maps are only ever given this hash.
+//
+
+
+struct Term_Byte_Table
+{
+    u8 folded[256];  // The byte as it goes into a term, or 0 if it separates terms.
+
+    constexpr Term_Byte_Table() : folded()
+    {
+        for (u32 c = '0'; c <= '9'; c++) folded[c] = (u8) c;
+        for (u32 c = 'a'; c <= 'z'; c++) folded[c] = (u8) c;
+        for (u32 c = 'A'; c <= 'Z'; c++) folded[c] = (u8)(c | 0x20);
+        for (u32 c = 0x80; c <= 0xFF; c++) folded[c] = (u8) c;
+    }
+};
+
+static constexpr Term_Byte_Table term_bytes;
+
+// The term buffer has room past SEARCH_TERM_MAX_LENGTH, and is zeroed after the term,
+// so the last chunk can be read whole.
+static u32 hash_term(const u8* term, u32 length)
+{
+    u64 hash = 0x9E3779B97F4A7C15ull ^ length;
+    for (u32 i = 0; i < length; i += 8)
+    {
+        u64 chunk;
+        memcpy(&chunk, term + i, 8);
+        hash = (hash ^ chunk) * 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 32;
+    }
+    return (u32) hash;
+}
+
+static void end_term(Index_Token_Sink* index)
+{
+    if (!index->term_too_long)
+    {
+        u64 zero = 0;
+        memcpy(index->term + index->term_length, &zero, 8);
+
+        String term = { index->term_length, index->term };
+        u32 hash = hash_term(index->term, index->term_length);
+        u32* frequency = index->terms.find(term, hash);
+        if (frequency)
+        {
+            (*frequency)++;
+        }
+        else
+        {
+            // The key has to outlive the buffer, it's copied once per distinct term.
+            u8* key = LK_RegionArray(temp, u8, term.length);
+            if (key)
+            {
+                copy(key, term.data, term.length);
+                index->terms.insert({ term.length, key }, hash, 1);
+            }
+        }
+        index->term_total++;
+    }
+
+    index->term_length = 0;
+    index->term_too_long = false;
+}
+
+static void add_term_bytes(Index_Token_Sink* index, String text)
+{
+    for (umm i = 0; i < text.length; i++)
+    {
+        u8 c = term_bytes.folded[text.data[i]];
+        if (!c)
+        {
+            if (index->term_length)
+                end_term(index);
+        }
+        else if (index->term_length < SEARCH_TERM_MAX_LENGTH)
+        {
+            index->term[index->term_length++] = c;
+        }
+        else
+        {
+            index->term_too_long = true;
+        }
+    }
+}
+
+
+static bool is_ascii_letter(u8 c)
+{
+    return (u8)((c | 0x20) - 'a') < 26;
+}
+
+// Inline HTML goes through as text, but its tag and attribute names aren't words of the document.
+// Returns the length of the tag at the start of 'text', "<name ...>", "</name>" or "<!...>",
+// or 0 if it isn't one. Autolinks like <https://example.com> aren't tags, the name ends at a ':'.
+// A tag without its '>' goes on into the next line, which is the next text token.
+static umm match_inline_tag(String text, bool* closed)
+{
+    umm i = 1;
+    if (i < text.length && text.data[i] == '!')
+    {
+        i++;
+    }
+    else
+    {
+        if (i < text.length && text.data[i] == '/')
+            i++;
+        if (i >= text.length || !is_ascii_letter(text.data[i]))
+            return 0;
+        while (i < text.length && (is_ascii_letter(text.data[i]) || is_decimal_digit(text.data[i]) || text.data[i] == '-'))
+            i++;
+        if (i < text.length && !is_whitespace(text.data[i]) && text.data[i] != '/' && text.data[i] != '>')
+            return 0;
+    }
+
+    const u8* end = (const u8*) memchr(text.data + i, '>', text.length - i);
+    *closed = end != NULL;
+    return end ? (umm)(end - text.data) + 1 : text.length;
+}
+
+// Text between the tags, with references decoded like the text format writes it.
+static void add_text_terms(Index_Token_Sink* index, String text)
+{
+    if (index->in_tag)
+    {
+        const u8* end = (const u8*) memchr(text.data, '>', text.length);
+        if (!end)
+            return;
+        consume(&text, (umm)(end - text.data) + 1);
+        index->in_tag = false;
+    }
+
+    umm from = 0;
+    while (text)
+    {
+        const u8* open = (const u8*) memchr(text.data + from, '<', text.length - from);
+        umm text_length = open ? (umm)(open - text.data) : text.length;
+        bool closed = true;
+        umm tag_length = open ? match_inline_tag(substring(text, text_length, text.length - text_length), &closed) : 0;
+        if (open && !tag_length)
+        {
+            from = text_length + 1;
+            continue;
+        }
+
+        String run = substring(text, 0, text_length);
+        u8 utf8[CHARACTER_REFERENCE_MAX_UTF8];
+        String piece;
+        bool decoded;
+        while (consume_text_piece(&run, utf8, &piece, &decoded))
+            add_term_bytes(index, piece);
+
+        // A tag separates terms.
+        if (index->term_length)
+            end_term(index);
+        consume(&text, text_length + tag_length);
+        index->in_tag = !closed;
+        from = 0;
+    }
+}
+
+//
+// Token sink.
+//
+
+
+static void index_sink_begin(Token_Sink* sink, Parse_Result* result) {}
+
+static void index_sink_token(Token_Sink* sink, Labeled_String token)
+{
+    Index_Token_Sink* index = (Index_Token_Sink*) sink;
+
+    // Only the lines of one paragraph can share a tag.
+    if (token.type != ST_TEXT)
+        index->in_tag = false;
+
+    switch (token.type)
+    {
+    case ST_TEXT:
+    case ST_TABLE_CELL:
+    {
+        // Same pieces the text format writes, references decoded and escaped pipes unescaped.
+        String text = token.value;
+        while (text)
+        {
+            String run = text;
+            if (token.type == ST_TABLE_CELL)
+                run = consume_table_cell_run(&text);
+            else
+                text = {};
+
+            add_text_terms(index, run);
+        }
+    } break;
+
+    case ST_CODE:
+    case ST_CODE_INDENTED:
+    {
+        add_term_bytes(index, token.value);
+    } break;
+
+    default: break;
+    }
+
+    // Terms never go from one token into the next.
+    if (index->term_length)
+        end_term(index);
+}
+
+static void index_sink_end(Token_Sink* sink)
+{
+    Index_Token_Sink* index = (Index_Token_Sink*) sink;
+    Search_Index_Shard* shard = index->shard;
+
+    // Everything added here has to last until the merge, not just until the document is done.
+    LK_Region* previous_temp = temp;
+    temp = &shard->memory;
+
+    for (umm i = 0; i < index->terms.capacity; i++)
+    {
+        if (!index->terms.slots[i].occupied)
+            continue;
+
+        String text = index->terms.slots[i].key;
+        u32 hash = index->terms.slots[i].hash;
+        Search_Index_Term** existing = shard->terms.find(text, hash);
+        Search_Index_Term* term = existing ? *existing : NULL;
+        if (!term)
+        {
+            term = LK_RegionValue(temp, Search_Index_Term);
+            u8* text_copy = LK_RegionArray(temp, u8, text.length);
+            if (!term || !text_copy)
+                break;
+
+            *term = Search_Index_Term();
+            copy(text_copy, text.data, text.length);
+            term->text = { text.length, text_copy };
+            if (!shard->terms.insert(term->text, hash, term))
+                break;
+        }
+
+        term->postings.append({ index->document, index->terms.slots[i].value });
+        shard->posting_count++;
+    }
+
+    shard->documents.append({ index->document, index->term_total });
+    temp = previous_temp;
+}
+
+void init_index_token_sink(Index_Token_Sink* sink, Search_Index_Shard* shard, u32 document)
+{
+    *sink = Index_Token_Sink();
+    sink->sink.begin = index_sink_begin;
+    sink->sink.token = index_sink_token;
+    sink->sink.end   = index_sink_end;
+    sink->sink.output = NULL;
+    sink->shard = shard;
+    sink->document = document;
+}
+
+
+
+//
+// Merging and writing.
+// Every shard's terms are sorted together, so equal terms from different
+// shards end up next to each other and become one entry of the term table.
+//
+
+
+static int compare_bytes(String a, String b)
+{
+    umm length = a.length < b.length ? a.length : b.length;
+    int result = length ? memcmp(a.data, b.data, length) : 0;
+    if (result)
+        return result;
+    return (a.length > b.length) - (a.length < b.length);
+}
+
+static int compare_terms(const void* a, const void* b)
+{
+    return compare_bytes((*(Search_Index_Term**) a)->text, (*(Search_Index_Term**) b)->text);
+}
+
+static int compare_postings(const void* a, const void* b)
+{
+    u32 first = ((Search_Posting*) a)->document;
+    u32 second = ((Search_Posting*) b)->document;
+    return (first > second) - (first < second);
+}
+
+
+bool write_search_index(String path, Search_Index_Shard* shards, umm shard_count, String* document_paths, u32 document_count)
+{
+    umm entry_count = 0;
+    umm posting_count = 0;
+    for (umm i = 0; i < shard_count; i++)
+    {
+        entry_count += shards[i].terms.count;
+        posting_count += shards[i].posting_count;
+    }
+    DebugAssert(posting_count <= U32_MAX);
+
+    Search_Index_Term** entries = LK_RegionArray(temp, Search_Index_Term*, entry_count);
+    Search_Posting* postings = LK_RegionArray(temp, Search_Posting, posting_count);
+    u32* term_totals = LK_RegionArray(temp, u32, document_count);
+    if ((entry_count && !entries) || (posting_count && !postings) || (document_count && !term_totals))
+        return false;
+
+    umm entry = 0;
+    for (umm i = 0; i < shard_count; i++)
+    {
+        String_Map<Search_Index_Term*>* terms = &shards[i].terms;
+        for (umm slot = 0; slot < terms->capacity; slot++)
+            if (terms->slots[slot].occupied)
+                entries[entry++] = terms->slots[slot].value;
+    }
+    qsort(entries, entry_count, sizeof(entries[0]), compare_terms);
+
+    for (u32 i = 0; i < document_count; i++)
+        term_totals[i] = 0;
+    for (umm i = 0; i < shard_count; i++)
+        for (auto* node = shards[i].documents.head; node != NULL; node = node->next)
+            if (node->value.document < document_count)
+                term_totals[node->value.document] = node->value.term_total;
+
+    // Sizes first, the whole file is one allocation.
+    u32 term_count = 0;
+    umm pool_length = 0;
+    for (u32 i = 0; i < document_count; i++)
+        pool_length += document_paths[i].length;
+    for (umm i = 0; i < entry_count; i++)
+    {
+        if (i && entries[i]->text == entries[i - 1]->text)
+            continue;
+        term_count++;
+        pool_length += entries[i]->text.length;
+    }
+    DebugAssert(pool_length <= U32_MAX);
+
+    umm documents_size = (umm) document_count * SEARCH_DOCUMENT_SIZE;
+    umm terms_size     = (umm) term_count * SEARCH_TERM_SIZE;
+    umm postings_size  = posting_count * SEARCH_POSTING_SIZE;
+
+    String data;
+    data.length = SEARCH_HEADER_SIZE + documents_size + terms_size + postings_size + pool_length;
+    data.data = LK_RegionArray(temp, u8, data.length);
+    if (!data.data)
+        return false;
+
+    String header = substring(data, 0, SEARCH_HEADER_SIZE);
+    write_u32le(&header, SEARCH_INDEX_MAGIC);
+    write_u32le(&header, SEARCH_INDEX_VERSION);
+    write_u32le(&header, document_count);
+    write_u32le(&header, term_count);
+    write_u32le(&header, (u32) posting_count);
+    write_u32le(&header, (u32) pool_length);
+    write_u32le(&header, 0);
+    write_u32le(&header, 0);
+
+    String document_table = substring(data, SEARCH_HEADER_SIZE, documents_size);
+    String term_table     = substring(data, SEARCH_HEADER_SIZE + documents_size, terms_size);
+    String posting_table  = substring(data, SEARCH_HEADER_SIZE + documents_size + terms_size, postings_size);
+    String pool           = substring(data, SEARCH_HEADER_SIZE + documents_size + terms_size + postings_size, pool_length);
+    umm pool_offset = 0;
+
+    for (u32 i = 0; i < document_count; i++)
+    {
+        write_u32le(&document_table, (u32) pool_offset);
+        write_u32le(&document_table, (u32) document_paths[i].length);
+        write_u32le(&document_table, term_totals[i]);
+        write_bytes(&pool, document_paths[i].data, document_paths[i].length);
+        pool_offset += document_paths[i].length;
+    }
+
+    umm posting = 0;
+    for (umm first = 0; first < entry_count;)
+    {
+        String text = entries[first]->text;
+        umm first_posting = posting;
+        bool sorted = true;
+
+        umm end = first;
+        for (; end < entry_count && entries[end]->text == text; end++)
+        {
+            for (auto* node = entries[end]->postings.head; node != NULL; node = node->next)
+            {
+                if (posting > first_posting && postings[posting - 1].document > node->value.document)
+                    sorted = false;
+                postings[posting++] = node->value;
+            }
+        }
+
+        // A shard has its documents in order, more than one shard usually doesn't.
+        if (!sorted)
+            qsort(postings + first_posting, posting - first_posting, sizeof(postings[0]), compare_postings);
+
+        write_u32le(&term_table, (u32) pool_offset);
+        write_u32le(&term_table, (u32) text.length);
+        write_u32le(&term_table, (u32) first_posting);
+        write_u32le(&term_table, (u32)(posting - first_posting));
+        write_bytes(&pool, text.data, text.length);
+        pool_offset += text.length;
+
+        first = end;
+    }
+
+    for (umm i = 0; i < posting; i++)
+    {
+        write_u32le(&posting_table, postings[i].document);
+        write_u32le(&posting_table, postings[i].frequency);
+    }
+
+    DebugAssert(!document_table && !term_table && !posting_table && !pool);
+    return write_entire_file(path, data);
+}
+
+
+
+//
+// Reading.
+//
+
+
+bool open_search_index(Search_Index* index, String data)
+{
+    ZeroStruct(index);
+
+    u32 magic, version, document_count, term_count, posting_count, pool_length, unused;
+
+    String header = data;
+    if (!read_u32le(&header, &magic))          return false;
+    if (!read_u32le(&header, &version))        return false;
+    if (!read_u32le(&header, &document_count)) return false;
+    if (!read_u32le(&header, &term_count))     return false;
+    if (!read_u32le(&header, &posting_count))  return false;
+    if (!read_u32le(&header, &pool_length))    return false;
+    if (!read_u32le(&header, &unused))         return false;
+    if (!read_u32le(&header, &unused))         return false;
+
+    if (magic != SEARCH_INDEX_MAGIC)     return false;
+    if (version != SEARCH_INDEX_VERSION) return false;
+
+    umm documents_size = (umm) document_count * SEARCH_DOCUMENT_SIZE;
+    umm terms_size     = (umm) term_count * SEARCH_TERM_SIZE;
+    umm postings_size  = (umm) posting_count * SEARCH_POSTING_SIZE;
+    if (data.length != SEARCH_HEADER_SIZE + documents_size + terms_size + postings_size + pool_length)
+        return false;
+
+    index->documents = substring(data, SEARCH_HEADER_SIZE, documents_size);
+    index->terms     = substring(data, SEARCH_HEADER_SIZE + documents_size, terms_size);
+    index->postings  = substring(data, SEARCH_HEADER_SIZE + documents_size + terms_size, postings_size);
+    index->pool      = substring(data, SEARCH_HEADER_SIZE + documents_size + terms_size + postings_size, pool_length);
+    index->document_count = document_count;
+    index->term_count     = term_count;
+    index->posting_count  = posting_count;
+    return true;
+}
+
+static bool read_pool_string(Search_Index* index, String* table, String* string)
+{
+    u32 offset, length;
+    if (!read_u32le(table, &offset)) return false;
+    if (!read_u32le(table, &length)) return false;
+    if ((umm) offset + length > index->pool.length)
+        return false;
+
+    *string = substring(index->pool, offset, length);
+    return true;
+}
+
+// Binary search, the term table is sorted.
+bool find_search_term(Search_Index* index, String term, String* postings)
+{
+    u32 low = 0;
+    u32 high = index->term_count;
+    while (low < high)
+    {
+        u32 middle = low + (high - low) / 2;
+        String entry = substring(index->terms, (umm) middle * SEARCH_TERM_SIZE, SEARCH_TERM_SIZE);
+
+        String text;
+        if (!read_pool_string(index, &entry, &text))
+            return false;
+
+        int order = compare_bytes(text, term);
+        if (order < 0)
+        {
+            low = middle + 1;
+        }
+        else if (order > 0)
+        {
+            high = middle;
+        }
+        else
+        {
+            u32 first_posting, posting_count;
+            if (!read_u32le(&entry, &first_posting)) return false;
+            if (!read_u32le(&entry, &posting_count)) return false;
+            if ((umm) first_posting + posting_count > index->posting_count)
+                return false;
+
+            *postings = substring(index->postings, (umm) first_posting * SEARCH_POSTING_SIZE, (umm) posting_count * SEARCH_POSTING_SIZE);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool next_search_posting(String* postings, Search_Posting* posting)
+{
+    if (!read_u32le(postings, &posting->document))  return false;
+    if (!read_u32le(postings, &posting->frequency)) return false;
+    return true;
+}
+
+bool get_search_document(Search_Index* index, u32 document, String* path, u32* term_total)
+{
+    if (document >= index->document_count)
+        return false;
+
+    String entry = substring(index->documents, (umm) document * SEARCH_DOCUMENT_SIZE, SEARCH_DOCUMENT_SIZE);
+    if (!read_pool_string(index, &entry, path))
+        return false;
+    return read_u32le(&entry, term_total);
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "typedef.h"
+#include "memory.h"
+#include "string.h"
+#include "list.h"
+#include "hash_table.h"
+#include "parser.h"
+
+
+
+//
+// Full-text search index.
+// An Index_Token_Sink is fed the same tokens as the HTML, so a document is
+// indexed in the same traversal that converts it. Each sink counts its
+// document's terms in a map in the temp region, and adds them to a shard at
+// the end. Every thread has its own shard, and write_search_index merges
+// them all into one inverted index file once the batch is done.
+//
+// Terms are runs of ASCII letters and digits and of non-ASCII bytes, with
+// ASCII lowercased. Anything else separates them, there's no stemming and no
+// Unicode case folding. Text and code are both indexed, tags and front matter aren't,
+// and neither is inline HTML written in the text, like <span class="note">.
+//
+// The file is made to be used in place, straight from a memory mapped file.
+// Everything is little endian.
+//
+//     header               32 bytes
+//         u32 magic            "MDIX"
+//         u32 version          SEARCH_INDEX_VERSION
+//         u32 document_count
+//         u32 term_count
+//         u32 posting_count
+//         u32 pool_length
+//         u32 unused           0
+//         u32 unused           0
+//     document table       document_count * 12 bytes
+//         u32 path_offset      into the string pool
+//         u32 path_length
+//         u32 term_total       terms in the document, repeats included, 0 if it failed
+//     term table           term_count * 16 bytes, sorted by the bytes of the term
+//         u32 text_offset      into the string pool
+//         u32 text_length
+//         u32 first_posting
+//         u32 posting_count
+//     posting table        posting_count * 8 bytes, grouped by term, by document within a term
+//         u32 document         index into the document table
+//         u32 frequency        times the term is in the document
+//     string pool          pool_length bytes
+//
+
+
+constexpr u32 SEARCH_INDEX_MAGIC   = 'M' | ('D' << 8) | ('I' << 16) | ('X' << 24);
+constexpr u32 SEARCH_INDEX_VERSION = 1;
+
+// Longer runs are left out of the index, they're mostly hashes and base64.
+constexpr u32 SEARCH_TERM_MAX_LENGTH = 64;
+
+
+struct Search_Posting
+{
+    u32 document;
+    u32 frequency;
+};
+
+struct Search_Index_Term
+{
+    String text;                      // In the shard's memory.
+    SLList<Search_Posting> postings;  // Nodes in the shard's memory too.
+};
+
+struct Search_Index_Document
+{
+    u32 document;
+    u32 term_total;
+};
+
+// Everything one thread indexed. Only ever touched by that thread until the merge.
+struct Search_Index_Shard
+{
+    LK_Region memory;
+    String_Map<Search_Index_Term*> terms;
+    SLList<Search_Index_Document> documents;
+    umm posting_count;
+};
+
+void init_search_index_shard(Search_Index_Shard* shard);
+void free_search_index_shard(Search_Index_Shard* shard);
+
+
+struct Index_Token_Sink
+{
+    Token_Sink sink;
+    Search_Index_Shard* shard;
+    u32 document;
+    u32 term_total;
+    String_Map<u32> terms;            // Term -> frequency, in the temp region.
+
+    u8 term[SEARCH_TERM_MAX_LENGTH + 8];  // The term being read, it can span pieces of decoded text.
+    u32 term_length;
+    bool term_too_long;
+    bool in_tag;                      // Inline HTML from an earlier line isn't over yet.
+};
+
+// 'document' is the index of the document in the list given to write_search_index.
+// The document goes into the shard when the sink's end() is called, so a parse
+// that fails leaves the shard as it was.
+void init_index_token_sink(Index_Token_Sink* sink, Search_Index_Shard* shard, u32 document);
+
+// Merges the shards into one index of 'document_count' documents and writes it to 'path'.
+// The shards are left as they were.
+bool write_search_index(String path, Search_Index_Shard* shards, umm shard_count, String* document_paths, u32 document_count);
+
+
+//
+// Reading.
+//
+
+struct Search_Index
+{
+    String documents;
+    String terms;
+    String postings;
+    String pool;
+
+    u32 document_count;
+    u32 term_count;
+    u32 posting_count;
+};
+
+// Checks the header and the table sizes.
+bool open_search_index(Search_Index* index, String data);
+
+// Looks the term up as it's written in the index, lowercased. Returns false if no
+// document has it. 'postings' is what next_search_posting reads from.
+bool find_search_term(Search_Index* index, String term, String* postings);
+bool next_search_posting(String* postings, Search_Posting* posting);
+
+// Returns false if the document or its path is out of range.
+bool get_search_document(Search_Index* index, u32 document, String* path, u32* term_total);
@@ -161,6 +161,8 @@ String allocate_string(Region* memory, String string)
     String result;
     result.length = string.length;
     result.data = LK_RegionArray(memory, u8, string.length);
+    if (!result.data)
+        return {};
 
     copy(result.data, string.data, string.length);
 
@@ -179,6 +181,8 @@ String concatenate(String first, String second, String third, String fourth, Str
     String result;
     result.length = first.length + second.length + third.length + fourth.length + fifth.length + sixth.length;
     result.data = LK_RegionArray(temp, u8, result.length);
+    if (!result.data)
+        return {};
 
     u8* write = result.data;
 
@@ -366,6 +370,18 @@ u32 compute_crc32(String data)
 }
 
 
+u32 hash_string(String string)
+{
+    u32 hash = 2166136261u;
+    for (umm i = 0; i < string.length; i++)
+    {
+        hash ^= string.data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+
 //
 //
 // Text reading utilities.
@@ -400,9 +416,34 @@ String consume_line(String* string)
     return line;
 }
 
+// Same as find_first_occurance_of_any(string, "\n\r"_s), but memchr finds the '\n',
+// and only the part before it is checked for a '\r', since lone '\r' endings are rare.
+// It looks a block at a time, so a file of '\r' endings isn't searched to the end for every line.
+static umm find_line_ending(String string)
+{
+    const umm block_size = 256;
+    for (umm start = 0; start < string.length; start += block_size)
+    {
+        const u8* block = string.data + start;
+        umm block_length = string.length - start;
+        if (block_length > block_size)
+            block_length = block_size;
+
+        const u8* newline = (const u8*) memchr(block, '\n', block_length);
+        umm before_newline = newline ? (umm)(newline - block) : block_length;
+        const u8* carriage_return = (const u8*) memchr(block, '\r', before_newline);
+        if (carriage_return)
+            return carriage_return - string.data;
+        if (newline)
+            return newline - string.data;
+    }
+
+    return NOT_FOUND;
+}
+
 String consume_line_preserve_whitespace(String* string)
 {
-    umm line_length = find_first_occurance_of_any(*string, "\n\r"_s);
+    umm line_length = find_line_ending(*string);
     if (line_length == NOT_FOUND)
         line_length = string->length;
 
@@ -430,7 +471,7 @@ String consume_line_preserve_whitespace(String* string)
 
 String peek_line_preserve_whitespace(String string)
 {
-    umm line_length = find_first_occurance_of_any(string, "\n\r"_s);
+    umm line_length = find_line_ending(string);
     if (line_length == NOT_FOUND)
         line_length = string.length;
 
@@ -555,7 +596,9 @@ bool read_i32(String* string, i32* result) { return read_bytes(string, result, 4
 bool read_i64(String* string, i64* result) { return read_bytes(string, result, 8); }
 
 
-#ifdef BIG_ENDIAN
+// glibc defines BIG_ENDIAN on every target, the compiler's byte order is what counts.
+// MSVC only targets little endian machines.
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
 #error "Go away, we don't like you!"
 #endif
 
@@ -576,6 +619,30 @@ bool read_i32be(String* string, i32* result) { Defer(*result = (i32) endian_swap
 bool read_i64be(String* string, i64* result) { Defer(*result = (i64) endian_swap64((u64) *result)); return read_bytes(string, result, 8); }
 
 
+//
+//
+// Binary writing utilities.
+//
+//
+
+
+bool write_bytes(String* string, const void* data, umm count)
+{
+    if (string->length < count)
+        return false;
+
+    copy(string->data, data, count);
+    consume(string, count);
+    return true;
+}
+
+
+bool write_u8   (String* string, u8  value) { return write_bytes(string, &value, 1); }
+bool write_u16le(String* string, u16 value) { return write_bytes(string, &value, 2); }
+bool write_u32le(String* string, u32 value) { return write_bytes(string, &value, 4); }
+bool write_u64le(String* string, u64 value) { return write_bytes(string, &value, 8); }
+
+
 //
 // File path utilities.
 //
@@ -636,7 +703,7 @@ static inline bool is_legal_code_point(u32 code_point)
 }
 
 
-static inline u32 get_utf8_sequence_length(u32 code_point)
+u32 get_utf8_sequence_length(u32 code_point)
 {
     if (code_point <      0x80) return 1;
     if (code_point <     0x800) return 2;
@@ -647,7 +714,7 @@ static inline u32 get_utf8_sequence_length(u32 code_point)
 }
 
 
-static void encode_utf8_sequence(u32 code_point, u8* target, u32 length)
+void encode_utf8_sequence(u32 code_point, u8* target, u32 length)
 {
     switch (length)
     {
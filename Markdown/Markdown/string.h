@@ -68,6 +68,7 @@ String make_string(const char* c_string);  // Allocates.
 char* make_c_style_string(String string);  // Allocates.
 String wrap_string(const char* c_string);
 
+// These return an empty string if the region has reached its byte limit.
 String allocate_string(Region* memory, String string);
 String clone_string(String string);  // Allocates.
 
@@ -98,6 +99,7 @@ umm find_last_occurance_of_any(String string, String any_of);
 void replace_all_occurances(String string, u8 what, u8 with_what);
 
 u32 compute_crc32(String data);
+u32 hash_string(String string);  // FNV-1a, for hash tables.
 
 
 //
@@ -153,6 +155,21 @@ bool read_s32be(String* string, i32* result);
 bool read_s64be(String* string, i64* result);
 
 
+//
+// Binary writing utilities.
+// These mirror the reading utilities: 'string' is the space left to write
+// to, and it is consumed as it is written.
+//
+
+
+bool write_bytes(String* string, const void* data, umm count);
+
+bool write_u8   (String* string, u8  value);
+bool write_u16le(String* string, u16 value);
+bool write_u32le(String* string, u32 value);
+bool write_u64le(String* string, u64 value);
+
+
 //
 // File path utilities.
 // Convention: directory paths *don't* end with a trailing slash.
@@ -193,6 +210,9 @@ String16 make_string16(const u16* c_string);    // Allocates. The returned strin
 String16 convert_utf8_to_utf16(String string);  // Allocates. The returned string is null terminated.
 String convert_utf16_to_utf8(String16 string);  // Allocates. The returned string is null terminated.
 
+u32 get_utf8_sequence_length(u32 code_point);
+void encode_utf8_sequence(u32 code_point, u8* target, u32 length);  // 'length' from get_utf8_sequence_length.
+
 
 //
 // String building utilities.
@@ -2,4 +2,17 @@
 #include "file_io.cpp"
 //#include "os_specific_windows.cpp"
 #include "string.cpp"
+#include "utf8.cpp"
+#include "html_entities.cpp"
+#include "output.cpp"
+#include "gzip_output.cpp"
+#include "background_output.cpp"
 #include "parser.cpp"
+#include "document_ir.cpp"
+#include "formats.cpp"
+#include "page_template.cpp"
+#include "search_index.cpp"
+#include "benchmark.cpp"
+#include "pipeline.cpp"
+#include "watch.cpp"
+#include "profile.cpp"
@@ -0,0 +1,502 @@
+#pragma once
+
+#include "typedef.h"
+#include "macros.h"
+#include "memory.h"
+#include "string.h"
+#include "utf8.h"
+
+#if !defined(UTF8_NO_SIMD) && (defined(__SSSE3__) || defined(__AVX__) || defined(__x86_64__) || defined(_M_X64) || defined(_M_AMD64))
+#define UTF8_SIMD 1
+#include <tmmintrin.h>
+#if defined(__AVX2__)
+#define UTF8_AVX2 1
+#include <immintrin.h>
+#endif
+
+// The validator needs SSSE3, x86-64 itself only guarantees SSE2 (the transcoder
+// only uses SSE2). Unless the compiler is told SSSE3 is there (-mssse3, -march=...
+// or /arch:AVX), the validator is compiled for SSSE3 on its own and only used if CPUID has it.
+#if defined(__SSSE3__) || defined(__AVX__)
+#define UTF8_SSSE3_TARGET
+#define UTF8_CHECK_SSSE3 0
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#define UTF8_SSSE3_TARGET
+#define UTF8_CHECK_SSSE3 1
+#else
+#define UTF8_SSSE3_TARGET __attribute__((target("ssse3")))
+#define UTF8_CHECK_SSSE3 1
+#endif
+#endif
+
+
+
+//
+// Scalar validation.
+// Used for the tail of the SIMD path, as a fallback when SIMD isn't available,
+// and for repairing invalid input.
+//
+
+
+// Returns the length of the well formed sequence at the start of 'data'.
+// If the sequence is ill formed, returns 0 and writes the length of its
+// maximal subpart (at least 1) to 'out_invalid_length'.
+static umm measure_utf8_sequence(const u8* data, umm length, umm* out_invalid_length)
+{
+    u8 lead = data[0];
+    if (lead < 0x80)
+        return 1;
+
+    // Second byte ranges are narrower than 80..BF for some lead bytes;
+    // this is what excludes overlongs, surrogates and values above U+10FFFF.
+    umm sequence_length;
+    u8 second_min = 0x80;
+    u8 second_max = 0xBF;
+
+         if (lead >= 0xC2 && lead <= 0xDF) { sequence_length = 2; }
+    else if (lead == 0xE0)                 { sequence_length = 3; second_min = 0xA0; }
+    else if (lead >= 0xE1 && lead <= 0xEC) { sequence_length = 3; }
+    else if (lead == 0xED)                 { sequence_length = 3; second_max = 0x9F; }
+    else if (lead >= 0xEE && lead <= 0xEF) { sequence_length = 3; }
+    else if (lead == 0xF0)                 { sequence_length = 4; second_min = 0x90; }
+    else if (lead >= 0xF1 && lead <= 0xF3) { sequence_length = 4; }
+    else if (lead == 0xF4)                 { sequence_length = 4; second_max = 0x8F; }
+    else
+    {
+        *out_invalid_length = 1;
+        return 0;
+    }
+
+    for (umm i = 1; i < sequence_length; i++)
+    {
+        u8 min = (i == 1) ? second_min : 0x80;
+        u8 max = (i == 1) ? second_max : 0xBF;
+        if (i >= length || data[i] < min || data[i] > max)
+        {
+            *out_invalid_length = i;
+            return 0;
+        }
+    }
+
+    return sequence_length;
+}
+
+
+static bool is_valid_utf8_scalar(const u8* data, umm length)
+{
+    umm i = 0;
+    while (i < length)
+    {
+        // ASCII fast path, 8 bytes at a time.
+        if (i + 8 <= length)
+        {
+            u64 word;
+            copy(&word, data + i, 8);
+            if (!(word & 0x8080808080808080ull))
+            {
+                i += 8;
+                continue;
+            }
+        }
+
+        umm invalid_length;
+        umm sequence_length = measure_utf8_sequence(data + i, length - i, &invalid_length);
+        if (!sequence_length)
+            return false;
+        i += sequence_length;
+    }
+
+    return true;
+}
+
+
+
+//
+// SIMD validation.
+// This is the lookup algorithm from Keiser & Lemire, "Validating UTF-8 In Less
+// Than One Instruction Per Byte". Every byte is classified by three 16 entry
+// tables, indexed by the high nibble of the previous byte, the low nibble of
+// the previous byte and the high nibble of the current byte. ANDing the three
+// lookups leaves a bit set only for byte pairs that can't appear in valid UTF-8.
+// The remaining errors (missing or extra continuation bytes after 3 and 4 byte
+// leads) are found by comparing against the bytes 2 and 3 positions back.
+//
+
+
+#ifdef UTF8_SIMD
+
+enum
+{
+    UTF8_TOO_SHORT  = 1 << 0,  // 11______ 0_______  or  11______ 11______
+    UTF8_TOO_LONG   = 1 << 1,  // 0_______ 10______
+    UTF8_OVERLONG_3 = 1 << 2,  // 11100000 100_____
+    UTF8_TOO_LARGE  = 1 << 3,  // 11110100 1001____ and above
+    UTF8_SURROGATE  = 1 << 4,  // 11101101 101_____
+    UTF8_OVERLONG_2 = 1 << 5,  // 1100000_ 10______
+    UTF8_TOO_LARGE_1000 = 1 << 6,  // 11110101 1000____ and above
+    UTF8_OVERLONG_4 = 1 << 6,  // 11110000 1000____
+    UTF8_TWO_CONTINUATIONS = 1 << 7,  // 10______ 10______
+
+    UTF8_CARRY = UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTINUATIONS,
+};
+
+static inline UTF8_SSSE3_TARGET __m128i utf8_lookup16(__m128i nibbles, __m128i table)
+{
+    return _mm_shuffle_epi8(table, nibbles);
+}
+
+static inline UTF8_SSSE3_TARGET __m128i utf8_high_nibbles(__m128i bytes)
+{
+    return _mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi8(0x0F));
+}
+
+static inline UTF8_SSSE3_TARGET __m128i utf8_check_special_cases(__m128i input, __m128i prev1)
+{
+    const __m128i byte_1_high_table = _mm_setr_epi8(
+        // 0_______ ________  ASCII in byte 1
+        UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+        UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+        // 10______ ________  continuation in byte 1
+        UTF8_TWO_CONTINUATIONS, UTF8_TWO_CONTINUATIONS, UTF8_TWO_CONTINUATIONS, UTF8_TWO_CONTINUATIONS,
+        // 1100____ ________  2 byte lead
+        UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+        // 1101____ ________  2 byte lead
+        UTF8_TOO_SHORT,
+        // 1110____ ________  3 byte lead
+        UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+        // 1111____ ________  4 byte lead
+        UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4);
+
+    const __m128i byte_1_low_table = _mm_setr_epi8(
+        // ____0000 ________
+        UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+        // ____0001 ________
+        UTF8_CARRY | UTF8_OVERLONG_2,
+        // ____001_ ________
+        UTF8_CARRY,
+        UTF8_CARRY,
+        // ____0100 ________
+        UTF8_CARRY | UTF8_TOO_LARGE,
+        // ____0101 ________ and above
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        // ____1101 ________
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000);
+
+    const __m128i byte_2_high_table = _mm_setr_epi8(
+        // ________ 0_______  ASCII in byte 2
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+        // ________ 1000____
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTINUATIONS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+        // ________ 1001____
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTINUATIONS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE,
+        // ________ 101_____
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTINUATIONS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTINUATIONS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+        // ________ 11______  lead in byte 2
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT);
+
+    __m128i byte_1_high = utf8_lookup16(utf8_high_nibbles(prev1), byte_1_high_table);
+    __m128i byte_1_low  = utf8_lookup16(_mm_and_si128(prev1, _mm_set1_epi8(0x0F)), byte_1_low_table);
+    __m128i byte_2_high = utf8_lookup16(utf8_high_nibbles(input), byte_2_high_table);
+
+    return _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+}
+
+// Bytes 2 and 3 positions after a 3 or 4 byte lead must be continuations.
+// The special case check already flags every continuation as an error (TWO_CONTINUATIONS
+// or TOO_LONG), so XORing with the expected continuations cancels out the legal ones.
+static inline UTF8_SSSE3_TARGET __m128i utf8_check_multibyte_lengths(__m128i input, __m128i prev_input, __m128i special_cases)
+{
+    __m128i prev2 = _mm_alignr_epi8(input, prev_input, 16 - 2);
+    __m128i prev3 = _mm_alignr_epi8(input, prev_input, 16 - 3);
+
+    __m128i is_third_byte  = _mm_subs_epu8(prev2, _mm_set1_epi8((char)(0xE0 - 0x80)));  // Only 111_____ end up >= 0x80.
+    __m128i is_fourth_byte = _mm_subs_epu8(prev3, _mm_set1_epi8((char)(0xF0 - 0x80)));  // Only 1111____ end up >= 0x80.
+
+    __m128i must_be_continuation = _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte), _mm_set1_epi8((char) 0x80));
+    return _mm_xor_si128(must_be_continuation, special_cases);
+}
+
+// Nonzero if the block ends in the middle of a sequence. This only matters if
+// the next block is skipped by the ASCII fast path, otherwise the next block's
+// own checks catch it.
+static inline UTF8_SSSE3_TARGET __m128i utf8_is_incomplete(__m128i input)
+{
+    const __m128i max_value = _mm_setr_epi8(
+        (char) 0xFF, (char) 0xFF, (char) 0xFF, (char) 0xFF, (char) 0xFF, (char) 0xFF, (char) 0xFF, (char) 0xFF,
+        (char) 0xFF, (char) 0xFF, (char) 0xFF, (char) 0xFF, (char) 0xFF,
+        (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
+    return _mm_subs_epu8(input, max_value);
+}
+
+struct UTF8_Checker
+{
+    __m128i error;
+    __m128i prev_input;
+    __m128i prev_incomplete;
+};
+
+static inline UTF8_SSSE3_TARGET void utf8_check_block(UTF8_Checker* checker, __m128i input)
+{
+    __m128i prev1 = _mm_alignr_epi8(input, checker->prev_input, 16 - 1);
+    __m128i special_cases = utf8_check_special_cases(input, prev1);
+    __m128i error = utf8_check_multibyte_lengths(input, checker->prev_input, special_cases);
+
+    checker->error = _mm_or_si128(checker->error, error);
+    checker->prev_incomplete = utf8_is_incomplete(input);
+    checker->prev_input = input;
+}
+
+// 64 bytes per iteration; chunks that are pure ASCII only cost a load, an OR and a movemask.
+static UTF8_SSSE3_TARGET bool is_valid_utf8_simd(const u8* data, umm length)
+{
+    UTF8_Checker checker;
+    checker.error = _mm_setzero_si128();
+    checker.prev_input = _mm_setzero_si128();
+    checker.prev_incomplete = _mm_setzero_si128();
+
+    umm i = 0;
+    for (; i + 64 <= length; i += 64)
+    {
+        __m128i block0 = _mm_loadu_si128((const __m128i*)(data + i));
+        __m128i block1 = _mm_loadu_si128((const __m128i*)(data + i + 16));
+        __m128i block2 = _mm_loadu_si128((const __m128i*)(data + i + 32));
+        __m128i block3 = _mm_loadu_si128((const __m128i*)(data + i + 48));
+
+        __m128i any = _mm_or_si128(_mm_or_si128(block0, block1), _mm_or_si128(block2, block3));
+        if (!_mm_movemask_epi8(any))
+        {
+            checker.error = _mm_or_si128(checker.error, checker.prev_incomplete);
+            checker.prev_incomplete = _mm_setzero_si128();
+            checker.prev_input = block3;
+            continue;
+        }
+
+        utf8_check_block(&checker, block0);
+        utf8_check_block(&checker, block1);
+        utf8_check_block(&checker, block2);
+        utf8_check_block(&checker, block3);
+
+        // Bail out early, there's no point in validating the rest.
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(checker.error, _mm_setzero_si128())) != 0xFFFF)
+            return false;
+    }
+
+    // The tail is padded with zeroes. Zeroes are ASCII, so a sequence cut off by
+    // the end of input is reported as too short by the padded block itself, or by
+    // an extra all zero block if the input ends exactly on a block boundary.
+    while (true)
+    {
+        u8 padded[16] = {};
+        umm tail_length = length - i;
+        if (tail_length > 16)
+            tail_length = 16;
+        copy(padded, data + i, tail_length);
+
+        utf8_check_block(&checker, _mm_loadu_si128((const __m128i*) padded));
+        i += tail_length;
+
+        if (tail_length < 16)
+            break;
+    }
+
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(checker.error, _mm_setzero_si128())) == 0xFFFF;
+}
+
+#if UTF8_CHECK_SSSE3
+static bool cpu_has_ssse3()
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 9)) != 0;
+#else
+    return __builtin_cpu_supports("ssse3");
+#endif
+}
+#endif
+
+#endif
+
+
+
+//
+// Public interface.
+//
+
+
+bool is_valid_utf8(String string)
+{
+#ifdef UTF8_SIMD
+#if UTF8_CHECK_SSSE3
+    static const bool has_ssse3 = cpu_has_ssse3();
+#else
+    const bool has_ssse3 = true;
+#endif
+    if (string.length >= 64 && has_ssse3)
+        return is_valid_utf8_simd(string.data, string.length);
+    return is_valid_utf8_scalar(string.data, string.length);
+#else
+    return is_valid_utf8_scalar(string.data, string.length);
+#endif
+}
+
+
+static const u8 UTF8_REPLACEMENT_CHARACTER[3] = { 0xEF, 0xBF, 0xBD };  // U+FFFD
+
+// Writes the repaired string to 'target' if it isn't NULL, returns its length.
+static umm repair_utf8(u8* target, String source)
+{
+    umm written = 0;
+    umm i = 0;
+    while (i < source.length)
+    {
+        umm invalid_length;
+        umm sequence_length = measure_utf8_sequence(source.data + i, source.length - i, &invalid_length);
+
+        if (sequence_length)
+        {
+            if (target) copy(target + written, source.data + i, sequence_length);
+            written += sequence_length;
+            i += sequence_length;
+        }
+        else
+        {
+            if (target) copy(target + written, UTF8_REPLACEMENT_CHARACTER, 3);
+            written += 3;
+            i += invalid_length;
+        }
+    }
+
+    return written;
+}
+
+
+UTF8_Status sanitize_utf8(String* string, UTF8_Policy policy)
+{
+    if (is_valid_utf8(*string))
+        return UTF8_OK;
+
+    if (policy == UTF8_REJECT)
+        return UTF8_INVALID;
+
+    umm length = repair_utf8(NULL, *string);
+
+    // With a byte limit or a caller's allocator, temp can run out.
+    String repaired;
+    repaired.length = length;
+    repaired.data = LK_RegionArray(temp, u8, length);
+    if (!repaired.data)
+        return UTF8_OUT_OF_MEMORY;
+
+    length = repair_utf8(repaired.data, *string);
+    DebugAssert(repaired.length == length);
+
+    *string = repaired;
+    return UTF8_OK;
+}
+
+
+
+//
+// Transcoding.
+// ASCII runs are widened 16 or 32 bytes at a time, the scalar path only
+// ever sees the multi-byte sequences and the bytes right around them.
+//
+
+
+umm transcode_utf8_to_utf16(u16* target, String source)
+{
+    const u8* data = source.data;
+    umm length = source.length;
+
+    umm read = 0;
+    umm written = 0;
+    while (read < length)
+    {
+#ifdef UTF8_AVX2
+        while (read + 32 <= length)
+        {
+            __m256i bytes = _mm256_loadu_si256((const __m256i*)(data + read));
+            if (_mm256_movemask_epi8(bytes))
+                break;
+
+            __m256i low  = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(bytes));
+            __m256i high = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(bytes, 1));
+            _mm256_storeu_si256((__m256i*)(target + written),      low);
+            _mm256_storeu_si256((__m256i*)(target + written + 16), high);
+
+            read += 32;
+            written += 32;
+        }
+#endif
+#ifdef UTF8_SIMD
+        while (read + 16 <= length)
+        {
+            __m128i bytes = _mm_loadu_si128((const __m128i*)(data + read));
+            if (_mm_movemask_epi8(bytes))
+                break;
+
+            __m128i zero = _mm_setzero_si128();
+            _mm_storeu_si128((__m128i*)(target + written),     _mm_unpacklo_epi8(bytes, zero));
+            _mm_storeu_si128((__m128i*)(target + written + 8), _mm_unpackhi_epi8(bytes, zero));
+
+            read += 16;
+            written += 16;
+        }
+#endif
+
+        // Scalar path, until the next byte that could start an ASCII run.
+        while (read < length)
+        {
+            u8 lead = data[read];
+            if (lead < 0x80)
+            {
+                target[written++] = lead;
+                read++;
+                break;
+            }
+
+            u32 code_point;
+            if (lead < 0xE0)
+            {
+                code_point = ((lead & 0x1F) << 6) | (data[read + 1] & 0x3F);
+                read += 2;
+            }
+            else if (lead < 0xF0)
+            {
+                code_point = ((lead & 0x0F) << 12) | ((data[read + 1] & 0x3F) << 6) | (data[read + 2] & 0x3F);
+                read += 3;
+            }
+            else
+            {
+                code_point = ((lead & 0x07) << 18) | ((data[read + 1] & 0x3F) << 12) | ((data[read + 2] & 0x3F) << 6) | (data[read + 3] & 0x3F);
+                read += 4;
+            }
+
+            if (code_point < 0x10000)
+            {
+                target[written++] = (u16) code_point;
+            }
+            else
+            {
+                code_point -= 0x10000;
+                target[written++] = 0xD800 + (u16)(code_point >> 10);
+                target[written++] = 0xDC00 + (u16)(code_point & 0x3FF);
+            }
+        }
+    }
+
+    return written;
+}
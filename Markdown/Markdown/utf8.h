@@ -0,0 +1,44 @@
+#pragma once
+
+#include "typedef.h"
+#include "string.h"
+
+
+
+//
+// UTF-8 validation.
+// Validation is strict: overlong encodings, surrogates, code points above
+// U+10FFFF and the old 5 and 6 byte forms are all rejected.
+//
+
+
+enum UTF8_Policy
+{
+    UTF8_REJECT,   // Invalid input is an error.
+    UTF8_REPLACE,  // Every maximal invalid subpart is replaced with U+FFFD.
+};
+
+
+enum UTF8_Status
+{
+    UTF8_OK,
+    UTF8_INVALID,        // Only with UTF8_REJECT.
+    UTF8_OUT_OF_MEMORY,  // The repaired copy couldn't be allocated, 'string' is left as it was.
+};
+
+
+bool is_valid_utf8(String string);
+
+// With UTF8_REPLACE, 'string' is replaced by a repaired copy if it was invalid.
+UTF8_Status sanitize_utf8(String* string, UTF8_Policy policy);  // Allocates if repairing.
+
+
+
+//
+// Transcoding.
+//
+
+
+// 'source' must be valid UTF-8, and 'target' must have room for source.length
+// code units. Returns the number of UTF-16 code units written.
+umm transcode_utf8_to_utf16(u16* target, String source);
@@ -0,0 +1,368 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+
+#include "typedef.h"
+#include "macros.h"
+#include "memory.h"
+#include "string.h"
+#include "hash_table.h"
+#include "utf8.h"
+#include "output.h"
+#include "parser.h"
+#include "file_io.h"
+#include "watch.h"
+
+#ifdef __linux__
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#endif
+
+
+
+#ifdef __linux__
+
+// Events that come within this long of the previous one belong to the same burst.
+static constexpr int WATCH_QUIET_MILLISECONDS = 30;
+// A burst is cut off after this long, so a file that never stops changing still gets rendered.
+static constexpr f64 WATCH_MAX_BURST_SECONDS = 0.5;
+
+// Documents up to a quarter of this are parsed without asking the OS for memory.
+static constexpr umm WATCH_RENDER_PAGE_SIZE = 64 * 1024 * 1024;
+
+
+static f64 get_watch_time()
+{
+    return std::chrono::duration<f64>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+struct Watched_File
+{
+    String path;             // Also the key in Watch_State::files.
+    u32 crc32;               // Of the last content rendered.
+    umm length;
+    bool rendered;
+    u32 queued_in_burst;     // Files changing many times in one burst are rendered once.
+    f64 changed_at;          // First event of the burst for this file.
+};
+
+struct Watch_State
+{
+    int inotify;
+    UTF8_Policy utf8_policy;
+    Parse_Options parse_options;
+
+    // Watch descriptor -> directory path, descriptors are small and reused.
+    String* directories;
+    umm directory_capacity;
+
+    // Paths that are kept, and the table, live here for as long as the watch runs.
+    // Paths of events and directory entries are scratch, in render_memory.
+    LK_Region* memory;
+    String_Map<Watched_File> files;
+    String* pending;         // Paths of files changed in this burst.
+    umm pending_count;
+    umm pending_capacity;
+    u32 burst;
+
+    // Everything a render allocates goes here, and is rewound after it.
+    // The first page is allocated up front and never given back.
+    LK_Region render_memory;
+    LK_Region_Cursor render_start;
+    UTF8_Sink sink;          // Keeps its buffer between renders.
+};
+
+
+static bool is_markdown_path(String path)
+{
+    String extension = ".md"_s;
+    return path.length > extension.length && substring(path, path.length - extension.length, extension.length) == extension;
+}
+
+// 'path' is only looked at, it's copied if the file is new.
+static void queue_file(Watch_State* state, String path, f64 now)
+{
+    Watched_File* file = state->files.find(path);
+    if (!file)
+    {
+        LK_Region* previous_temp = temp;
+        temp = state->memory;
+        Defer(temp = previous_temp);
+
+        Watched_File new_file = {};
+        new_file.path = clone_string(path);
+        file = state->files.insert(new_file.path, new_file);
+        if (!file)
+            return;
+    }
+
+    if (file->queued_in_burst == state->burst)
+        return;
+    file->queued_in_burst = state->burst;
+    file->changed_at = now;
+
+    if (state->pending_count == state->pending_capacity)
+    {
+        state->pending_capacity = state->pending_capacity ? state->pending_capacity * 2 : 64;
+        state->pending = (String*) realloc(state->pending, state->pending_capacity * sizeof(String));
+    }
+    state->pending[state->pending_count++] = file->path;
+}
+
+// Runs with 'temp' pointing at render_memory, 'path' is copied if it's kept.
+static bool add_directory(Watch_State* state, String path, f64 now)
+{
+    u32 mask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_ONLYDIR;
+    int descriptor = inotify_add_watch(state->inotify, make_c_style_string(path), mask);
+    if (descriptor < 0)
+    {
+        printf("Can't watch %.*s\n", StringArgs(path));
+        return false;
+    }
+
+    if ((umm) descriptor >= state->directory_capacity)
+    {
+        umm new_capacity = state->directory_capacity ? state->directory_capacity : 64;
+        while (new_capacity <= (umm) descriptor)
+            new_capacity *= 2;
+        state->directories = (String*) realloc(state->directories, new_capacity * sizeof(String));
+        for (umm i = state->directory_capacity; i < new_capacity; i++)
+            state->directories[i] = {};
+        state->directory_capacity = new_capacity;
+    }
+    state->directories[descriptor] = allocate_string(state->memory, path);
+
+    // Whatever is in the directory already, including what was created
+    // between it appearing and the watch being added.
+    DIR* directory = opendir(make_c_style_string(path));
+    if (!directory)
+        return true;
+    Defer(closedir(directory));
+
+    while (dirent* entry = readdir(directory))
+    {
+        String name = wrap_string(entry->d_name);
+        if (name == "."_s || name == ".."_s)
+            continue;
+
+        // Some file systems don't fill in d_type, like XFS without ftype and some NFS and overlay mounts.
+        bool is_directory = entry->d_type == DT_DIR;
+        if (entry->d_type == DT_UNKNOWN)
+        {
+            struct stat status;
+            is_directory = fstatat(dirfd(directory), entry->d_name, &status, AT_SYMLINK_NOFOLLOW) == 0 && S_ISDIR(status.st_mode);
+        }
+
+        String entry_path = concatenate(path, "/"_s, name);
+        if (is_directory)
+            add_directory(state, entry_path, now);
+        else if (is_markdown_path(entry_path))
+            queue_file(state, entry_path, now);
+    }
+    return true;
+}
+
+
+static void render_file(Watch_State* state, String path, Watched_File* file)
+{
+    f64 start = get_watch_time();
+
+    LK_Region* previous_temp = temp;
+    temp = &state->render_memory;
+    Defer(lk_region_rewind(&state->render_memory, &state->render_start));
+    Defer(temp = previous_temp);
+
+    String input;
+    if (!read_entire_file(&input, path))
+        return;  // Deleted or moved away again, there'll be another event if it comes back.
+
+    u32 crc32 = compute_crc32(input);
+    if (file->rendered && file->crc32 == crc32 && file->length == input.length)
+        return;
+
+    UTF8_Status utf8_status = sanitize_utf8(&input, state->utf8_policy);
+    if (utf8_status != UTF8_OK)
+    {
+        if (utf8_status == UTF8_OUT_OF_MEMORY)
+            printf("Out of memory repairing UTF-8: %.*s\n", StringArgs(path));
+        else
+            printf("File is not valid UTF-8: %.*s\n", StringArgs(path));
+        return;
+    }
+
+    clear(&state->sink.builder);
+    state->sink.sink.bytes_written = 0;
+    state->sink.sink.full = false;
+
+    Parse_Options options = state->parse_options;
+    Parse_Status status = parse(input, &state->sink.sink, &options);
+    if (status != PARSE_OK)
+    {
+        printf("Failed to convert %.*s: %s\n", StringArgs(path), get_parse_status_message(status));
+        return;
+    }
+
+    String html_path = get_html_path(path);
+    if (!write_entire_file(html_path, state->sink.builder.string))
+    {
+        printf("Failed to write file: %.*s\n", StringArgs(html_path));
+        return;
+    }
+
+    file->crc32 = crc32;
+    file->length = input.length;
+    file->rendered = true;
+
+    f64 end = get_watch_time();
+    printf("Rendered %.*s in %.2f ms, %.2f ms after it changed\n",
+        StringArgs(path), (end - start) * 1e3, (end - file->changed_at) * 1e3);
+}
+
+static void render_pending(Watch_State* state)
+{
+    for (umm i = 0; i < state->pending_count; i++)
+    {
+        String path = state->pending[i];
+        Watched_File* file = state->files.find(path);
+        if (file)
+            render_file(state, path, file);
+    }
+    state->pending_count = 0;
+    fflush(stdout);
+}
+
+
+// Returns false if the inotify descriptor is broken.
+static bool read_events(Watch_State* state)
+{
+    alignas(inotify_event) u8 buffer[64 * 1024];
+    ssize_t length = read(state->inotify, buffer, sizeof(buffer));
+    if (length <= 0)
+        return length < 0 && errno == EINTR;
+
+    LK_Region* previous_temp = temp;
+    temp = &state->render_memory;
+    Defer(lk_region_rewind(&state->render_memory, &state->render_start));
+    Defer(temp = previous_temp);
+
+    f64 now = get_watch_time();
+    for (u8* at = buffer; at < buffer + length; )
+    {
+        inotify_event* event = (inotify_event*) at;
+        at += sizeof(inotify_event) + event->len;
+
+        if (event->mask & IN_Q_OVERFLOW)
+        {
+            // Some events were lost, every known file is checked against its hash.
+            for (umm i = 0; i < state->files.capacity; i++)
+                if (state->files.slots[i].occupied)
+                    queue_file(state, state->files.slots[i].value.path, now);
+            continue;
+        }
+
+        if (event->mask & IN_IGNORED)
+        {
+            if ((umm) event->wd < state->directory_capacity)
+                state->directories[event->wd] = {};
+            continue;
+        }
+
+        if ((umm) event->wd >= state->directory_capacity || !state->directories[event->wd] || !event->len)
+            continue;
+
+        String name = wrap_string(event->name);
+        String path = concatenate(state->directories[event->wd], "/"_s, name);
+
+        if (event->mask & IN_ISDIR)
+        {
+            if (event->mask & (IN_CREATE | IN_MOVED_TO))
+                add_directory(state, path, now);
+        }
+        else if ((event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) && is_markdown_path(path))
+        {
+            queue_file(state, path, now);
+        }
+    }
+    return true;
+}
+
+
+bool watch_directory(String directory, UTF8_Policy utf8_policy, Parse_Options* options)
+{
+    Watch_State state = {};
+    state.memory = temp;
+    state.utf8_policy = utf8_policy;
+    if (options)
+        state.parse_options = *options;
+
+    state.inotify = inotify_init1(IN_CLOEXEC);
+    if (state.inotify < 0)
+    {
+        printf("Can't use inotify to watch %.*s\n", StringArgs(directory));
+        return false;
+    }
+
+    // Warm up everything a render needs, so the first change isn't slower than the rest.
+    state.render_memory.page_size = WATCH_RENDER_PAGE_SIZE;
+    lk_region_alloc(&state.render_memory, 1, 1);
+    lk_region_cursor(&state.render_memory, &state.render_start);
+    init_utf8_sink(&state.sink);
+
+    while (directory.length > 1 && directory[directory.length - 1] == '/')
+        directory.length--;
+
+    state.burst = 1;
+    temp = &state.render_memory;
+    bool watching = add_directory(&state, directory, get_watch_time());
+    lk_region_rewind(&state.render_memory, &state.render_start);
+    temp = state.memory;
+    if (!watching)
+        return false;
+
+    printf("Watching %.*s, %llu files\n", StringArgs(directory), (unsigned long long) state.files.count);
+    render_pending(&state);
+
+    while (true)
+    {
+        pollfd poll_descriptor = { state.inotify, POLLIN, 0 };
+        if (poll(&poll_descriptor, 1, -1) < 0 && errno != EINTR)
+            return false;
+
+        state.burst++;
+        if (!read_events(&state))
+            return false;
+
+        // Everything until the events stop coming belongs to this burst.
+        f64 burst_start = get_watch_time();
+        while (get_watch_time() - burst_start < WATCH_MAX_BURST_SECONDS)
+        {
+            int ready = poll(&poll_descriptor, 1, WATCH_QUIET_MILLISECONDS);
+            if (ready == 0)
+                break;
+            if (ready < 0 && errno != EINTR)
+                return false;
+            if (ready > 0 && !read_events(&state))
+                return false;
+        }
+
+        render_pending(&state);
+    }
+}
+
+#else
+
+bool watch_directory(String directory, UTF8_Policy utf8_policy, Parse_Options* options)
+{
+    printf("Watching directories needs inotify, it only works on Linux: %.*s\n", StringArgs(directory));
+    return false;
+}
+
+#endif
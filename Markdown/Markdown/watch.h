@@ -0,0 +1,20 @@
+#pragma once
+
+#include "string.h"
+#include "utf8.h"
+#include "parser.h"
+
+
+
+//
+// Watch mode.
+// Converts every .md file under a directory to a .html file next to it, and
+// then again whenever its content changes, until the process is stopped.
+// Bursts of events, like an editor saving through a temporary file, are
+// handled together, and files whose content hashes the same are skipped.
+// Needs inotify, so it only works on Linux.
+//
+
+
+// Only returns if watching couldn't be set up.
+bool watch_directory(String directory, UTF8_Policy utf8_policy, Parse_Options* options);
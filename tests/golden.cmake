@@ -0,0 +1,40 @@
+# Golden test: converts golden/NAME.md and compares the output with the files next to it.
+#     NAME.html    what markdown writes to stdout, always there
+#     NAME.json    what --json-out writes, if the file is there
+#     NAME.txt     what --text-out writes, if the file is there
+# Run by ctest as cmake -D MARKDOWN=... -D GOLDEN_DIR=... -D NAME=... [-D ARGS="..."] -D OUT_DIR=... -P golden.cmake
+
+separate_arguments(ARGS)
+
+set(input ${GOLDEN_DIR}/${NAME}.md)
+set(json_out ${OUT_DIR}/${NAME}.json)
+set(text_out ${OUT_DIR}/${NAME}.txt)
+file(MAKE_DIRECTORY ${OUT_DIR})
+file(REMOVE ${json_out} ${text_out})
+
+set(command ${MARKDOWN} ${ARGS})
+if (EXISTS ${GOLDEN_DIR}/${NAME}.json)
+    list(APPEND command --json-out ${json_out})
+endif()
+if (EXISTS ${GOLDEN_DIR}/${NAME}.txt)
+    list(APPEND command --text-out ${text_out})
+endif()
+
+execute_process(COMMAND ${command} ${input} OUTPUT_FILE ${OUT_DIR}/${NAME}.html RESULT_VARIABLE result)
+if (NOT result EQUAL 0)
+    message(FATAL_ERROR "markdown exited with ${result}")
+endif()
+
+foreach (extension html json txt)
+    set(expected ${GOLDEN_DIR}/${NAME}.${extension})
+    set(actual ${OUT_DIR}/${NAME}.${extension})
+    if (NOT EXISTS ${expected})
+        continue()
+    endif()
+
+    execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${expected} ${actual} RESULT_VARIABLE different)
+    if (different)
+        file(READ ${actual} actual_content)
+        message(FATAL_ERROR "${actual} differs from ${expected}, it has:\n${actual_content}")
+    endif()
+endforeach()